@@ -0,0 +1,346 @@
+/**
+ * @file i2c_bus.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief i2c bus request queue
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * every bus gets a queue and a task that owns the legacy driver port, users
+ * submit requests and get a callback on completion, so a caller can queue
+ * several transfers and wait once instead of blocking on each of them
+ */
+#include "i2c_bus.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "string.h"
+
+static const char *TAG = "i2c_bus";
+
+struct i2c_bus_item {
+    struct i2c_bus_request request;
+    int64_t submit_time;
+    bool exit;
+};
+
+struct i2c_bus {
+    QueueHandle_t queue;
+    TaskHandle_t task;
+    int users;
+    struct i2c_bus_stat stat;
+};
+
+struct i2c_bus_sync {
+    SemaphoreHandle_t done;
+    StaticSemaphore_t buffer;
+    esp_err_t result;
+};
+
+static struct i2c_bus buses[I2C_NUM_MAX] = {0};
+
+static esp_err_t i2c_bus_transfer(i2c_port_t port, const struct i2c_bus_request *request)
+{
+    if (request->cmd) {
+        return i2c_master_cmd_begin(port, request->cmd, request->timeout);
+    }
+    if (request->write_len && request->read_len) {
+        return i2c_master_write_read_device(port, request->addr, request->write, request->write_len,
+                                            request->read, request->read_len, request->timeout);
+    }
+    if (request->read_len) {
+        return i2c_master_read_from_device(port, request->addr, request->read, request->read_len,
+                                           request->timeout);
+    }
+    return i2c_master_write_to_device(port, request->addr, request->write, request->write_len,
+                                      request->timeout);
+}
+
+static void i2c_bus_task(void *param)
+{
+    i2c_port_t port = (i2c_port_t) param;
+    struct i2c_bus *bus = &buses[port];
+    struct i2c_bus_item item;
+
+    while (xQueueReceive(bus->queue, &item, portMAX_DELAY) == pdTRUE) {
+        if (item.exit) {
+            item.request.cb(item.request.param, ESP_OK);
+            break;
+        }
+        int64_t start = esp_timer_get_time();
+        esp_err_t ret = i2c_bus_transfer(port, &item.request);
+        int64_t end = esp_timer_get_time();
+
+        bus->stat.requests++;
+        bus->stat.errors += ret != ESP_OK;
+        bus->stat.busy_time += end - start;
+        if (end - item.submit_time > bus->stat.max_latency) {
+            bus->stat.max_latency = end - item.submit_time;
+        }
+        if (item.request.cb) {
+            item.request.cb(item.request.param, ret);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief start the request queue of a bus, the driver must be installed
+ *
+ * @param port i2c port
+ *
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t i2c_bus_init(i2c_port_t port)
+{
+    struct i2c_bus *bus = &buses[port];
+    if (bus->users++ > 0) {
+        return ESP_OK;
+    }
+    memset(&bus->stat, 0, sizeof(bus->stat));
+    bus->queue = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(struct i2c_bus_item));
+    if (!bus->queue) {
+        bus->users = 0;
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(i2c_bus_task, "i2cBus", 3072, (void *) port,
+                    I2C_BUS_TASK_PRIORITY, &bus->task) != pdPASS) {
+        vQueueDelete(bus->queue);
+        bus->queue = NULL;
+        bus->users = 0;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static void i2c_bus_sync_cb(void *param, esp_err_t result)
+{
+    struct i2c_bus_sync *sync = param;
+    sync->result = result;
+    xSemaphoreGive(sync->done);
+}
+
+/**
+ * @brief stop the request queue of a bus after pending requests are done
+ *
+ * @param port i2c port
+ */
+void i2c_bus_deinit(i2c_port_t port)
+{
+    struct i2c_bus *bus = &buses[port];
+    if (bus->users == 0 || --bus->users > 0) {
+        return;
+    }
+    struct i2c_bus_sync sync;
+    sync.done = xSemaphoreCreateBinaryStatic(&sync.buffer);
+    struct i2c_bus_item item = {
+        .request = {.cb = i2c_bus_sync_cb, .param = &sync},
+        .exit = true,
+    };
+    xQueueSend(bus->queue, &item, portMAX_DELAY);
+    xSemaphoreTake(sync.done, portMAX_DELAY);
+    vSemaphoreDelete(sync.done);
+    vQueueDelete(bus->queue);
+    bus->queue = NULL;
+    bus->task = NULL;
+}
+
+/**
+ * @brief queue a request, blocks only while the queue is full
+ *
+ * @param port i2c port
+ * @param request request, copied into the queue
+ *
+ * @return esp_err_t ESP_OK if queued, ESP_ERR_INVALID_STATE if the bus is not started
+ */
+esp_err_t i2c_bus_submit(i2c_port_t port, const struct i2c_bus_request *request)
+{
+    struct i2c_bus *bus = &buses[port];
+    if (!bus->queue) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    struct i2c_bus_item item = {
+        .request = *request,
+        .submit_time = esp_timer_get_time(),
+    };
+    xQueueSend(bus->queue, &item, portMAX_DELAY);
+    return ESP_OK;
+}
+
+/**
+ * @brief run a request and wait for it, the callback of the request is
+ *        ignored. runs in the caller if the bus is not started or when
+ *        called from a completion callback
+ *
+ * @param port i2c port
+ * @param request request
+ *
+ * @return esp_err_t transfer result
+ */
+esp_err_t i2c_bus_execute(i2c_port_t port, struct i2c_bus_request *request)
+{
+    struct i2c_bus *bus = &buses[port];
+    if (!bus->queue || xTaskGetCurrentTaskHandle() == bus->task) {
+        return i2c_bus_transfer(port, request);
+    }
+    struct i2c_bus_sync sync;
+    sync.done = xSemaphoreCreateBinaryStatic(&sync.buffer);
+    request->cb = i2c_bus_sync_cb;
+    request->param = &sync;
+    esp_err_t ret = i2c_bus_submit(port, request);
+    if (ret == ESP_OK) {
+        xSemaphoreTake(sync.done, portMAX_DELAY);
+        ret = sync.result;
+    }
+    vSemaphoreDelete(sync.done);
+    return ret;
+}
+
+esp_err_t i2c_bus_write_read(i2c_port_t port, uint8_t addr, const uint8_t *write, size_t write_len,
+                             uint8_t *read, size_t read_len, TickType_t timeout)
+{
+    struct i2c_bus_request request = {
+        .addr = addr,
+        .write = write,
+        .write_len = write_len,
+        .read = read,
+        .read_len = read_len,
+        .timeout = timeout,
+    };
+    return i2c_bus_execute(port, &request);
+}
+
+esp_err_t i2c_bus_cmd(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t timeout)
+{
+    struct i2c_bus_request request = {
+        .cmd = cmd,
+        .timeout = timeout,
+    };
+    return i2c_bus_execute(port, &request);
+}
+
+void i2c_bus_get_stat(i2c_port_t port, struct i2c_bus_stat *stat)
+{
+    struct i2c_bus *bus = &buses[port];
+    *stat = bus->stat;
+    stat->pending = bus->queue ? uxQueueMessagesWaiting(bus->queue) : 0;
+}
+
+void i2c_bus_print_stat(int port)
+{
+    struct i2c_bus_stat stat;
+    if (port < 0 || port >= I2C_NUM_MAX) {
+        return;
+    }
+    i2c_bus_get_stat(port, &stat);
+    shellPrint(shellGetCurrent(), "port %d: %s, %lu requests, %lu errors, %lu pending, "
+               "busy %lld us, max latency %lld us\r\n",
+               port, buses[port].queue ? "queued" : "direct",
+               (unsigned long) stat.requests, (unsigned long) stat.errors,
+               (unsigned long) stat.pending, stat.busy_time, stat.max_latency);
+}
+
+struct i2c_bus_bench {
+    SemaphoreHandle_t done;
+    StaticSemaphore_t buffer;
+    int remain;
+    int errors;
+};
+
+static void i2c_bus_bench_cb(void *param, esp_err_t result)
+{
+    struct i2c_bus_bench *bench = param;
+    bench->errors += result != ESP_OK;
+    if (--bench->remain == 0) {
+        xSemaphoreGive(bench->done);
+    }
+}
+
+static void i2c_bus_bench_result(const char *name, int count, int errors, int64_t time)
+{
+    shellPrint(shellGetCurrent(), "%-9s %6lld us, %5lld us/req, %6lld req/s, %d errors\r\n",
+               name, time, time / count, count * 1000000LL / (time ? time : 1), errors);
+}
+
+/**
+ * @brief compare blocking driver calls, queued synchronous calls and
+ *        pipelined asynchronous requests reading one register
+ *
+ * @param port i2c port, the driver must be installed
+ * @param addr device address
+ * @param reg register
+ * @param count request count
+ */
+void i2c_bus_bench(int port, int addr, int reg, int count)
+{
+    uint8_t write = reg;
+    uint8_t read[2];
+    int errors = 0;
+    int64_t start;
+    struct i2c_bus_stat stat;
+
+    if (port < 0 || port >= I2C_NUM_MAX || count <= 0) {
+        return;
+    }
+    if (!buses[port].queue) {
+        shellPrint(shellGetCurrent(), "port %d is not queued\r\n", port);
+        return;
+    }
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < count; i++) {
+        errors += i2c_master_write_read_device(port, addr, &write, 1, read, sizeof(read),
+                                               pdMS_TO_TICKS(100)) != ESP_OK;
+    }
+    i2c_bus_bench_result("blocking", count, errors, esp_timer_get_time() - start);
+
+    errors = 0;
+    start = esp_timer_get_time();
+    for (int i = 0; i < count; i++) {
+        errors += i2c_bus_write_read(port, addr, &write, 1, read, sizeof(read),
+                                     pdMS_TO_TICKS(100)) != ESP_OK;
+    }
+    i2c_bus_bench_result("queued", count, errors, esp_timer_get_time() - start);
+
+    struct i2c_bus_bench bench = {.remain = count};
+    bench.done = xSemaphoreCreateBinaryStatic(&bench.buffer);
+    struct i2c_bus_request request = {
+        .addr = addr,
+        .write = &write,
+        .write_len = 1,
+        .read = read,
+        .read_len = sizeof(read),
+        .timeout = pdMS_TO_TICKS(100),
+        .cb = i2c_bus_bench_cb,
+        .param = &bench,
+    };
+    buses[port].stat.max_latency = 0;
+    start = esp_timer_get_time();
+    for (int i = 0; i < count; i++) {
+        i2c_bus_submit(port, &request);
+    }
+    int64_t submit_time = esp_timer_get_time() - start;
+    xSemaphoreTake(bench.done, portMAX_DELAY);
+    i2c_bus_bench_result("pipelined", count, bench.errors, esp_timer_get_time() - start);
+    vSemaphoreDelete(bench.done);
+
+    i2c_bus_get_stat(port, &stat);
+    shellPrint(shellGetCurrent(), "caller blocked %lld us submitting, max latency %lld us\r\n",
+               submit_time, stat.max_latency);
+}
+
+static ShellCommand i2c_bus_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stat, i2c_bus_print_stat,
+        show i2c bus queue statistics\r\ni2cbus stat [port]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, bench, i2c_bus_bench,
+        compare blocking, queued and pipelined transfers\r\ni2cbus bench [port] [addr] [reg] [count]),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+i2cbus, i2c_bus_group, i2c bus queue);
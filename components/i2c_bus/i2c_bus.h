@@ -0,0 +1,63 @@
+/**
+ * @file i2c_bus.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief i2c bus request queue
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __I2C_BUS_H__
+#define __I2C_BUS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "driver/i2c.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#define I2C_BUS_QUEUE_LEN       16
+#define I2C_BUS_TASK_PRIORITY   6
+
+/**
+ * @brief completion callback, called from the bus task
+ */
+typedef void (*i2c_bus_cb_t)(void *param, esp_err_t result);
+
+/**
+ * @brief bus request
+ *
+ * with cmd set, the prepared command link is executed and the other
+ * transfer fields are ignored, otherwise `write` is sent and `read` is
+ * received after a repeated start, either may be empty. buffers and the
+ * command link must stay valid until the callback
+ */
+struct i2c_bus_request {
+    uint8_t addr;
+    const uint8_t *write;
+    size_t write_len;
+    uint8_t *read;
+    size_t read_len;
+    i2c_cmd_handle_t cmd;
+    TickType_t timeout;
+    i2c_bus_cb_t cb;
+    void *param;
+};
+
+struct i2c_bus_stat {
+    uint32_t requests;
+    uint32_t errors;
+    uint32_t pending;
+    int64_t busy_time;      /* us spent in transfers */
+    int64_t max_latency;    /* us from submit to completion */
+};
+
+esp_err_t i2c_bus_init(i2c_port_t port);
+void i2c_bus_deinit(i2c_port_t port);
+esp_err_t i2c_bus_submit(i2c_port_t port, const struct i2c_bus_request *request);
+esp_err_t i2c_bus_execute(i2c_port_t port, struct i2c_bus_request *request);
+esp_err_t i2c_bus_write_read(i2c_port_t port, uint8_t addr, const uint8_t *write, size_t write_len,
+                             uint8_t *read, size_t read_len, TickType_t timeout);
+esp_err_t i2c_bus_cmd(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t timeout);
+void i2c_bus_get_stat(i2c_port_t port, struct i2c_bus_stat *stat);
+
+#endif /* __I2C_BUS_H__ */
@@ -9,6 +9,8 @@
 #include "ina226.h"
 #include "driver/i2c.h"
 #include "freertos/projdefs.h"
+#include "freertos/semphr.h"
+#include "i2c_bus.h"
 
 static const char *TAG = "ina226";
 
@@ -21,13 +23,13 @@ static int ina226_write(uint8_t reg, uint16_t data)
     buf[0] = reg;
     buf[1] = data >> 8;
     buf[2] = data & 0xff;
-    return i2c_master_write_to_device(INA226_I2C_BUS, INA226_ADDR, buf, 3, pdMS_TO_TICKS(100));
+    return i2c_bus_write_read(INA226_I2C_BUS, INA226_ADDR, buf, 3, NULL, 0, pdMS_TO_TICKS(100));
 }
 
 static int ina226_read(uint8_t reg, uint16_t *data)
 {
     uint8_t buf[2] = {0};
-    int res = i2c_master_write_read_device(INA226_I2C_BUS, INA226_ADDR, &reg, 1, buf, 2, pdMS_TO_TICKS(100));
+    int res = i2c_bus_write_read(INA226_I2C_BUS, INA226_ADDR, &reg, 1, buf, 2, pdMS_TO_TICKS(100));
     if (res == 0)
     {
         *data = (buf[0] << 8) | buf[1];
@@ -99,3 +101,65 @@ int ina226_read_power(void)
     ina226_read(INA226_REG_POWER, &data);
     return (int)(data * ina226_current_lsb * 25);
 }
+
+struct ina226_sample_request {
+    SemaphoreHandle_t done;
+    StaticSemaphore_t buffer;
+    int remain;
+    int errors;
+};
+
+static void ina226_sample_cb(void *param, esp_err_t result)
+{
+    struct ina226_sample_request *request = param;
+    request->errors += result != ESP_OK;
+    if (--request->remain == 0) {
+        xSemaphoreGive(request->done);
+    }
+}
+
+/**
+ * @brief read bus voltage, shunt voltage, current and power, the four reads
+ *        are queued at once and the caller waits only for the last one
+ *
+ * @param sample sample
+ *
+ * @return int 0 on success
+ */
+int ina226_read_sample(struct ina226_sample *sample)
+{
+    static const uint8_t regs[] = {
+        INA226_REG_BUS_VOLT, INA226_REG_SHUNT_VOLT, INA226_REG_CURRENT, INA226_REG_POWER
+    };
+    uint8_t data[sizeof(regs)][2] = {0};
+    struct ina226_sample_request request = {.remain = sizeof(regs)};
+    request.done = xSemaphoreCreateBinaryStatic(&request.buffer);
+
+    for (int i = 0; i < sizeof(regs); i++) {
+        struct i2c_bus_request transfer = {
+            .addr = INA226_ADDR,
+            .write = &regs[i],
+            .write_len = 1,
+            .read = data[i],
+            .read_len = 2,
+            .timeout = pdMS_TO_TICKS(100),
+            .cb = ina226_sample_cb,
+            .param = &request,
+        };
+        if (i2c_bus_submit(INA226_I2C_BUS, &transfer) != ESP_OK) {
+            transfer.cb = NULL;
+            request.errors += i2c_bus_execute(INA226_I2C_BUS, &transfer) != ESP_OK;
+            request.remain--;
+        }
+    }
+    if (request.remain > 0) {
+        xSemaphoreTake(request.done, portMAX_DELAY);
+    }
+    vSemaphoreDelete(request.done);
+
+    sample->voltage = (int)((float)((data[0][0] << 8) | data[0][1]) * 1.25);
+    sample->shunt = (int)(((data[1][0] << 8) | data[1][1]) * 2.5);
+    sample->current = (int)(((data[2][0] << 8) | data[2][1]) * ina226_current_lsb * 1000);
+    sample->power = (int)(((data[3][0] << 8) | data[3][1]) * ina226_current_lsb * 25);
+    return request.errors ? -1 : 0;
+}
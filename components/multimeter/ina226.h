@@ -25,6 +25,13 @@
 #define INA226_REG_MFG_ID       0xFE
 #define INA226_REG_DIE_ID       0xFF
 
+struct ina226_sample {
+    int voltage;    /* mV */
+    int shunt;      /* uV */
+    int current;    /* mA */
+    int power;      /* mW */
+};
+
 int ina226_debug_read(uint8_t reg);
 int ina226_debug_write(uint8_t reg, uint16_t data);
 int ina226_reset(void);
@@ -34,5 +41,6 @@ int ina226_read_voltage(void);
 int ina226_read_shunt_voltage(void);
 int ina226_read_current(void);
 int ina226_read_power(void);
+int ina226_read_sample(struct ina226_sample *sample);
 
 #endif
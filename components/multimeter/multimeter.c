@@ -14,6 +14,7 @@
 #include "draw/lv_image_dsc.h"
 #include "gui.h"
 #include "hal/gpio_types.h"
+#include "i2c_bus.h"
 #include "ina226.h"
 #include "launcher.h"
 #include "misc/lv_area.h"
@@ -132,10 +133,11 @@ static void multimeter_task(void *arg)
     {
         if (value_label)
         {
-            int voltage = ina226_read_voltage();
-            int current = ina226_read_current();
-            int power = ina226_read_power();
-            int shunt = ina226_read_shunt_voltage();
+            struct ina226_sample sample;
+            ina226_read_sample(&sample);
+            int voltage = sample.voltage;
+            int current = sample.current;
+            int power = sample.power;
             // int current = (int)((float)shunt / MULTIMETER_SHUNT_RESISTOR / 1000);
             // int power = voltage * current;
             if (type == MUTLIMETER_TYPE_VOLTAGE) {
@@ -225,6 +227,7 @@ static RtAppErr multimeter_init(void)
     io_conf.intr_type = GPIO_INTR_DISABLE;
     gpio_config(&io_conf);
 
+    i2c_bus_init(INA226_I2C_BUS);
     ina226_reset();
     ina226_init(MULTIMETER_CURRENT_LSB, MULTIMETER_SHUNT_RESISTOR);
     return RTAM_OK;
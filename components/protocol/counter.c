@@ -0,0 +1,640 @@
+/**
+ * @file counter.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief frequency counter
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * pcnt counts rising edges all the time, every gate time the count gives the
+ * frequency with the gate method. below the crossover frequency the mcpwm
+ * capture channel is enabled as well, it timestamps both edges into a ring,
+ * the task turns them into period, high time and duty. the ring is drained
+ * every poll, if the edge rate goes far above the crossover the capture is
+ * turned off at once so it can not flood the core with interrupts
+ */
+#include "core/lv_obj.h"
+#include "core/lv_obj_pos.h"
+#include "core/lv_obj_style_gen.h"
+#include "driver/gpio.h"
+#include "driver/mcpwm_cap.h"
+#include "driver/pulse_cnt.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "draw/lv_image_dsc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gui.h"
+#include "launcher.h"
+#include "lvgl.h"
+#include "misc/lv_area.h"
+#include "misc/lv_palette.h"
+#include "protocol_common.h"
+#include "protocol_freq.h"
+#include "rtam.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "stdio.h"
+#include "widgets/label/lv_label.h"
+
+#define COUNTER_PIN                 17
+#define COUNTER_GATE_DEFAULT_MS     100
+#define COUNTER_GATE_MIN_MS         10
+#define COUNTER_GATE_MAX_MS         10000
+#define COUNTER_POLL_MS             10
+#define COUNTER_TIMEOUT_US          2000000
+#define COUNTER_RING_SIZE           2048
+#define COUNTER_PCNT_LIMIT          32767
+#define COUNTER_CAPTURE_GUARD       8 /* capture off above crossover times this */
+
+#define COUNTER_MODE_AUTO           0
+#define COUNTER_MODE_GATE           1
+#define COUNTER_MODE_CAPTURE        2
+
+static const char *TAG = "counter";
+
+static struct {
+    volatile bool run;
+    int tasks;
+    int setting;
+    int mode;
+    uint32_t gate_ms;
+    uint32_t crossover;
+    pcnt_unit_handle_t pcnt;
+    pcnt_channel_handle_t pcnt_channel;
+    mcpwm_cap_timer_handle_t cap_timer;
+    mcpwm_cap_channel_handle_t cap_channel;
+    bool cap_enabled;
+    uint32_t ticks[COUNTER_RING_SIZE];
+    uint8_t rising[COUNTER_RING_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t overflows;
+    uint32_t overflow_at;           /* head while edges were dropped, the gap follows that entry */
+    uint32_t seen_overflows;
+    struct protocol_freq_capture capture;
+    struct protocol_freq_stats stats;
+    bool stats_reset;               /* requested from the gui or shell, done by the task */
+    struct protocol_freq_result result;
+    bool has_capture;
+    double resolution;
+    int64_t last_edge;
+} counter = {
+    .gate_ms = COUNTER_GATE_DEFAULT_MS,
+};
+
+static lv_obj_t *screen = NULL;
+static lv_obj_t *mode_label = NULL;
+static lv_obj_t *freq_label = NULL;
+static lv_obj_t *pulse_label = NULL;
+static lv_obj_t *stats_label = NULL;
+
+static lv_obj_t* counter_get_screen(void);
+static lv_obj_t* counter_create_pin_map_screen(void);
+static void counter_reset(void);
+
+static int counter_gesture_callback(lv_dir_t dir)
+{
+    if (dir == LV_DIR_RIGHT) {
+        if (lv_screen_active() == counter_get_screen()) {
+            rtamTerminate("counter");
+        } else {
+            gui_back();
+        }
+        return 0;
+    } else if (dir == LV_DIR_BOTTOM) {
+        if (lv_screen_active() == counter_get_screen()) {
+            gui_push_screen(counter_create_pin_map_screen(), LV_SCR_LOAD_ANIM_MOVE_BOTTOM);
+        }
+        return 0;
+    } else if (dir == LV_DIR_TOP) {
+        if (lv_screen_active() != counter_get_screen()) {
+            gui_pop_screen(LV_SCR_LOAD_ANIM_MOVE_TOP);
+        }
+        return 0;
+    }
+    return -1;
+}
+
+static lv_obj_t* counter_create_pin_map_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), LV_PART_MAIN);
+
+    lv_obj_t *pin_map = protocol_create_pin_map(scr);
+
+    lv_obj_center(pin_map);
+
+    return scr;
+}
+
+static lv_obj_t* counter_get_screen(void)
+{
+    if (!screen)
+    {
+        screen = lv_obj_create(NULL);
+        lv_obj_set_style_bg_color(screen, lv_color_hex(0x000000), LV_PART_MAIN);
+    }
+    return screen;
+}
+
+static void counter_screen_event_cb(lv_event_t *event)
+{
+    if (lv_event_get_code(event) == LV_EVENT_CLICKED) {
+        counter_reset();
+    }
+}
+
+static void counter_init_screen(void)
+{
+    lv_obj_t *scr = counter_get_screen();
+
+    lv_obj_add_event_cb(scr, counter_screen_event_cb, LV_EVENT_CLICKED, NULL);
+
+    mode_label = lv_label_create(scr);
+    lv_obj_set_style_text_font(mode_label, &lv_font_montserrat_16, LV_PART_MAIN);
+    lv_obj_set_style_text_color(mode_label, lv_palette_main(LV_PALETTE_GREY), LV_PART_MAIN);
+    lv_label_set_text(mode_label, "");
+    lv_obj_align(mode_label, LV_ALIGN_TOP_MID, 0, 24);
+
+    freq_label = lv_label_create(scr);
+    lv_obj_set_style_text_font(freq_label, &lv_font_montserrat_24, LV_PART_MAIN);
+    lv_label_set_text(freq_label, "- Hz");
+    lv_obj_align(freq_label, LV_ALIGN_CENTER, 0, -48);
+
+    pulse_label = lv_label_create(scr);
+    lv_obj_set_style_text_font(pulse_label, &lv_font_montserrat_16, LV_PART_MAIN);
+    lv_obj_set_style_text_align(pulse_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_label_set_text(pulse_label, "");
+    lv_obj_align(pulse_label, LV_ALIGN_CENTER, 0, 0);
+
+    stats_label = lv_label_create(scr);
+    lv_obj_set_style_text_font(stats_label, &lv_font_montserrat_16, LV_PART_MAIN);
+    lv_obj_set_style_text_color(stats_label, lv_palette_main(LV_PALETTE_BLUE), LV_PART_MAIN);
+    lv_label_set_text(stats_label, "");
+    lv_obj_align(stats_label, LV_ALIGN_BOTTOM_MID, 0, -24);
+}
+
+static bool IRAM_ATTR counter_capture_cb(mcpwm_cap_channel_handle_t channel, const mcpwm_capture_event_data_t *edata,
+                                         void *user_ctx)
+{
+    uint32_t head = counter.head;
+    if (head - __atomic_load_n(&counter.tail, __ATOMIC_ACQUIRE) >= COUNTER_RING_SIZE) {
+        counter.overflow_at = head;
+        __atomic_store_n(&counter.overflows, counter.overflows + 1, __ATOMIC_RELEASE);
+        return false;
+    }
+    counter.ticks[head % COUNTER_RING_SIZE] = edata->cap_value;
+    counter.rising[head % COUNTER_RING_SIZE] = edata->cap_edge == MCPWM_CAP_EDGE_POS;
+    __atomic_store_n(&counter.head, head + 1, __ATOMIC_RELEASE);
+    return false;
+}
+
+static esp_err_t counter_init_pcnt(int io)
+{
+    pcnt_unit_config_t unit_config = {
+        .low_limit = -COUNTER_PCNT_LIMIT,
+        .high_limit = COUNTER_PCNT_LIMIT,
+        .flags.accum_count = 1,
+    };
+    pcnt_chan_config_t channel_config = {
+        .edge_gpio_num = io,
+        .level_gpio_num = -1,
+    };
+    esp_err_t ret = pcnt_new_unit(&unit_config, &counter.pcnt);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = pcnt_new_channel(counter.pcnt, &channel_config, &counter.pcnt_channel);
+    if (ret == ESP_OK) {
+        ret = pcnt_channel_set_edge_action(counter.pcnt_channel, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                                           PCNT_CHANNEL_EDGE_ACTION_HOLD);
+    }
+    if (ret == ESP_OK) {
+        ret = pcnt_unit_add_watch_point(counter.pcnt, COUNTER_PCNT_LIMIT);
+    }
+    if (ret == ESP_OK) {
+        ret = pcnt_unit_enable(counter.pcnt);
+    }
+    if (ret == ESP_OK) {
+        ret = pcnt_unit_clear_count(counter.pcnt);
+    }
+    if (ret == ESP_OK) {
+        ret = pcnt_unit_start(counter.pcnt);
+    }
+    return ret;
+}
+
+static void counter_deinit_pcnt(void)
+{
+    if (counter.pcnt) {
+        pcnt_unit_stop(counter.pcnt);
+        pcnt_unit_disable(counter.pcnt);
+        if (counter.pcnt_channel) {
+            pcnt_del_channel(counter.pcnt_channel);
+            counter.pcnt_channel = NULL;
+        }
+        pcnt_del_unit(counter.pcnt);
+        counter.pcnt = NULL;
+    }
+}
+
+static esp_err_t counter_init_capture(int io)
+{
+    uint32_t clk_hz = 0;
+    mcpwm_capture_timer_config_t timer_config = {
+        .group_id = 0,
+        .clk_src = MCPWM_CAPTURE_CLK_SRC_DEFAULT,
+    };
+    mcpwm_capture_channel_config_t channel_config = {
+        .gpio_num = io,
+        .prescale = 1,
+        .flags.pos_edge = 1,
+        .flags.neg_edge = 1,
+    };
+    mcpwm_capture_event_callbacks_t callbacks = {
+        .on_cap = counter_capture_cb,
+    };
+    esp_err_t ret = mcpwm_new_capture_timer(&timer_config, &counter.cap_timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = mcpwm_new_capture_channel(counter.cap_timer, &channel_config, &counter.cap_channel);
+    if (ret == ESP_OK) {
+        ret = mcpwm_capture_channel_register_event_callbacks(counter.cap_channel, &callbacks, NULL);
+    }
+    if (ret == ESP_OK) {
+        ret = mcpwm_capture_timer_enable(counter.cap_timer);
+    }
+    if (ret == ESP_OK) {
+        ret = mcpwm_capture_timer_start(counter.cap_timer);
+    }
+    if (ret == ESP_OK) {
+        ret = mcpwm_capture_timer_get_resolution(counter.cap_timer, &clk_hz);
+    }
+    protocol_freq_capture_init(&counter.capture, clk_hz);
+    return ret;
+}
+
+static void counter_deinit_capture(void)
+{
+    if (counter.cap_channel) {
+        if (counter.cap_enabled) {
+            mcpwm_capture_channel_disable(counter.cap_channel);
+            counter.cap_enabled = false;
+        }
+        mcpwm_del_capture_channel(counter.cap_channel);
+        counter.cap_channel = NULL;
+    }
+    if (counter.cap_timer) {
+        mcpwm_capture_timer_stop(counter.cap_timer);
+        mcpwm_capture_timer_disable(counter.cap_timer);
+        mcpwm_del_capture_timer(counter.cap_timer);
+        counter.cap_timer = NULL;
+    }
+}
+
+/**
+ * @brief switch between gate and capture method, statistics restart
+ */
+static void counter_set_mode(int mode)
+{
+    bool capture = mode == PROTOCOL_FREQ_MODE_CAPTURE;
+    if (capture != counter.cap_enabled) {
+        if (capture) {
+            __atomic_store_n(&counter.tail, counter.head, __ATOMIC_RELEASE);
+            protocol_freq_capture_init(&counter.capture, counter.capture.clk_hz);
+            mcpwm_capture_channel_enable(counter.cap_channel);
+        } else {
+            mcpwm_capture_channel_disable(counter.cap_channel);
+        }
+        counter.cap_enabled = capture;
+    }
+    if (mode != counter.mode) {
+        ESP_LOGI(TAG, "%s method", capture ? "capture" : "gate");
+    }
+    counter.mode = mode;
+    counter.has_capture = false;
+    protocol_freq_stats_reset(&counter.stats);
+}
+
+/**
+ * @brief turn captured edges into periods
+ *
+ * edges are only dropped while the ring is full, so the gap lies behind the
+ * entries queued at that time and the capture resyncs right there
+ */
+static void counter_drain(void)
+{
+    uint32_t period;
+    uint32_t tail = counter.tail;
+    uint32_t overflows = __atomic_load_n(&counter.overflows, __ATOMIC_ACQUIRE);
+    uint32_t overflow_at = counter.overflow_at;
+    uint32_t head = __atomic_load_n(&counter.head, __ATOMIC_ACQUIRE);
+    bool lost = overflows != counter.seen_overflows;
+
+    counter.seen_overflows = overflows;
+    if (head != tail) {
+        counter.last_edge = esp_timer_get_time();
+    }
+    for (; tail != head; tail++) {
+        uint32_t index = tail % COUNTER_RING_SIZE;
+        if (lost && tail == overflow_at) {
+            protocol_freq_capture_lost(&counter.capture);
+            lost = false;
+        }
+        if (protocol_freq_capture_edge(&counter.capture, counter.rising[index], counter.ticks[index], &period)
+            && period) {
+            protocol_freq_stats_add(&counter.stats, (double) counter.capture.clk_hz / period);
+        }
+    }
+    if (lost) {
+        protocol_freq_capture_lost(&counter.capture);
+    }
+    __atomic_store_n(&counter.tail, head, __ATOMIC_RELEASE);
+}
+
+static void counter_update_view(double freq)
+{
+    char value[24];
+    char buf[128];
+
+    gui_lock();
+    if (freq_label == NULL) {
+        gui_unlock();
+        return;
+    }
+    if (counter.mode == PROTOCOL_FREQ_MODE_CAPTURE) {
+        lv_label_set_text_fmt(mode_label, "%s capture", counter.setting == COUNTER_MODE_AUTO ? "AUTO" : "MANUAL");
+    } else {
+        lv_label_set_text_fmt(mode_label, "%s gate %lu ms", counter.setting == COUNTER_MODE_AUTO ? "AUTO" : "MANUAL",
+                              (unsigned long) counter.gate_ms);
+    }
+    protocol_freq_format(value, sizeof(value), freq, counter.resolution);
+    lv_label_set_text(freq_label, value);
+    if (counter.mode == PROTOCOL_FREQ_MODE_CAPTURE && counter.has_capture) {
+        snprintf(buf, sizeof(buf), "period %.3f us\nwidth %.3f us\nduty %.2f %%",
+                    counter.result.period * 1e6, counter.result.width * 1e6, counter.result.duty * 100);
+        lv_label_set_text(pulse_label, buf);
+    } else {
+        lv_label_set_text(pulse_label, freq > 0 ? "" : "no signal");
+    }
+    if (counter.stats.count) {
+        char min[24];
+        char max[24];
+        protocol_freq_format(min, sizeof(min), counter.stats.min, counter.resolution);
+        protocol_freq_format(max, sizeof(max), counter.stats.max, counter.resolution);
+        protocol_freq_format(value, sizeof(value), counter.stats.mean, counter.resolution);
+        snprintf(buf, sizeof(buf), "min %s\nmax %s\nmean %s\njitter %.3g Hz (%lu)",
+                    min, max, value, protocol_freq_stats_stddev(&counter.stats),
+                    (unsigned long) counter.stats.count);
+        lv_label_set_text(stats_label, buf);
+    } else {
+        lv_label_set_text(stats_label, "");
+    }
+    gui_unlock();
+}
+
+static void counter_task(void *param)
+{
+    int io = protocol_get_io(COUNTER_PIN);
+    int raw = 0;
+    uint32_t count;
+    uint32_t gate_count;
+    uint32_t poll_count;
+    int64_t gate_start;
+    int64_t poll_start;
+    double freq = 0;
+
+    if (counter_init_pcnt(io) != ESP_OK || counter_init_capture(io) != ESP_OK) {
+        ESP_LOGE(TAG, "counter init failed");
+        counter.run = false;
+        goto exit;
+    }
+    counter.crossover = protocol_freq_crossover(counter.capture.clk_hz, counter.gate_ms * 1000);
+    counter.mode = PROTOCOL_FREQ_MODE_GATE;
+    counter_set_mode(counter.setting == COUNTER_MODE_CAPTURE ? PROTOCOL_FREQ_MODE_CAPTURE : PROTOCOL_FREQ_MODE_GATE);
+    pcnt_unit_get_count(counter.pcnt, &raw);
+    gate_count = (uint32_t) raw;
+    gate_start = esp_timer_get_time();
+    poll_count = gate_count;
+    poll_start = gate_start;
+    counter.last_edge = gate_start;
+
+    while (counter.run) {
+        vTaskDelay(pdMS_TO_TICKS(COUNTER_POLL_MS));
+        if (__atomic_exchange_n(&counter.stats_reset, false, __ATOMIC_ACQUIRE)) {
+            protocol_freq_stats_reset(&counter.stats);
+        }
+        if (counter.cap_enabled) {
+            counter_drain();
+        }
+        pcnt_unit_get_count(counter.pcnt, &raw);
+        count = (uint32_t) raw;
+        int64_t now = esp_timer_get_time();
+
+        double poll_freq = protocol_freq_gate(count - poll_count, now - poll_start);
+        poll_count = count;
+        poll_start = now;
+        if (counter.cap_enabled && counter.setting != COUNTER_MODE_CAPTURE
+            && poll_freq > (double) counter.crossover * COUNTER_CAPTURE_GUARD) {
+            counter_set_mode(PROTOCOL_FREQ_MODE_GATE);
+        }
+        if (now - gate_start < (int64_t) counter.gate_ms * 1000) {
+            continue;
+        }
+
+        double gate_freq = protocol_freq_gate(count - gate_count, now - gate_start);
+        if (counter.mode == PROTOCOL_FREQ_MODE_GATE) {
+            freq = gate_freq;
+            counter.resolution = 1000000.0 / (now - gate_start);
+            protocol_freq_stats_add(&counter.stats, freq);
+        } else if (protocol_freq_capture_result(&counter.capture, &counter.result)) {
+            freq = counter.result.freq;
+            counter.has_capture = true;
+            counter.resolution = freq * 1000000.0 / ((double) counter.capture.clk_hz * (now - gate_start));
+        } else if (now - counter.last_edge > COUNTER_TIMEOUT_US) {
+            freq = 0;
+            counter.has_capture = false;
+        }
+        gate_count = count;
+        gate_start = now;
+
+        int mode = counter.setting == COUNTER_MODE_GATE ? PROTOCOL_FREQ_MODE_GATE : PROTOCOL_FREQ_MODE_CAPTURE;
+        if (counter.setting == COUNTER_MODE_AUTO) {
+            mode = protocol_freq_select(counter.mode,
+                                        counter.mode == PROTOCOL_FREQ_MODE_CAPTURE ? freq : gate_freq,
+                                        counter.crossover);
+        }
+        if (mode != counter.mode) {
+            counter_set_mode(mode);
+        }
+        counter_update_view(freq);
+    }
+
+exit:
+    counter_deinit_capture();
+    counter_deinit_pcnt();
+    __atomic_sub_fetch(&counter.tasks, 1, __ATOMIC_RELEASE);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief clear the statistics, the task owns them and clears them on its
+ *        next poll
+ */
+static void counter_reset(void)
+{
+    __atomic_store_n(&counter.stats_reset, true, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief set gate time, also the display update interval
+ *
+ * @param ms gate time, ms
+ */
+static int counter_set_gate(int ms)
+{
+    if (ms < COUNTER_GATE_MIN_MS || ms > COUNTER_GATE_MAX_MS) {
+        return -1;
+    }
+    counter.gate_ms = ms;
+    counter.crossover = protocol_freq_crossover(counter.capture.clk_hz, ms * 1000);
+    counter_reset();
+    shellPrint(shellGetCurrent(), "crossover %lu Hz\r\n", (unsigned long) counter.crossover);
+    return 0;
+}
+
+/**
+ * @brief select the measure method
+ *
+ * @param mode 0 auto, 1 gate, 2 capture
+ */
+static int counter_set_method(int mode)
+{
+    if (mode < COUNTER_MODE_AUTO || mode > COUNTER_MODE_CAPTURE) {
+        return -1;
+    }
+    counter.setting = mode;
+    return 0;
+}
+
+static void counter_stat(void)
+{
+    char value[24];
+    Shell *shell = shellGetCurrent();
+
+    if (!counter.run) {
+        shellPrint(shell, "counter not running\r\n");
+        return;
+    }
+    shellPrint(shell, "%s method, gate %lu ms, crossover %lu Hz, capture clock %lu Hz\r\n",
+               counter.mode == PROTOCOL_FREQ_MODE_CAPTURE ? "capture" : "gate",
+               (unsigned long) counter.gate_ms, (unsigned long) counter.crossover,
+               (unsigned long) counter.capture.clk_hz);
+    if (counter.mode == PROTOCOL_FREQ_MODE_CAPTURE && counter.has_capture) {
+        shellPrint(shell, "period %.3f us, width %.3f us, duty %.2f %%\r\n",
+                   counter.result.period * 1e6, counter.result.width * 1e6, counter.result.duty * 100);
+    }
+    if (counter.stats.count) {
+        protocol_freq_format(value, sizeof(value), counter.stats.mean, counter.resolution);
+        shellPrint(shell, "mean %s, min %.6f Hz, max %.6f Hz, jitter %.6f Hz, %lu samples\r\n",
+                   value, counter.stats.min, counter.stats.max, protocol_freq_stats_stddev(&counter.stats),
+                   (unsigned long) counter.stats.count);
+    }
+    if (counter.overflows) {
+        shellPrint(shell, "%lu edges dropped\r\n", (unsigned long) counter.overflows);
+    }
+}
+
+static ShellCommand counter_cmd_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stat, counter_stat,
+        show measurement\r\ncounter stat),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, gate, counter_set_gate,
+        set gate time\r\ncounter gate [ms]\r\n
+        ms: 10-10000),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, mode, counter_set_method,
+        set measure method\r\ncounter mode [mode]\r\n
+        mode: 0 auto, 1 gate, 2 capture),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, reset, counter_reset,
+        reset statistics\r\ncounter reset),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+counter, counter_cmd_group, frequency counter);
+
+static RtAppErr counter_suspend(void)
+{
+    launcher_go_home(LV_SCR_LOAD_ANIM_MOVE_RIGHT, true);
+    gui_lock();
+    mode_label = NULL;
+    freq_label = NULL;
+    pulse_label = NULL;
+    stats_label = NULL;
+    gui_unlock();
+    screen = NULL;
+    return RTAM_OK;
+}
+
+static RtAppErr counter_resume(void)
+{
+    counter_init_screen();
+    gui_push_screen(counter_get_screen(), LV_SCR_LOAD_ANIM_FADE_IN);
+    gui_set_global_gesture_callback(counter_gesture_callback);
+    return RTAM_OK;
+}
+
+static RtAppErr counter_init(void)
+{
+    protocol_reset_pin();
+    protocol_set_pin(COUNTER_PIN, "IN", lv_palette_main(LV_PALETTE_GREEN));
+    counter.run = true;
+    counter.tasks = 1;
+    counter.head = 0;
+    counter.tail = 0;
+    counter.overflows = 0;
+    counter.overflow_at = 0;
+    counter.seen_overflows = 0;
+    xTaskCreatePinnedToCore(counter_task, "counter", 4096, NULL, 5, NULL, 1);
+    return RTAM_OK;
+}
+
+static RtAppErr counter_deinit(void)
+{
+    counter.run = false;
+    while (__atomic_load_n(&counter.tasks, __ATOMIC_ACQUIRE) > 0) {
+        vTaskDelay(1);
+    }
+    gpio_reset_pin(protocol_get_io(COUNTER_PIN));
+    return RTAM_OK;
+}
+
+static const RtAppInterface interface = {
+    .start = counter_init,
+    .stop = counter_deinit,
+    .suspend = counter_suspend,
+    .resume = counter_resume,
+};
+
+static const RtAppDependencies dependencies = {
+    .required = (const char *[]){
+        "gui",
+        "launcher",
+        NULL
+    },
+    .conflicted = (const char *[]){
+        "serial_debug",
+        NULL
+    }
+};
+
+extern const lv_image_dsc_t icon_app_counter;
+static const RtamInfo counter_info = {
+    .label = "counter",
+    .icon = (void *) GUI_APP_ICON(counter),
+};
+
+RTAPP_EXPORT(counter, &interface, 0, &dependencies, &counter_info);
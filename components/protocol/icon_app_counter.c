@@ -0,0 +1,98 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_ICON_APP_COUNTER
+#define LV_ATTRIBUTE_IMAGE_ICON_APP_COUNTER
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_ICON_APP_COUNTER uint8_t icon_app_counter_map[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0x50, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0x50, 0xb0, 0x27, 0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x30, 0xb0, 0x27, 0x9c, 0x8f, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0x8f, 0xb0, 0x27, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x60, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xcf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x60, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x30, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x8f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x8f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0x00, 0x00, 0x00, 0x00, 
+  0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x20, 
+  0xb0, 0x27, 0x9c, 0x50, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x50, 
+  0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x80, 
+  0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 
+  0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 
+  0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 
+  0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 
+  0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 
+  0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 
+  0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 
+  0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 
+  0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 
+  0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 
+  0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x80, 
+  0xb0, 0x27, 0x9c, 0x50, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x50, 
+  0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x20, 
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x8f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x8f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x30, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0x7b, 0x21, 0x69, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x23, 0x18, 0x15, 0xff, 0x2c, 0x19, 0x1d, 0xff, 0x7b, 0x21, 0x69, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x60, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0xcf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x9f, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x60, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x10, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0x70, 0xb0, 0x27, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x30, 0xb0, 0x27, 0x9c, 0x8f, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xdf, 0xb0, 0x27, 0x9c, 0x8f, 0xb0, 0x27, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x9c, 0x20, 0xb0, 0x27, 0x9c, 0x50, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xff, 0xb0, 0x27, 0x9c, 0xef, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0xbf, 0xb0, 0x27, 0x9c, 0x80, 0xb0, 0x27, 0x9c, 0x50, 0xb0, 0x27, 0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const lv_image_dsc_t icon_app_counter = {
+  .header.cf = LV_COLOR_FORMAT_ARGB8888,
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.w = 64,
+  .header.h = 64,
+  .data_size = 4096 * 4,
+  .data = icon_app_counter_map,
+};
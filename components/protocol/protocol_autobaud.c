@@ -0,0 +1,97 @@
+/**
+ * @file protocol_autobaud.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol autobaud
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "protocol_autobaud.h"
+
+static const uint32_t standard_baudrates[] = {
+    300, 600, 1200, 2400, 4800, 9600, 14400, 19200, 28800, 38400, 57600, 74880,
+    115200, 230400, 250000, 460800, 500000, 921600, 1000000, 1500000, 2000000,
+    3000000, 4000000, 5000000,
+};
+
+/**
+ * @brief get the width of one bit from an edge trace
+ *
+ * pulses shorter than one bit at the max baudrate are treated as glitches, the
+ * result is the mean of all pulses within 1.5 times the shortest one, so that
+ * the estimation is not biased by jitter of a single edge
+ *
+ * @param edges edge timestamps in ticks, in order, may wrap around
+ * @param num edge number
+ * @param tick_hz tick frequency
+ * @return uint32_t bit width in ticks, 0 if not enough edges
+ */
+uint32_t protocol_autobaud_min_pulse(const uint32_t *edges, size_t num, uint32_t tick_hz)
+{
+    uint32_t glitch = tick_hz / PROTOCOL_AUTOBAUD_MAX_BAUDRATE;
+    uint32_t min = UINT32_MAX;
+
+    for (size_t i = 1; i < num; i++) {
+        uint32_t width = edges[i] - edges[i - 1];
+        if (width > glitch && width < min) {
+            min = width;
+        }
+    }
+    if (min == UINT32_MAX) {
+        return 0;
+    }
+
+    uint64_t sum = 0;
+    uint32_t count = 0;
+    uint32_t limit = min + (min >> 1);
+    for (size_t i = 1; i < num; i++) {
+        uint32_t width = edges[i] - edges[i - 1];
+        if (width >= min && width < limit) {
+            sum += width;
+            count++;
+        }
+    }
+    return (uint32_t) ((sum + count / 2) / count);
+}
+
+/**
+ * @brief snap a measured baudrate to the nearest standard baudrate
+ *
+ * @param baudrate measured baudrate
+ * @return uint32_t standard baudrate, 0 if none within tolerance
+ */
+uint32_t protocol_autobaud_snap(uint32_t baudrate)
+{
+    uint32_t best = 0;
+    uint64_t best_error = UINT64_MAX;
+
+    for (size_t i = 0; i < sizeof(standard_baudrates) / sizeof(standard_baudrates[0]); i++) {
+        uint32_t standard = standard_baudrates[i];
+        uint64_t error = standard > baudrate ? standard - baudrate : baudrate - standard;
+        /* relative error, scaled to compare without division */
+        error = error * 1000000 / standard;
+        if (error < best_error) {
+            best_error = error;
+            best = standard;
+        }
+    }
+    return best_error <= PROTOCOL_AUTOBAUD_TOLERANCE * 10000 ? best : 0;
+}
+
+/**
+ * @brief classify a bit width to a baudrate
+ *
+ * @param pulse bit width in ticks
+ * @param tick_hz tick frequency
+ * @return uint32_t standard baudrate if matched, otherwise the measured baudrate,
+ *         0 for invalid pulse
+ */
+uint32_t protocol_autobaud_classify(uint32_t pulse, uint32_t tick_hz)
+{
+    if (pulse == 0) {
+        return 0;
+    }
+    uint32_t measured = (uint32_t) (((uint64_t) tick_hz + pulse / 2) / pulse);
+    uint32_t standard = protocol_autobaud_snap(measured);
+    return standard ? standard : measured;
+}
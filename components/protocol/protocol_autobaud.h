@@ -0,0 +1,22 @@
+/**
+ * @file protocol_autobaud.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol autobaud
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_AUTOBAUD_H__
+#define __PROTOCOL_AUTOBAUD_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_AUTOBAUD_TOLERANCE     12 /* percent */
+#define PROTOCOL_AUTOBAUD_MAX_BAUDRATE  5000000
+
+uint32_t protocol_autobaud_min_pulse(const uint32_t *edges, size_t num, uint32_t tick_hz);
+uint32_t protocol_autobaud_snap(uint32_t baudrate);
+uint32_t protocol_autobaud_classify(uint32_t pulse, uint32_t tick_hz);
+
+#endif /* __PROTOCOL_AUTOBAUD_H__ */
@@ -0,0 +1,484 @@
+/**
+ * @file protocol_capture.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol capture file
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "protocol_capture.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+
+#define PROTOCOL_CAPTURE_BUF_SIZE       (32 * 1024)
+#define PROTOCOL_CAPTURE_RING_NUM       2
+#define PROTOCOL_CAPTURE_FLUSH_MS       500
+#define PROTOCOL_CAPTURE_POLL_MS        20
+#define PROTOCOL_CAPTURE_RECORD_MAX     1024
+#define PROTOCOL_CAPTURE_BENCH_PATH     "/spiflash/capture_bench.bin"
+
+static const char *TAG = "protocol_capture";
+
+struct capture_buffer {
+    uint8_t *data;
+    size_t used;
+    int writers;
+    bool full;
+};
+
+struct capture_ring {
+    struct protocol_ring *ring;
+    uint8_t source;
+    uint8_t direction;
+};
+
+static struct {
+    FILE *file;
+    volatile bool run;
+    TaskHandle_t task;
+    SemaphoreHandle_t exit;
+    struct capture_buffer buffer[2];
+    int active;
+    struct capture_ring rings[PROTOCOL_CAPTURE_RING_NUM];
+    long records;
+    long dropped;
+    long bytes_written;
+    int64_t write_time;
+    int64_t start_time;
+} capture = {0};
+
+static portMUX_TYPE capture_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t ring_mutex = NULL;
+
+static void protocol_capture_init_mutex(void)
+{
+    if (ring_mutex == NULL) {
+        ring_mutex = xSemaphoreCreateMutex();
+    }
+}
+
+/**
+ * @brief reserve space in the active buffer, switch to the other buffer when full
+ *
+ * never blocks, the copy is done outside of the lock, the writer waits until
+ * all writers of a buffer finished before flushing it
+ */
+static uint8_t *protocol_capture_reserve(size_t size, struct capture_buffer **reserved)
+{
+    uint8_t *area = NULL;
+    bool notify = false;
+
+    portENTER_CRITICAL(&capture_lock);
+    if (capture.run && size <= PROTOCOL_CAPTURE_BUF_SIZE) {
+        struct capture_buffer *buffer = &capture.buffer[capture.active];
+        if (buffer->used + size > PROTOCOL_CAPTURE_BUF_SIZE) {
+            struct capture_buffer *other = &capture.buffer[!capture.active];
+            if (!other->full && other->used == 0) {
+                buffer->full = true;
+                capture.active = !capture.active;
+                buffer = other;
+                notify = true;
+            } else {
+                buffer = NULL;
+            }
+        }
+        if (buffer) {
+            area = buffer->data + buffer->used;
+            buffer->used += size;
+            buffer->writers++;
+            *reserved = buffer;
+        }
+    }
+    portEXIT_CRITICAL(&capture_lock);
+    if (notify) {
+        xTaskNotifyGive(capture.task);
+    }
+    return area;
+}
+
+static void protocol_capture_release(struct capture_buffer *buffer)
+{
+    portENTER_CRITICAL(&capture_lock);
+    buffer->writers--;
+    capture.records++;
+    portEXIT_CRITICAL(&capture_lock);
+}
+
+static int protocol_capture_append(uint8_t source, uint8_t direction, uint16_t address, uint16_t flags,
+                                   int64_t timestamp, const void *data, size_t len)
+{
+    struct capture_buffer *buffer;
+    struct protocol_capture_record record = {
+        .timestamp = timestamp,
+        .length = len,
+        .source = source,
+        .direction = direction,
+        .address = address,
+        .flags = flags,
+    };
+    uint8_t *area = protocol_capture_reserve(sizeof(record) + len, &buffer);
+    if (area == NULL) {
+        return -1;
+    }
+    memcpy(area, &record, sizeof(record));
+    memcpy(area + sizeof(record), data, len);
+    protocol_capture_release(buffer);
+    return 0;
+}
+
+/**
+ * @brief append one record to the capture file, safe to call from any task
+ *
+ * @param source record source
+ * @param direction record direction
+ * @param address device address
+ * @param timestamp timestamp in us
+ * @param data payload
+ * @param len payload length
+ * @return int 0 on success, -1 if not running or the record is dropped
+ */
+int protocol_capture_write(uint8_t source, uint8_t direction, uint16_t address,
+                           int64_t timestamp, const void *data, size_t len)
+{
+    return protocol_capture_write_flags(source, direction, address, 0, timestamp, data, len);
+}
+
+/**
+ * @brief append one record with flags, such as a decoded frame
+ *
+ * @param source record source
+ * @param direction record direction
+ * @param address device address
+ * @param flags record flags
+ * @param timestamp timestamp in us
+ * @param data payload
+ * @param len payload length
+ * @return int 0 on success, -1 if not running or the record is dropped
+ */
+int protocol_capture_write_flags(uint8_t source, uint8_t direction, uint16_t address, uint16_t flags,
+                                 int64_t timestamp, const void *data, size_t len)
+{
+    if (!capture.run) {
+        return -1;
+    }
+    while (len > 0) {
+        size_t size = len > PROTOCOL_CAPTURE_RECORD_MAX ? PROTOCOL_CAPTURE_RECORD_MAX : len;
+        if (protocol_capture_append(source, direction, address, flags, timestamp, data, size) != 0) {
+            __atomic_add_fetch(&capture.dropped, 1, __ATOMIC_RELAXED);
+            return -1;
+        }
+        data = (const uint8_t *) data + size;
+        len -= size;
+    }
+    return 0;
+}
+
+bool protocol_capture_running(void)
+{
+    return capture.run;
+}
+
+/**
+ * @brief let the capture writer drain a ring, used by high rate receivers
+ *
+ * @param source record source
+ * @param direction record direction
+ * @param ring ring, the writer becomes its only consumer
+ * @return int 0 on success
+ */
+int protocol_capture_attach_ring(uint8_t source, uint8_t direction, struct protocol_ring *ring)
+{
+    int ret = -1;
+    protocol_capture_init_mutex();
+    xSemaphoreTake(ring_mutex, portMAX_DELAY);
+    for (int i = 0; i < PROTOCOL_CAPTURE_RING_NUM; i++) {
+        if (capture.rings[i].ring == NULL || capture.rings[i].ring == ring) {
+            capture.rings[i].ring = ring;
+            capture.rings[i].source = source;
+            capture.rings[i].direction = direction;
+            ret = 0;
+            break;
+        }
+    }
+    xSemaphoreGive(ring_mutex);
+    return ret;
+}
+
+void protocol_capture_detach_ring(struct protocol_ring *ring)
+{
+    protocol_capture_init_mutex();
+    xSemaphoreTake(ring_mutex, portMAX_DELAY);
+    for (int i = 0; i < PROTOCOL_CAPTURE_RING_NUM; i++) {
+        if (capture.rings[i].ring == ring) {
+            capture.rings[i].ring = NULL;
+        }
+    }
+    xSemaphoreGive(ring_mutex);
+}
+
+static void protocol_capture_drain_rings(void)
+{
+    const uint8_t *data;
+    int64_t timestamp;
+
+    xSemaphoreTake(ring_mutex, portMAX_DELAY);
+    for (int i = 0; i < PROTOCOL_CAPTURE_RING_NUM; i++) {
+        struct capture_ring *cr = &capture.rings[i];
+        if (cr->ring == NULL) {
+            continue;
+        }
+        size_t len;
+        while ((len = protocol_ring_peek(cr->ring, &data, &timestamp)) > 0) {
+            if (len > PROTOCOL_CAPTURE_RECORD_MAX) {
+                len = PROTOCOL_CAPTURE_RECORD_MAX;
+            }
+            if (protocol_capture_append(cr->source, cr->direction, 0, 0, timestamp, data, len) != 0) {
+                break;
+            }
+            protocol_ring_consume(cr->ring, len);
+        }
+    }
+    xSemaphoreGive(ring_mutex);
+}
+
+static bool protocol_capture_swap(void)
+{
+    bool swapped = false;
+    portENTER_CRITICAL(&capture_lock);
+    struct capture_buffer *buffer = &capture.buffer[capture.active];
+    struct capture_buffer *other = &capture.buffer[!capture.active];
+    if (buffer->used > 0 && !other->full) {
+        buffer->full = true;
+        capture.active = !capture.active;
+        swapped = true;
+    }
+    portEXIT_CRITICAL(&capture_lock);
+    return swapped;
+}
+
+static void protocol_capture_flush_buffer(void)
+{
+    for (int i = 0; i < 2; i++) {
+        struct capture_buffer *buffer = &capture.buffer[i];
+        if (!buffer->full) {
+            continue;
+        }
+        while (__atomic_load_n(&buffer->writers, __ATOMIC_ACQUIRE) > 0) {
+            vTaskDelay(1);
+        }
+        int64_t start = esp_timer_get_time();
+        size_t written = fwrite(buffer->data, 1, buffer->used, capture.file);
+        capture.write_time += esp_timer_get_time() - start;
+        capture.bytes_written += written;
+        if (written != buffer->used) {
+            ESP_LOGE(TAG, "write failed, %d/%d", (int) written, (int) buffer->used);
+        }
+        portENTER_CRITICAL(&capture_lock);
+        buffer->used = 0;
+        buffer->full = false;
+        portEXIT_CRITICAL(&capture_lock);
+    }
+}
+
+static void protocol_capture_task(void *param)
+{
+    int64_t last_flush = esp_timer_get_time();
+    while (capture.run) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PROTOCOL_CAPTURE_POLL_MS));
+        protocol_capture_drain_rings();
+        int64_t now = esp_timer_get_time();
+        if (now - last_flush >= PROTOCOL_CAPTURE_FLUSH_MS * 1000) {
+            protocol_capture_swap();
+            last_flush = now;
+        }
+        protocol_capture_flush_buffer();
+    }
+    /* rings are only fed while capture runs, leave nothing for the next start */
+    protocol_capture_drain_rings();
+    protocol_capture_flush_buffer();
+    protocol_capture_swap();
+    protocol_capture_flush_buffer();
+    xSemaphoreGive(capture.exit);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief start writing capture records to a file
+ *
+ * @param path file path, NULL for default path
+ * @return int 0 on success
+ */
+int protocol_capture_start(const char *path)
+{
+    if (capture.run) {
+        return -1;
+    }
+    protocol_capture_init_mutex();
+    if (path == NULL) {
+        path = PROTOCOL_CAPTURE_DEFAULT_PATH;
+    }
+    for (int i = 0; i < 2; i++) {
+        capture.buffer[i].data = heap_caps_malloc(PROTOCOL_CAPTURE_BUF_SIZE, MALLOC_CAP_INTERNAL);
+        if (!capture.buffer[i].data) {
+            capture.buffer[i].data = heap_caps_malloc(PROTOCOL_CAPTURE_BUF_SIZE, MALLOC_CAP_DEFAULT);
+        }
+        capture.buffer[i].used = 0;
+        capture.buffer[i].writers = 0;
+        capture.buffer[i].full = false;
+    }
+    capture.file = fopen(path, "wb");
+    if (!capture.file || !capture.buffer[0].data || !capture.buffer[1].data) {
+        ESP_LOGE(TAG, "capture start failed, file: %s", path);
+        if (capture.file) {
+            fclose(capture.file);
+            capture.file = NULL;
+        }
+        heap_caps_free(capture.buffer[0].data);
+        heap_caps_free(capture.buffer[1].data);
+        capture.buffer[0].data = NULL;
+        capture.buffer[1].data = NULL;
+        return -1;
+    }
+    struct protocol_capture_header header = {
+        .magic = PROTOCOL_CAPTURE_MAGIC,
+        .version = PROTOCOL_CAPTURE_VERSION,
+        .header_size = sizeof(struct protocol_capture_header),
+        .timestamp_resolution = 1000,
+        .reserved = 0,
+    };
+    fwrite(&header, 1, sizeof(header), capture.file);
+
+    capture.active = 0;
+    capture.records = 0;
+    capture.dropped = 0;
+    capture.bytes_written = 0;
+    capture.write_time = 0;
+    capture.start_time = esp_timer_get_time();
+    capture.exit = xSemaphoreCreateBinary();
+    capture.run = true;
+    xTaskCreate(protocol_capture_task, "capture writer", 4096, NULL, 2, &capture.task);
+    ESP_LOGI(TAG, "capture started, file: %s", path);
+    return 0;
+}
+
+/**
+ * @brief flush pending records and close the capture file
+ *
+ * @return int 0 on success
+ */
+int protocol_capture_stop(void)
+{
+    if (!capture.run) {
+        return -1;
+    }
+    capture.run = false;
+    xTaskNotifyGive(capture.task);
+    xSemaphoreTake(capture.exit, portMAX_DELAY);
+    vSemaphoreDelete(capture.exit);
+    capture.exit = NULL;
+    capture.task = NULL;
+
+    int64_t start = esp_timer_get_time();
+    fclose(capture.file);
+    capture.write_time += esp_timer_get_time() - start;
+    capture.file = NULL;
+    heap_caps_free(capture.buffer[0].data);
+    heap_caps_free(capture.buffer[1].data);
+    capture.buffer[0].data = NULL;
+    capture.buffer[1].data = NULL;
+    ESP_LOGI(TAG, "capture stopped, records: %ld, dropped: %ld, bytes: %ld",
+             capture.records, __atomic_load_n(&capture.dropped, __ATOMIC_RELAXED), capture.bytes_written);
+    return 0;
+}
+
+static void protocol_capture_status(void)
+{
+    int64_t elapsed = esp_timer_get_time() - capture.start_time;
+    shellPrint(shellGetCurrent(), "%s, records: %ld, dropped: %ld, written: %ld bytes\r\n",
+               capture.run ? "running" : "stopped",
+               capture.records, __atomic_load_n(&capture.dropped, __ATOMIC_RELAXED), capture.bytes_written);
+    if (capture.write_time > 0 && elapsed > 0) {
+        shellPrint(shellGetCurrent(), "write: %d KB/s, sustained: %d KB/s\r\n",
+                   (int) (capture.bytes_written * 1000000LL / 1024 / capture.write_time),
+                   (int) (capture.bytes_written * 1000000LL / 1024 / elapsed));
+    }
+}
+
+static void protocol_capture_shell_start(char *path)
+{
+    if (protocol_capture_start(path) != 0) {
+        shellPrint(shellGetCurrent(), "capture start failed\r\n");
+    }
+}
+
+static void protocol_capture_shell_stop(void)
+{
+    if (protocol_capture_stop() != 0) {
+        shellPrint(shellGetCurrent(), "capture not running\r\n");
+        return;
+    }
+    protocol_capture_status();
+}
+
+/**
+ * @brief write synthetic records as fast as possible and report sustained MB/s
+ *
+ * @param kbytes payload to write in KB
+ */
+static void protocol_capture_bench(int kbytes)
+{
+    if (capture.run) {
+        shellPrint(shellGetCurrent(), "capture running\r\n");
+        return;
+    }
+    if (kbytes <= 0) {
+        kbytes = 4096;
+    }
+    uint8_t payload[512];
+    for (int i = 0; i < sizeof(payload); i++) {
+        payload[i] = i;
+    }
+    if (protocol_capture_start(PROTOCOL_CAPTURE_BENCH_PATH) != 0) {
+        shellPrint(shellGetCurrent(), "capture start failed\r\n");
+        return;
+    }
+    long total = (long) kbytes * 1024;
+    long retry = 0;
+    for (long sent = 0; sent < total; ) {
+        if (protocol_capture_append(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, 0, 0,
+                                    esp_timer_get_time(), payload, sizeof(payload)) == 0) {
+            sent += sizeof(payload);
+        } else {
+            retry++;
+            vTaskDelay(1);
+        }
+    }
+    protocol_capture_stop();
+    protocol_capture_status();
+    shellPrint(shellGetCurrent(), "producer stalls: %ld\r\n", retry);
+    remove(PROTOCOL_CAPTURE_BENCH_PATH);
+}
+
+static ShellCommand capture_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, start, protocol_capture_shell_start,
+        start capture to file\r\ncapture start [path]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stop, protocol_capture_shell_stop,
+        stop capture\r\ncapture stop),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, status, protocol_capture_status,
+        show capture status\r\ncapture status),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, bench, protocol_capture_bench,
+        capture write benchmark\r\ncapture bench [kbytes]),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+capture, capture_group, protocol capture tool);
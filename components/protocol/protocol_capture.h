@@ -0,0 +1,69 @@
+/**
+ * @file protocol_capture.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol capture file
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_CAPTURE_H__
+#define __PROTOCOL_CAPTURE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "protocol_ring.h"
+
+#define PROTOCOL_CAPTURE_MAGIC          0x50435445 /* "ETCP" */
+#define PROTOCOL_CAPTURE_VERSION        1
+
+#define PROTOCOL_CAPTURE_SOURCE_UART    0
+#define PROTOCOL_CAPTURE_SOURCE_I2C     1
+#define PROTOCOL_CAPTURE_SOURCE_SPI     2
+
+#define PROTOCOL_CAPTURE_DIR_RX         0
+#define PROTOCOL_CAPTURE_DIR_TX         1
+
+#define PROTOCOL_CAPTURE_FLAG_FRAME     0x0001 /* payload is a decoded frame */
+#define PROTOCOL_CAPTURE_FLAG_ERROR     0x0002 /* frame failed crc or framing check */
+#define PROTOCOL_CAPTURE_FLAG_DECODER(_type) ((uint16_t) (_type) << 8)
+
+#define PROTOCOL_CAPTURE_DEFAULT_PATH   "/spiflash/capture.bin"
+
+/**
+ * @brief file header, all fields little endian
+ */
+struct protocol_capture_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t timestamp_resolution; /* timestamp unit in ns */
+    uint32_t reserved;
+} __attribute__((packed));
+
+/**
+ * @brief record header, followed by `length` bytes of payload
+ *
+ * address is the i2c device address for i2c records, 0 for others, flags
+ * marks decoded frames, with the decoder type in the high byte
+ */
+struct protocol_capture_record {
+    int64_t timestamp;
+    uint16_t length;
+    uint8_t source;
+    uint8_t direction;
+    uint16_t address;
+    uint16_t flags;
+} __attribute__((packed));
+
+int protocol_capture_start(const char *path);
+int protocol_capture_stop(void);
+bool protocol_capture_running(void);
+int protocol_capture_write(uint8_t source, uint8_t direction, uint16_t address,
+                           int64_t timestamp, const void *data, size_t len);
+int protocol_capture_write_flags(uint8_t source, uint8_t direction, uint16_t address, uint16_t flags,
+                                 int64_t timestamp, const void *data, size_t len);
+int protocol_capture_attach_ring(uint8_t source, uint8_t direction, struct protocol_ring *ring);
+void protocol_capture_detach_ring(struct protocol_ring *ring);
+
+#endif /* __PROTOCOL_CAPTURE_H__ */
@@ -14,6 +14,8 @@
 #include "core/lv_obj_style_gen.h"
 #include "esp_system.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
 #include "layouts/lv_layout.h"
 #include "lvgl.h"
 #include "gui.h"
@@ -218,4 +220,33 @@ lv_obj_t* protocol_create_pin_map(lv_obj_t *parent)
     lv_obj_align_to(pin_group2, pin_group1, LV_ALIGN_OUT_BOTTOM_MID, 0, 2);
 
     return pin_layout;
-}
\ No newline at end of file
+}
+
+void protocol_cpu_load_start(struct protocol_cpu_load *load)
+{
+    load->time = esp_timer_get_time();
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        load->idle[i] = ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(i));
+    }
+}
+
+/**
+ * @brief get cpu load of each core since `protocol_cpu_load_start`
+ *
+ * run time stats are counted by esp_timer in us, so load is the part of
+ * elapsed time not spent in the idle task
+ *
+ * @param load measurement started
+ * @param percent output, load of each core in percent
+ */
+void protocol_cpu_load_get(struct protocol_cpu_load *load, int *percent)
+{
+    int64_t elapsed = esp_timer_get_time() - load->time;
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        uint32_t idle = ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(i)) - load->idle[i];
+        percent[i] = elapsed > 0 ? 100 - (int) ((int64_t) idle * 100 / elapsed) : 0;
+        if (percent[i] < 0) {
+            percent[i] = 0;
+        }
+    }
+}
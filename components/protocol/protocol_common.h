@@ -9,6 +9,7 @@
 #ifndef __PROTOCOL_COMMON_H__
 #define __PROTOCOL_COMMON_H__
 
+#include "freertos/FreeRTOS.h"
 #include "misc/lv_color.h"
 #include <stdint.h>
 
@@ -19,10 +20,20 @@ struct protocol_pin {
     lv_color_t color;
 };
 
+/**
+ * @brief idle task run time of each core at the start of a measurement
+ */
+struct protocol_cpu_load {
+    int64_t time;
+    uint32_t idle[portNUM_PROCESSORS];
+};
+
 int protocol_get_io(int pin);
 int protocol_reset_pin(void);
 int protocol_set_pin(int pin, const char *name, lv_color_t color);
 int protocol_set_pin_by_io(int io, const char *name, lv_color_t color);
 lv_obj_t* protocol_create_pin_map(lv_obj_t *parent);
+void protocol_cpu_load_start(struct protocol_cpu_load *load);
+void protocol_cpu_load_get(struct protocol_cpu_load *load, int *percent);
 
 #endif /* __PROTOCOL_COMMON_H__ */
@@ -0,0 +1,232 @@
+/**
+ * @file protocol_decoder.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol frame decoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_decoder.h"
+
+#define SLIP_END        0xC0
+#define SLIP_ESC        0xDB
+#define SLIP_ESC_END    0xDC
+#define SLIP_ESC_ESC    0xDD
+
+#define MODBUS_MIN_FRAME 4
+#define MODBUS_FIXED_GAP 1750 /* us, for baudrate above 19200 */
+
+static const char *decoder_name[] = {
+    [PROTOCOL_DECODER_NONE] = "None",
+    [PROTOCOL_DECODER_LINE] = "Line",
+    [PROTOCOL_DECODER_SLIP] = "SLIP",
+    [PROTOCOL_DECODER_COBS] = "COBS",
+    [PROTOCOL_DECODER_MODBUS] = "Modbus RTU",
+};
+
+const char *protocol_decoder_name(int type)
+{
+    return type >= 0 && type < PROTOCOL_DECODER_NUM ? decoder_name[type] : "Unknown";
+}
+
+/**
+ * @brief init decoder
+ *
+ * @param decoder decoder
+ * @param type decoder type
+ * @param baudrate line baudrate, used for modbus frame gap, 11 bits per char
+ */
+void protocol_decoder_init(struct protocol_decoder *decoder, int type, uint32_t baudrate)
+{
+    memset(decoder, 0, sizeof(struct protocol_decoder));
+    decoder->type = type;
+    decoder->char_time = baudrate > 0 ? 11000000 / baudrate : 0;
+    decoder->gap = baudrate > 19200 ? MODBUS_FIXED_GAP : decoder->char_time * 7 / 2;
+}
+
+/**
+ * @brief modbus crc16, poly 0xA001 reflected, init 0xFFFF
+ */
+uint16_t protocol_decoder_crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static void protocol_decoder_emit(struct protocol_decoder *decoder, uint8_t flags,
+                                  protocol_decoder_cb_t cb, void *param)
+{
+    struct protocol_decoder_frame frame = {
+        .data = decoder->buffer,
+        .len = decoder->len,
+        .timestamp = decoder->start,
+        .flags = flags | (decoder->overflow ? PROTOCOL_DECODER_FLAG_OVERFLOW : 0),
+    };
+    if (cb) {
+        cb(param, &frame);
+    }
+    decoder->len = 0;
+    decoder->escape = false;
+    decoder->overflow = false;
+}
+
+static void protocol_decoder_push(struct protocol_decoder *decoder, uint8_t byte, int64_t timestamp)
+{
+    if (decoder->len == 0 && !decoder->overflow) {
+        decoder->start = timestamp;
+    }
+    if (decoder->len < PROTOCOL_DECODER_FRAME_SIZE) {
+        decoder->buffer[decoder->len++] = byte;
+    } else {
+        decoder->overflow = true;
+    }
+}
+
+/**
+ * @brief decode cobs in place, data is left untouched if invalid
+ *
+ * @return int decoded length, -1 on invalid code
+ */
+static int protocol_decoder_cobs(uint8_t *data, size_t len)
+{
+    size_t read = 0, write = 0;
+
+    for (read = 0; read < len; read += data[read]) {
+        if (data[read] == 0 || read + data[read] > len) {
+            return -1;
+        }
+    }
+    read = 0;
+    while (read < len) {
+        uint8_t code = data[read++];
+        for (int i = 1; i < code; i++) {
+            data[write++] = data[read++];
+        }
+        if (code != 0xFF && read < len) {
+            data[write++] = 0;
+        }
+    }
+    return write;
+}
+
+static void protocol_decoder_modbus_end(struct protocol_decoder *decoder,
+                                        protocol_decoder_cb_t cb, void *param)
+{
+    uint8_t flags = 0;
+    if (decoder->len < MODBUS_MIN_FRAME || decoder->overflow) {
+        flags = PROTOCOL_DECODER_FLAG_ERROR;
+    } else {
+        uint16_t crc = decoder->buffer[decoder->len - 2] | (decoder->buffer[decoder->len - 1] << 8);
+        if (protocol_decoder_crc16(decoder->buffer, decoder->len - 2) != crc) {
+            flags = PROTOCOL_DECODER_FLAG_ERROR;
+        }
+    }
+    protocol_decoder_emit(decoder, flags, cb, param);
+}
+
+/**
+ * @brief feed a received chunk
+ *
+ * @param decoder decoder
+ * @param data data
+ * @param len data length
+ * @param timestamp time the chunk is received, in us
+ * @param cb frame callback
+ * @param param callback param
+ */
+void protocol_decoder_feed(struct protocol_decoder *decoder, const uint8_t *data, size_t len,
+                           int64_t timestamp, protocol_decoder_cb_t cb, void *param)
+{
+    if (len == 0) {
+        return;
+    }
+    if (decoder->type == PROTOCOL_DECODER_MODBUS) {
+        int64_t received = timestamp;
+        /* the chunk started `len` chars before it was received */
+        timestamp -= (int64_t) len * decoder->char_time;
+        if ((decoder->len > 0 || decoder->overflow) && timestamp - decoder->last >= decoder->gap) {
+            protocol_decoder_modbus_end(decoder, cb, param);
+        }
+        decoder->last = received;
+    }
+    for (size_t i = 0; i < len; i++) {
+        uint8_t byte = data[i];
+        switch (decoder->type) {
+        case PROTOCOL_DECODER_LINE:
+            if (byte == '\n') {
+                if (decoder->len > 0 && decoder->buffer[decoder->len - 1] == '\r') {
+                    decoder->len--;
+                }
+                if (decoder->len > 0 || decoder->overflow) {
+                    protocol_decoder_emit(decoder, 0, cb, param);
+                }
+            } else {
+                protocol_decoder_push(decoder, byte, timestamp);
+            }
+            break;
+        case PROTOCOL_DECODER_SLIP:
+            if (byte == SLIP_END) {
+                if (decoder->len > 0 || decoder->overflow) {
+                    protocol_decoder_emit(decoder, decoder->escape ? PROTOCOL_DECODER_FLAG_ERROR : 0, cb, param);
+                }
+            } else if (decoder->escape) {
+                decoder->escape = false;
+                if (byte == SLIP_ESC_END) {
+                    protocol_decoder_push(decoder, SLIP_END, timestamp);
+                } else if (byte == SLIP_ESC_ESC) {
+                    protocol_decoder_push(decoder, SLIP_ESC, timestamp);
+                } else {
+                    protocol_decoder_emit(decoder, PROTOCOL_DECODER_FLAG_ERROR, cb, param);
+                }
+            } else if (byte == SLIP_ESC) {
+                decoder->escape = true;
+            } else {
+                protocol_decoder_push(decoder, byte, timestamp);
+            }
+            break;
+        case PROTOCOL_DECODER_COBS:
+            if (byte == 0) {
+                if (decoder->len > 0 || decoder->overflow) {
+                    int decoded = decoder->overflow ? -1 : protocol_decoder_cobs(decoder->buffer, decoder->len);
+                    if (decoded >= 0) {
+                        decoder->len = decoded;
+                    }
+                    protocol_decoder_emit(decoder, decoded < 0 ? PROTOCOL_DECODER_FLAG_ERROR : 0, cb, param);
+                }
+            } else {
+                protocol_decoder_push(decoder, byte, timestamp);
+            }
+            break;
+        case PROTOCOL_DECODER_MODBUS:
+            protocol_decoder_push(decoder, byte, timestamp);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief close a pending modbus frame once the line is idle for the frame gap,
+ *        call it periodically when no data is received
+ *
+ * @param decoder decoder
+ * @param now current time in us
+ * @param cb frame callback
+ * @param param callback param
+ */
+void protocol_decoder_poll(struct protocol_decoder *decoder, int64_t now,
+                           protocol_decoder_cb_t cb, void *param)
+{
+    if (decoder->type == PROTOCOL_DECODER_MODBUS
+        && (decoder->len > 0 || decoder->overflow) && now - decoder->last >= decoder->gap) {
+        protocol_decoder_modbus_end(decoder, cb, param);
+    }
+}
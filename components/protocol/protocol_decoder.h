@@ -0,0 +1,64 @@
+/**
+ * @file protocol_decoder.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol frame decoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_DECODER_H__
+#define __PROTOCOL_DECODER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_DECODER_NONE           0
+#define PROTOCOL_DECODER_LINE           1
+#define PROTOCOL_DECODER_SLIP           2
+#define PROTOCOL_DECODER_COBS           3
+#define PROTOCOL_DECODER_MODBUS         4
+#define PROTOCOL_DECODER_NUM            5
+
+#define PROTOCOL_DECODER_FRAME_SIZE     256
+
+#define PROTOCOL_DECODER_FLAG_ERROR     0x01 /* crc or framing error */
+#define PROTOCOL_DECODER_FLAG_OVERFLOW  0x02 /* frame truncated to the frame size */
+
+struct protocol_decoder_frame {
+    const uint8_t *data;
+    size_t len;
+    int64_t timestamp;
+    uint8_t flags;
+};
+
+/**
+ * @brief frame callback, frame data is only valid during the call
+ */
+typedef void (*protocol_decoder_cb_t)(void *param, const struct protocol_decoder_frame *frame);
+
+/**
+ * @brief incremental decoder, frames are reassembled across chunks in the
+ *        embedded buffer, no allocation is done after init
+ */
+struct protocol_decoder {
+    int type;
+    uint8_t buffer[PROTOCOL_DECODER_FRAME_SIZE];
+    size_t len;
+    bool escape;
+    bool overflow;
+    int64_t start;
+    int64_t last;
+    uint32_t char_time;
+    uint32_t gap;
+};
+
+void protocol_decoder_init(struct protocol_decoder *decoder, int type, uint32_t baudrate);
+void protocol_decoder_feed(struct protocol_decoder *decoder, const uint8_t *data, size_t len,
+                           int64_t timestamp, protocol_decoder_cb_t cb, void *param);
+void protocol_decoder_poll(struct protocol_decoder *decoder, int64_t now,
+                           protocol_decoder_cb_t cb, void *param);
+uint16_t protocol_decoder_crc16(const uint8_t *data, size_t len);
+const char *protocol_decoder_name(int type);
+
+#endif /* __PROTOCOL_DECODER_H__ */
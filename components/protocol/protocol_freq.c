@@ -0,0 +1,209 @@
+/**
+ * @file protocol_freq.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief frequency counter math
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * the gate method counts n edges in a gate time t, f = n / t with an error
+ * of one count, 1 / (f * t) relative. the reciprocal method timestamps edges
+ * with a clock of clk_hz, f = clk_hz * periods / ticks with an error of one
+ * tick over the measured periods, 1 / (clk_hz * t) relative but one edge
+ * interrupt per edge. both are equal at sqrt(clk_hz / t), the capture
+ * method is used below that
+ */
+#include <math.h>
+#include <stdio.h>
+#include "protocol_freq.h"
+
+/**
+ * @brief clear statistics
+ */
+void protocol_freq_stats_reset(struct protocol_freq_stats *stats)
+{
+    stats->count = 0;
+    stats->min = 0;
+    stats->max = 0;
+    stats->mean = 0;
+    stats->m2 = 0;
+}
+
+/**
+ * @brief add a sample to statistics
+ */
+void protocol_freq_stats_add(struct protocol_freq_stats *stats, double value)
+{
+    if (stats->count == 0 || value < stats->min) {
+        stats->min = value;
+    }
+    if (stats->count == 0 || value > stats->max) {
+        stats->max = value;
+    }
+    stats->count++;
+    double delta = value - stats->mean;
+    stats->mean += delta / stats->count;
+    stats->m2 += delta * (value - stats->mean);
+}
+
+/**
+ * @brief standard deviation of the samples, the jitter
+ */
+double protocol_freq_stats_stddev(const struct protocol_freq_stats *stats)
+{
+    return stats->count > 1 ? sqrt(stats->m2 / (stats->count - 1)) : 0;
+}
+
+/**
+ * @brief gate method frequency
+ *
+ * @param count edges counted
+ * @param time_us gate time, us
+ *
+ * @return double frequency, Hz
+ */
+double protocol_freq_gate(int64_t count, int64_t time_us)
+{
+    return time_us > 0 ? (double) count * 1000000.0 / (double) time_us : 0;
+}
+
+/**
+ * @brief init edge capture
+ *
+ * @param capture capture
+ * @param clk_hz timestamp clock
+ */
+void protocol_freq_capture_init(struct protocol_freq_capture *capture, uint32_t clk_hz)
+{
+    capture->clk_hz = clk_hz;
+    capture->periods = 0;
+    capture->period_sum = 0;
+    capture->high_sum = 0;
+    protocol_freq_capture_lost(capture);
+}
+
+/**
+ * @brief edges were dropped, wait for the next rising edge
+ */
+void protocol_freq_capture_lost(struct protocol_freq_capture *capture)
+{
+    capture->synced = false;
+    capture->fall_seen = false;
+}
+
+/**
+ * @brief feed one captured edge
+ *
+ * a period runs from a rising edge to the next one, the high time is taken
+ * from the falling edge in between, timestamps may wrap
+ *
+ * @param capture capture
+ * @param rising rising edge
+ * @param ticks timestamp
+ * @param period period of the completed cycle, ticks
+ *
+ * @return bool a period completed
+ */
+bool protocol_freq_capture_edge(struct protocol_freq_capture *capture, bool rising, uint32_t ticks,
+                                uint32_t *period)
+{
+    if (!rising) {
+        if (capture->synced && !capture->fall_seen) {
+            capture->high = ticks - capture->rise;
+            capture->fall_seen = true;
+        }
+        return false;
+    }
+    bool done = capture->synced && capture->fall_seen;
+    if (done) {
+        *period = ticks - capture->rise;
+        capture->periods++;
+        capture->period_sum += *period;
+        capture->high_sum += capture->high;
+    }
+    capture->rise = ticks;
+    capture->synced = true;
+    capture->fall_seen = false;
+    return done;
+}
+
+/**
+ * @brief average over the periods since the last result, sums are cleared
+ *
+ * @return bool a result is available
+ */
+bool protocol_freq_capture_result(struct protocol_freq_capture *capture, struct protocol_freq_result *result)
+{
+    if (capture->periods == 0 || capture->period_sum == 0) {
+        return false;
+    }
+    result->period = (double) capture->period_sum / capture->periods / capture->clk_hz;
+    result->freq = 1.0 / result->period;
+    result->width = (double) capture->high_sum / capture->periods / capture->clk_hz;
+    result->duty = (double) capture->high_sum / capture->period_sum;
+    capture->periods = 0;
+    capture->period_sum = 0;
+    capture->high_sum = 0;
+    return true;
+}
+
+/**
+ * @brief frequency where gate and reciprocal method have the same resolution
+ *
+ * @param clk_hz capture clock
+ * @param gate_us gate time, us
+ *
+ * @return uint32_t frequency, Hz
+ */
+uint32_t protocol_freq_crossover(uint32_t clk_hz, uint32_t gate_us)
+{
+    return gate_us ? (uint32_t) sqrt((double) clk_hz * 1000000.0 / gate_us) : 0;
+}
+
+/**
+ * @brief auto range, with hysteresis around the crossover
+ *
+ * @param mode current mode
+ * @param freq measured frequency, Hz
+ * @param crossover crossover frequency, Hz
+ *
+ * @return int mode to use
+ */
+int protocol_freq_select(int mode, double freq, uint32_t crossover)
+{
+    double margin = (double) crossover / PROTOCOL_FREQ_HYSTERESIS;
+    if (mode == PROTOCOL_FREQ_MODE_CAPTURE && freq > crossover + margin) {
+        return PROTOCOL_FREQ_MODE_GATE;
+    }
+    if (mode == PROTOCOL_FREQ_MODE_GATE && freq > 0 && freq < crossover - margin) {
+        return PROTOCOL_FREQ_MODE_CAPTURE;
+    }
+    return mode;
+}
+
+/**
+ * @brief format a frequency with the digits its resolution supports
+ *
+ * @param buf buffer
+ * @param size buffer size
+ * @param freq frequency, Hz
+ * @param resolution resolution, Hz
+ *
+ * @return size_t length
+ */
+size_t protocol_freq_format(char *buf, size_t size, double freq, double resolution)
+{
+    static const char *units[] = {"Hz", "kHz", "MHz"};
+    int unit = 0;
+    double scale = 1;
+    while (unit < 2 && freq >= scale * 1000) {
+        scale *= 1000;
+        unit++;
+    }
+    int digits = 0;
+    while (digits < 9 && resolution > 0 && resolution < scale / pow(10, digits) * 0.999) {
+        digits++;
+    }
+    int len = snprintf(buf, size, "%.*f %s", digits, freq / scale, units[unit]);
+    return len < 0 ? 0 : (size_t) len;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file protocol_freq.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief frequency counter math
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_FREQ_H__
+#define __PROTOCOL_FREQ_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_FREQ_MODE_GATE         0 /* count edges over a gate time */
+#define PROTOCOL_FREQ_MODE_CAPTURE      1 /* timestamp edges, reciprocal */
+
+#define PROTOCOL_FREQ_HYSTERESIS        4 /* switch at crossover +- 1/4 */
+
+/**
+ * @brief running statistics, welford
+ */
+struct protocol_freq_stats {
+    uint32_t count;
+    double min;
+    double max;
+    double mean;
+    double m2;
+};
+
+/**
+ * @brief edge capture state, timestamps are free running ticks of clk_hz
+ *
+ * sums cover the whole periods seen since the last result
+ */
+struct protocol_freq_capture {
+    uint32_t clk_hz;
+    bool synced;
+    bool fall_seen;
+    uint32_t rise;
+    uint32_t high;
+    uint32_t periods;
+    uint64_t period_sum;
+    uint64_t high_sum;
+};
+
+struct protocol_freq_result {
+    double freq;        /* Hz */
+    double period;      /* s */
+    double width;       /* high time, s */
+    double duty;        /* 0 - 1 */
+};
+
+void protocol_freq_stats_reset(struct protocol_freq_stats *stats);
+void protocol_freq_stats_add(struct protocol_freq_stats *stats, double value);
+double protocol_freq_stats_stddev(const struct protocol_freq_stats *stats);
+
+double protocol_freq_gate(int64_t count, int64_t time_us);
+
+void protocol_freq_capture_init(struct protocol_freq_capture *capture, uint32_t clk_hz);
+void protocol_freq_capture_lost(struct protocol_freq_capture *capture);
+bool protocol_freq_capture_edge(struct protocol_freq_capture *capture, bool rising, uint32_t ticks,
+                                uint32_t *period);
+bool protocol_freq_capture_result(struct protocol_freq_capture *capture, struct protocol_freq_result *result);
+
+uint32_t protocol_freq_crossover(uint32_t clk_hz, uint32_t gate_us);
+int protocol_freq_select(int mode, double freq, uint32_t crossover);
+size_t protocol_freq_format(char *buf, size_t size, double freq, double resolution);
+
+#endif /* __PROTOCOL_FREQ_H__ */
@@ -0,0 +1,238 @@
+/**
+ * @file protocol_i2c_script.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief i2c transaction script compiler
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * one statement per line or per `;`, `#` starts a comment:
+ *   w <addr> [byte ...]            start (repeated if the bus is held), write
+ *   r <addr> <len>                 start (repeated if the bus is held), read
+ *   p                              stop
+ *   d <ms>                         delay, stops the bus first
+ *   poll <addr> <reg> <mask> <value> [timeout ms]
+ *                                  read reg until (reg & mask) == value, a mask
+ *                                  above 0xff reads a 16 bit big endian reg
+ * the bus is stopped at the end of the script, a statement longer than the
+ * line size is an error rather than being cut, delays and poll timeouts are
+ * limited to 60 s
+ */
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "protocol_i2c_script.h"
+
+#define PROTOCOL_I2C_SCRIPT_MAX_ARGS    34
+#define PROTOCOL_I2C_SCRIPT_LINE_SIZE   256 /* fits a full write in 0x.. notation */
+#define PROTOCOL_I2C_POLL_TIMEOUT       100
+#define PROTOCOL_I2C_SCRIPT_TIME_MAX    60000 /* ms, delays and poll timeouts */
+
+struct protocol_i2c_compiler {
+    struct protocol_i2c_script *script;
+    bool held;
+};
+
+static struct protocol_i2c_op *protocol_i2c_script_emit(struct protocol_i2c_script *script, uint8_t type)
+{
+    if (script->op_num >= PROTOCOL_I2C_SCRIPT_MAX_OPS) {
+        return NULL;
+    }
+    struct protocol_i2c_op *op = &script->ops[script->op_num++];
+    memset(op, 0, sizeof(*op));
+    op->type = type;
+    return op;
+}
+
+static int protocol_i2c_script_stop(struct protocol_i2c_compiler *compiler)
+{
+    if (compiler->held) {
+        compiler->held = false;
+        return protocol_i2c_script_emit(compiler->script, PROTOCOL_I2C_OP_STOP) ? 0 : -1;
+    }
+    return 0;
+}
+
+static int protocol_i2c_script_address(struct protocol_i2c_compiler *compiler, uint32_t addr, bool read)
+{
+    struct protocol_i2c_script *script = compiler->script;
+    if (addr > 0x7F || script->data_len >= PROTOCOL_I2C_SCRIPT_DATA_SIZE
+        || !protocol_i2c_script_emit(script, PROTOCOL_I2C_OP_START)) {
+        return -1;
+    }
+    compiler->held = true;
+    struct protocol_i2c_op *op = protocol_i2c_script_emit(script, PROTOCOL_I2C_OP_WRITE);
+    if (!op) {
+        return -1;
+    }
+    op->addr = addr;
+    op->offset = script->data_len;
+    op->len = 1;
+    script->data[script->data_len++] = (addr << 1) | (read ? 1 : 0);
+    return 0;
+}
+
+static int protocol_i2c_script_statement(struct protocol_i2c_compiler *compiler, char **argv, int argc)
+{
+    struct protocol_i2c_script *script = compiler->script;
+    uint32_t args[PROTOCOL_I2C_SCRIPT_MAX_ARGS];
+    struct protocol_i2c_op *op;
+
+    for (int i = 1; i < argc; i++) {
+        char *end;
+        unsigned long value = strtoul(argv[i], &end, 0);
+        if (*end || value > UINT32_MAX) {
+            return -1;
+        }
+        args[i] = value;
+    }
+
+    if (strcmp(argv[0], "w") == 0 && argc >= 2) {
+        if (protocol_i2c_script_address(compiler, args[1], false) != 0) {
+            return -1;
+        }
+        op = &script->ops[script->op_num - 1];
+        for (int i = 2; i < argc; i++) {
+            if (args[i] > 0xFF || script->data_len >= PROTOCOL_I2C_SCRIPT_DATA_SIZE) {
+                return -1;
+            }
+            script->data[script->data_len++] = args[i];
+            op->len++;
+        }
+        return 0;
+    }
+    if (strcmp(argv[0], "r") == 0 && argc == 3) {
+        if (args[2] == 0 || args[2] > (uint32_t) (PROTOCOL_I2C_SCRIPT_READ_SIZE - script->read_len)
+            || protocol_i2c_script_address(compiler, args[1], true) != 0
+            || !(op = protocol_i2c_script_emit(script, PROTOCOL_I2C_OP_READ))) {
+            return -1;
+        }
+        op->addr = args[1];
+        op->offset = script->read_len;
+        op->len = args[2];
+        script->read_len += args[2];
+        return 0;
+    }
+    if (strcmp(argv[0], "p") == 0 && argc == 1) {
+        return protocol_i2c_script_stop(compiler);
+    }
+    if (strcmp(argv[0], "d") == 0 && argc == 2) {
+        if (args[1] > PROTOCOL_I2C_SCRIPT_TIME_MAX || protocol_i2c_script_stop(compiler) != 0
+            || !(op = protocol_i2c_script_emit(script, PROTOCOL_I2C_OP_DELAY))) {
+            return -1;
+        }
+        op->time = args[1];
+        return 0;
+    }
+    if (strcmp(argv[0], "poll") == 0 && (argc == 5 || argc == 6)) {
+        if (args[1] > 0x7F || args[2] > 0xFF || args[3] > 0xFFFF || args[4] > 0xFFFF
+            || (argc == 6 && args[5] > PROTOCOL_I2C_SCRIPT_TIME_MAX)
+            || protocol_i2c_script_stop(compiler) != 0
+            || !(op = protocol_i2c_script_emit(script, PROTOCOL_I2C_OP_POLL))) {
+            return -1;
+        }
+        op->addr = args[1];
+        op->reg = args[2];
+        op->width = args[3] > 0xFF ? 2 : 1;
+        op->mask = args[3];
+        op->expect = args[4];
+        op->time = argc == 6 ? args[5] : PROTOCOL_I2C_POLL_TIMEOUT;
+        return 0;
+    }
+    return -1;
+}
+
+/**
+ * @brief compile a script
+ *
+ * @param script script
+ * @param text script text, not required to be null terminated
+ * @param len text length
+ *
+ * @return int 0 on success, -1 on error with script->error_line set (1 based)
+ */
+int protocol_i2c_script_compile(struct protocol_i2c_script *script, const char *text, size_t len)
+{
+    struct protocol_i2c_compiler compiler = {.script = script};
+    char line[PROTOCOL_I2C_SCRIPT_LINE_SIZE];
+    int line_num = 1;
+
+    script->op_num = 0;
+    script->data_len = 0;
+    script->read_len = 0;
+    script->error_line = 0;
+
+    size_t pos = 0;
+    while (pos < len) {
+        size_t line_len = 0;
+        bool comment = false;
+        while (pos < len && text[pos] != '\n' && text[pos] != ';') {
+            if (text[pos] == '#') {
+                comment = true;
+            }
+            if (!comment) {
+                if (line_len >= sizeof(line) - 1) {
+                    script->error_line = line_num;
+                    return -1;
+                }
+                line[line_len++] = text[pos];
+            }
+            pos++;
+        }
+        line[line_len] = '\0';
+
+        char *argv[PROTOCOL_I2C_SCRIPT_MAX_ARGS];
+        int argc = 0;
+        char *p = line;
+        while (*p) {
+            while (isspace((unsigned char) *p)) {
+                *p++ = '\0';
+            }
+            if (!*p) {
+                break;
+            }
+            if (argc >= PROTOCOL_I2C_SCRIPT_MAX_ARGS) {
+                script->error_line = line_num;
+                return -1;
+            }
+            argv[argc++] = p;
+            while (*p && !isspace((unsigned char) *p)) {
+                p++;
+            }
+        }
+        if (argc > 0 && protocol_i2c_script_statement(&compiler, argv, argc) != 0) {
+            script->error_line = line_num;
+            return -1;
+        }
+        if (pos < len && text[pos] == '\n') {
+            line_num++;
+        }
+        pos++;
+    }
+    if (protocol_i2c_script_stop(&compiler) != 0) {
+        script->error_line = line_num;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief find the end of the command link segment starting at an op
+ *
+ * @param script script
+ * @param start first op of the segment
+ *
+ * @return size_t index after the last op of the segment, equals start for
+ *         delay and poll ops, which run on their own
+ */
+size_t protocol_i2c_script_segment_end(const struct protocol_i2c_script *script, size_t start)
+{
+    size_t end = start;
+    while (end < script->op_num
+           && script->ops[end].type != PROTOCOL_I2C_OP_DELAY
+           && script->ops[end].type != PROTOCOL_I2C_OP_POLL) {
+        end++;
+    }
+    return end;
+}
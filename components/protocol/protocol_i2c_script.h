@@ -0,0 +1,56 @@
+/**
+ * @file protocol_i2c_script.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief i2c transaction script compiler
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_I2C_SCRIPT_H__
+#define __PROTOCOL_I2C_SCRIPT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_I2C_SCRIPT_MAX_OPS     64
+#define PROTOCOL_I2C_SCRIPT_DATA_SIZE   256
+#define PROTOCOL_I2C_SCRIPT_READ_SIZE   256
+
+#define PROTOCOL_I2C_OP_START           0
+#define PROTOCOL_I2C_OP_WRITE           1 /* data[offset..offset+len), first byte is the address byte */
+#define PROTOCOL_I2C_OP_READ            2 /* len bytes into result[offset], last byte nacked */
+#define PROTOCOL_I2C_OP_STOP            3
+#define PROTOCOL_I2C_OP_DELAY           4 /* wait time ms */
+#define PROTOCOL_I2C_OP_POLL            5 /* read reg of addr until (value & mask) == expect or time ms */
+
+struct protocol_i2c_op {
+    uint8_t type;
+    uint8_t addr;
+    uint8_t reg;
+    uint8_t width;
+    uint16_t offset;
+    uint16_t len;
+    uint16_t mask;
+    uint16_t expect;
+    uint32_t time;
+};
+
+/**
+ * @brief compiled script
+ *
+ * start, write, read and stop ops between two delay/poll ops form one
+ * segment, which runs as a single driver command link
+ */
+struct protocol_i2c_script {
+    struct protocol_i2c_op ops[PROTOCOL_I2C_SCRIPT_MAX_OPS];
+    uint16_t op_num;
+    uint16_t data_len;
+    uint16_t read_len;
+    uint8_t data[PROTOCOL_I2C_SCRIPT_DATA_SIZE];
+    int error_line;
+};
+
+int protocol_i2c_script_compile(struct protocol_i2c_script *script, const char *text, size_t len);
+size_t protocol_i2c_script_segment_end(const struct protocol_i2c_script *script, size_t start);
+
+#endif /* __PROTOCOL_I2C_SCRIPT_H__ */
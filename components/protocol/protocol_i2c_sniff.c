@@ -0,0 +1,149 @@
+/**
+ * @file protocol_i2c_sniff.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief i2c edge stream decoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * start and stop are sda edges while scl is high, bits are sampled on the
+ * scl rising edge, sda changes while scl is low are ignored. the scl rise
+ * before a stop or repeated start is sampled as the first bit of a byte, a
+ * transfer ending on any other bit count is flagged as an error. when both lines
+ * change between two samples the scl edge wins, which is what the bus
+ * timing guarantees for data bits
+ */
+#include <string.h>
+#include "protocol_i2c_sniff.h"
+
+#define PROTOCOL_I2C_SNIFF_TIME_MASK    ((1UL << (32 - PROTOCOL_I2C_SNIFF_TIME_SHIFT)) - 1)
+
+/**
+ * @brief init decoder
+ *
+ * @param sniff decoder
+ * @param tick_hz edge time resolution, a multiple of 1 MHz
+ */
+void protocol_i2c_sniff_init(struct protocol_i2c_sniff *sniff, uint32_t tick_hz)
+{
+    memset(sniff, 0, sizeof(*sniff));
+    sniff->ticks_per_us = tick_hz / 1000000 ? tick_hz / 1000000 : 1;
+    sniff->levels = PROTOCOL_I2C_SNIFF_SDA | PROTOCOL_I2C_SNIFF_SCL;
+    sniff->frame.data = sniff->data;
+}
+
+/**
+ * @brief time of the last edge in us, on the time base of the edge ticks
+ */
+int64_t protocol_i2c_sniff_time(const struct protocol_i2c_sniff *sniff)
+{
+    return sniff->ticks / sniff->ticks_per_us;
+}
+
+static void protocol_i2c_sniff_emit(struct protocol_i2c_sniff *sniff, uint8_t flags,
+                                    protocol_i2c_sniff_cb_t cb, void *param)
+{
+    if (sniff->addressed) {
+        sniff->frame.flags |= flags;
+        sniff->frame.timestamp = sniff->start_ticks / sniff->ticks_per_us;
+        sniff->frame.duration = (sniff->ticks - sniff->start_ticks) / sniff->ticks_per_us;
+        if (cb) {
+            cb(param, &sniff->frame);
+        }
+    }
+    sniff->active = false;
+    sniff->addressed = false;
+}
+
+static void protocol_i2c_sniff_start(struct protocol_i2c_sniff *sniff)
+{
+    sniff->active = true;
+    sniff->addressed = false;
+    sniff->bit_num = 0;
+    sniff->byte = 0;
+    sniff->start_ticks = sniff->ticks;
+    sniff->frame.flags = 0;
+    sniff->frame.len = 0;
+    sniff->frame.data_nack = 0;
+}
+
+static void protocol_i2c_sniff_bit(struct protocol_i2c_sniff *sniff, uint8_t sda)
+{
+    if (sniff->bit_num < 8) {
+        sniff->byte = (sniff->byte << 1) | sda;
+        sniff->bit_num++;
+        return;
+    }
+    struct protocol_i2c_sniff_frame *frame = &sniff->frame;
+    sniff->bit_num = 0;
+    if (!sniff->addressed) {
+        sniff->addressed = true;
+        frame->addr = sniff->byte >> 1;
+        frame->read = sniff->byte & 1;
+        if (sda) {
+            frame->flags |= PROTOCOL_I2C_SNIFF_FLAG_NACK;
+        }
+    } else if (frame->len < PROTOCOL_I2C_SNIFF_DATA_SIZE) {
+        if (sda) {
+            frame->data_nack |= 1ULL << frame->len;
+        }
+        sniff->data[frame->len++] = sniff->byte;
+    } else {
+        frame->flags |= PROTOCOL_I2C_SNIFF_FLAG_OVERFLOW;
+    }
+    sniff->byte = 0;
+}
+
+/**
+ * @brief feed edge entries
+ *
+ * @param sniff decoder
+ * @param edges edge entries, see PROTOCOL_I2C_SNIFF_EDGE
+ * @param num entry count
+ * @param cb called for every complete transfer
+ * @param param callback param
+ */
+void protocol_i2c_sniff_feed(struct protocol_i2c_sniff *sniff, const uint32_t *edges, size_t num,
+                             protocol_i2c_sniff_cb_t cb, void *param)
+{
+    for (size_t i = 0; i < num; i++) {
+        uint32_t edge = edges[i];
+        uint32_t ticks = edge >> PROTOCOL_I2C_SNIFF_TIME_SHIFT;
+        uint8_t levels = edge & (PROTOCOL_I2C_SNIFF_SDA | PROTOCOL_I2C_SNIFF_SCL);
+        uint8_t prev = sniff->levels;
+
+        if (!sniff->started) {
+            sniff->started = true;
+            sniff->ticks = ticks;
+        } else {
+            sniff->ticks += (ticks - sniff->last_ticks) & PROTOCOL_I2C_SNIFF_TIME_MASK;
+        }
+        sniff->last_ticks = ticks;
+        sniff->levels = levels;
+
+        if (edge & PROTOCOL_I2C_SNIFF_GAP) {
+            if (sniff->active) {
+                protocol_i2c_sniff_emit(sniff, PROTOCOL_I2C_SNIFF_FLAG_ERROR, cb, param);
+            }
+            continue;
+        }
+
+        uint8_t changed = prev ^ levels;
+        if (changed & PROTOCOL_I2C_SNIFF_SCL) {
+            if ((levels & PROTOCOL_I2C_SNIFF_SCL) && sniff->active) {
+                protocol_i2c_sniff_bit(sniff, levels & PROTOCOL_I2C_SNIFF_SDA);
+            }
+        } else if ((changed & PROTOCOL_I2C_SNIFF_SDA) && (levels & PROTOCOL_I2C_SNIFF_SCL)) {
+            if (levels & PROTOCOL_I2C_SNIFF_SDA) {
+                if (sniff->active) {
+                    protocol_i2c_sniff_emit(sniff, sniff->bit_num != 1 ? PROTOCOL_I2C_SNIFF_FLAG_ERROR : 0, cb, param);
+                }
+            } else {
+                if (sniff->active) {
+                    protocol_i2c_sniff_emit(sniff, sniff->bit_num != 1 ? PROTOCOL_I2C_SNIFF_FLAG_ERROR : 0, cb, param);
+                }
+                protocol_i2c_sniff_start(sniff);
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file protocol_i2c_sniff.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief i2c edge stream decoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_I2C_SNIFF_H__
+#define __PROTOCOL_I2C_SNIFF_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * edge entry, one per change of the sampled lines:
+ * bit 0 sda level, bit 1 scl level, bit 2 gap (sampling was paused before
+ * this entry), bits 3..31 sample time in ticks, wrapping
+ */
+#define PROTOCOL_I2C_SNIFF_SDA          0x01
+#define PROTOCOL_I2C_SNIFF_SCL          0x02
+#define PROTOCOL_I2C_SNIFF_GAP          0x04
+#define PROTOCOL_I2C_SNIFF_TIME_SHIFT   3
+#define PROTOCOL_I2C_SNIFF_EDGE(_ticks, _levels) \
+    (((uint32_t) (_ticks) << PROTOCOL_I2C_SNIFF_TIME_SHIFT) | (_levels))
+
+#define PROTOCOL_I2C_SNIFF_DATA_SIZE    64 /* at most 64, one data_nack bit per byte */
+
+#define PROTOCOL_I2C_SNIFF_FLAG_NACK     0x01 /* address not acknowledged */
+#define PROTOCOL_I2C_SNIFF_FLAG_ERROR    0x02 /* no stop, or sampling gap inside the transfer */
+#define PROTOCOL_I2C_SNIFF_FLAG_OVERFLOW 0x04 /* data truncated to the data size */
+
+/**
+ * @brief one addressed transfer, from start to the next start or stop
+ */
+struct protocol_i2c_sniff_frame {
+    uint8_t addr;
+    bool read;
+    uint8_t flags;
+    const uint8_t *data;
+    size_t len;
+    uint64_t data_nack;         /* bit n set if data byte n was not acknowledged */
+    int64_t timestamp;          /* start condition, us */
+    int64_t duration;           /* us */
+};
+
+typedef void (*protocol_i2c_sniff_cb_t)(void *param, const struct protocol_i2c_sniff_frame *frame);
+
+struct protocol_i2c_sniff {
+    uint32_t ticks_per_us;
+    uint32_t last_ticks;
+    uint64_t ticks;
+    uint8_t levels;
+    bool started;
+    bool active;
+    uint8_t bit_num;
+    uint8_t byte;
+    bool addressed;
+    struct protocol_i2c_sniff_frame frame;
+    uint64_t start_ticks;
+    uint8_t data[PROTOCOL_I2C_SNIFF_DATA_SIZE];
+};
+
+void protocol_i2c_sniff_init(struct protocol_i2c_sniff *sniff, uint32_t tick_hz);
+void protocol_i2c_sniff_feed(struct protocol_i2c_sniff *sniff, const uint32_t *edges, size_t num,
+                             protocol_i2c_sniff_cb_t cb, void *param);
+int64_t protocol_i2c_sniff_time(const struct protocol_i2c_sniff *sniff);
+
+#endif /* __PROTOCOL_I2C_SNIFF_H__ */
@@ -0,0 +1,149 @@
+/**
+ * @file protocol_matcher.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol multi pattern matcher
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "protocol_matcher.h"
+
+/**
+ * @brief compile patterns to a matcher
+ *
+ * @param matcher matcher
+ * @param patterns patterns
+ * @param num pattern number
+ * @return int 0 on success, -1 on invalid patterns or no memory
+ */
+int protocol_matcher_compile(struct protocol_matcher *matcher,
+                             const struct protocol_matcher_pattern *patterns, size_t num)
+{
+    size_t total = 1;
+
+    memset(matcher, 0, sizeof(struct protocol_matcher));
+    if (num == 0 || num > PROTOCOL_MATCHER_MAX_PATTERNS) {
+        return -1;
+    }
+    matcher->class_num = 1;
+    for (size_t i = 0; i < num; i++) {
+        if (patterns[i].len == 0) {
+            return -1;
+        }
+        for (size_t j = 0; j < patterns[i].len; j++) {
+            uint8_t byte = patterns[i].data[j];
+            if (matcher->classes[byte] == 0) {
+                matcher->classes[byte] = matcher->class_num++;
+            }
+        }
+        total += patterns[i].len;
+    }
+    if (total > PROTOCOL_MATCHER_MAX_STATES) {
+        return -1;
+    }
+
+    size_t class_num = matcher->class_num;
+    uint16_t *table = calloc(total * class_num, sizeof(uint16_t));
+    uint32_t *output = calloc(total, sizeof(uint32_t));
+    uint16_t *fail = calloc(total, sizeof(uint16_t));
+    uint16_t *queue = calloc(total, sizeof(uint16_t));
+    if (!table || !output || !fail || !queue) {
+        free(table);
+        free(output);
+        free(fail);
+        free(queue);
+        return -1;
+    }
+
+    /* trie, 0 means no edge while building since no edge goes back to root */
+    size_t state_num = 1;
+    for (size_t i = 0; i < num; i++) {
+        size_t state = 0;
+        for (size_t j = 0; j < patterns[i].len; j++) {
+            uint16_t *next = &table[state * class_num + matcher->classes[patterns[i].data[j]]];
+            if (*next == 0) {
+                *next = state_num++;
+            }
+            state = *next;
+        }
+        output[state] |= 1UL << i;
+    }
+
+    /* breadth first, fill missing edges with the edges of the failure state */
+    size_t head = 0, tail = 0;
+    for (size_t c = 0; c < class_num; c++) {
+        if (table[c]) {
+            queue[tail++] = table[c];
+        }
+    }
+    while (head < tail) {
+        size_t state = queue[head++];
+        output[state] |= output[fail[state]];
+        for (size_t c = 0; c < class_num; c++) {
+            uint16_t *next = &table[state * class_num + c];
+            uint16_t fallback = table[fail[state] * class_num + c];
+            if (*next) {
+                fail[*next] = fallback;
+                queue[tail++] = *next;
+            } else {
+                *next = fallback;
+            }
+        }
+    }
+    free(fail);
+    free(queue);
+
+    matcher->state_num = state_num;
+    matcher->table = table;
+    matcher->output = output;
+    return 0;
+}
+
+void protocol_matcher_free(struct protocol_matcher *matcher)
+{
+    free(matcher->table);
+    free(matcher->output);
+    memset(matcher, 0, sizeof(struct protocol_matcher));
+}
+
+void protocol_matcher_reset(struct protocol_matcher *matcher)
+{
+    matcher->state = 0;
+}
+
+/**
+ * @brief feed a chunk of stream, matches spanning chunks are found as well
+ *
+ * @param matcher matcher
+ * @param data data
+ * @param len data length
+ * @param cb match callback, can be NULL
+ * @param param callback param
+ * @return size_t number of bytes where any pattern matched
+ */
+size_t protocol_matcher_feed(struct protocol_matcher *matcher, const uint8_t *data, size_t len,
+                             protocol_matcher_cb_t cb, void *param)
+{
+    const uint16_t *table = matcher->table;
+    const uint32_t *output = matcher->output;
+    size_t class_num = matcher->class_num;
+    size_t state = matcher->state;
+    size_t count = 0;
+
+    if (!table) {
+        return 0;
+    }
+    for (size_t i = 0; i < len; i++) {
+        state = table[state * class_num + matcher->classes[data[i]]];
+        if (output[state]) {
+            count++;
+            if (cb) {
+                cb(param, output[state], i);
+            }
+        }
+    }
+    matcher->state = state;
+    return count;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file protocol_matcher.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol multi pattern matcher
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_MATCHER_H__
+#define __PROTOCOL_MATCHER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_MATCHER_MAX_PATTERNS   32
+#define PROTOCOL_MATCHER_MAX_STATES     1024
+
+struct protocol_matcher_pattern {
+    const uint8_t *data;
+    size_t len;
+};
+
+/**
+ * @brief match callback
+ *
+ * @param param user param
+ * @param mask bit mask of patterns ending at this byte
+ * @param offset offset of the last matched byte in the fed chunk
+ */
+typedef void (*protocol_matcher_cb_t)(void *param, uint32_t mask, size_t offset);
+
+/**
+ * @brief aho-corasick automaton compiled to a dfa
+ *
+ * bytes not used by any pattern share one class, so the transition table is
+ * `state_num * class_num` entries, feeding costs one lookup per byte whatever
+ * the pattern number is
+ */
+struct protocol_matcher {
+    uint8_t classes[256];
+    uint16_t class_num;
+    uint16_t state_num;
+    uint16_t *table;
+    uint32_t *output;
+    uint16_t state;
+};
+
+int protocol_matcher_compile(struct protocol_matcher *matcher,
+                             const struct protocol_matcher_pattern *patterns, size_t num);
+void protocol_matcher_free(struct protocol_matcher *matcher);
+void protocol_matcher_reset(struct protocol_matcher *matcher);
+size_t protocol_matcher_feed(struct protocol_matcher *matcher, const uint8_t *data, size_t len,
+                             protocol_matcher_cb_t cb, void *param);
+
+#endif /* __PROTOCOL_MATCHER_H__ */
@@ -0,0 +1,70 @@
+/**
+ * @file protocol_prbs.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol prbs generator and checker
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "protocol_prbs.h"
+
+void protocol_prbs_init(struct protocol_prbs *prbs, uint32_t seed)
+{
+    prbs->state = seed & 0x7FFFFFFF;
+    if (prbs->state == 0) {
+        prbs->state = PROTOCOL_PRBS_DEFAULT_SEED;
+    }
+}
+
+static inline uint8_t protocol_prbs_next(struct protocol_prbs *prbs)
+{
+    uint32_t state = prbs->state;
+    /* 8 steps at once, the 8 new bits only depend on bits 20..30 of the current state */
+    uint32_t bits = ((state >> 23) ^ (state >> 20)) & 0xFF;
+    prbs->state = ((state << 8) | bits) & 0x7FFFFFFF;
+    return (uint8_t) bits;
+}
+
+/**
+ * @brief fill the buffer with the next bytes of the sequence
+ *
+ * @param prbs prbs
+ * @param data buffer
+ * @param len length
+ */
+void protocol_prbs_fill(struct protocol_prbs *prbs, uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        data[i] = protocol_prbs_next(prbs);
+    }
+}
+
+void protocol_prbs_result_init(struct protocol_prbs_result *result)
+{
+    result->bytes = 0;
+    result->bit_errors = 0;
+    result->first_error = -1;
+}
+
+/**
+ * @brief compare received data with the next bytes of the sequence
+ *
+ * @param prbs prbs, seeded the same as the generator
+ * @param data received data
+ * @param len length
+ * @param result accumulated result
+ */
+void protocol_prbs_check(struct protocol_prbs *prbs, const uint8_t *data, size_t len,
+                         struct protocol_prbs_result *result)
+{
+    for (size_t i = 0; i < len; i++) {
+        uint8_t diff = data[i] ^ protocol_prbs_next(prbs);
+        if (diff) {
+            if (result->first_error < 0) {
+                result->first_error = result->bytes + i;
+            }
+            result->bit_errors += __builtin_popcount(diff);
+        }
+    }
+    result->bytes += len;
+}
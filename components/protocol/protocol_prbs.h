@@ -0,0 +1,36 @@
+/**
+ * @file protocol_prbs.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol prbs generator and checker
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_PRBS_H__
+#define __PROTOCOL_PRBS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_PRBS_DEFAULT_SEED      0x7FFFFFFF
+
+/**
+ * @brief prbs31 (x^31 + x^28 + 1) sequence
+ */
+struct protocol_prbs {
+    uint32_t state;
+};
+
+struct protocol_prbs_result {
+    uint64_t bytes;
+    uint64_t bit_errors;
+    int64_t first_error; /* byte offset of the first mismatch, -1 if none */
+};
+
+void protocol_prbs_init(struct protocol_prbs *prbs, uint32_t seed);
+void protocol_prbs_fill(struct protocol_prbs *prbs, uint8_t *data, size_t len);
+void protocol_prbs_result_init(struct protocol_prbs_result *result);
+void protocol_prbs_check(struct protocol_prbs *prbs, const uint8_t *data, size_t len,
+                         struct protocol_prbs_result *result);
+
+#endif /* __PROTOCOL_PRBS_H__ */
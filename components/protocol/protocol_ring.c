@@ -0,0 +1,219 @@
+/**
+ * @file protocol_ring.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol capture ring
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_ring.h"
+
+#define RING_LOAD(_v) __atomic_load_n(&(_v), __ATOMIC_ACQUIRE)
+#define RING_STORE(_v, _n) __atomic_store_n(&(_v), (_n), __ATOMIC_RELEASE)
+
+int protocol_ring_init(struct protocol_ring *ring, uint8_t *buffer, size_t size,
+                       struct protocol_ring_chunk *chunks, size_t chunk_num)
+{
+    if (!ring || !buffer || !chunks
+        || size == 0 || (size & (size - 1)) != 0
+        || chunk_num == 0 || (chunk_num & (chunk_num - 1)) != 0) {
+        return -1;
+    }
+    ring->buffer = buffer;
+    ring->size = size;
+    ring->chunks = chunks;
+    ring->chunk_num = chunk_num;
+    protocol_ring_reset(ring);
+    return 0;
+}
+
+void protocol_ring_reset(struct protocol_ring *ring)
+{
+    ring->write = 0;
+    ring->read = 0;
+    ring->chunk_write = 0;
+    ring->chunk_read = 0;
+    ring->overrun = 0;
+}
+
+size_t protocol_ring_used(struct protocol_ring *ring)
+{
+    return RING_LOAD(ring->write) - RING_LOAD(ring->read);
+}
+
+size_t protocol_ring_free(struct protocol_ring *ring)
+{
+    return ring->size - protocol_ring_used(ring);
+}
+
+/**
+ * @brief get the contiguous writable area of the ring
+ *
+ * @param ring ring
+ * @param len in: wanted length, 0 for any; out: available length
+ * @return uint8_t* writable area, NULL if ring is full
+ */
+uint8_t *protocol_ring_reserve(struct protocol_ring *ring, size_t *len)
+{
+    size_t write = ring->write;
+    size_t space = ring->size - (write - RING_LOAD(ring->read));
+    size_t offset = write & (ring->size - 1);
+    size_t contiguous = ring->size - offset;
+
+    if (space > contiguous) {
+        space = contiguous;
+    }
+    if (*len != 0 && space > *len) {
+        space = *len;
+    }
+    *len = space;
+    return space > 0 ? ring->buffer + offset : NULL;
+}
+
+/**
+ * @brief publish data written to the reserved area as one chunk
+ *
+ * @param ring ring
+ * @param len data length
+ * @param timestamp chunk timestamp
+ * @return size_t committed length, 0 if no chunk slot left (data counted as overrun)
+ */
+size_t protocol_ring_commit(struct protocol_ring *ring, size_t len, int64_t timestamp)
+{
+    size_t chunk_write = ring->chunk_write;
+
+    if (len == 0) {
+        return 0;
+    }
+    if (chunk_write - RING_LOAD(ring->chunk_read) >= ring->chunk_num) {
+        ring->overrun += len;
+        return 0;
+    }
+    struct protocol_ring_chunk *chunk = &ring->chunks[chunk_write & (ring->chunk_num - 1)];
+    chunk->timestamp = timestamp;
+    chunk->length = len;
+    RING_STORE(ring->write, ring->write + len);
+    RING_STORE(ring->chunk_write, chunk_write + 1);
+    return len;
+}
+
+/**
+ * @brief copy data into the ring as one chunk, data not fit is counted as overrun
+ *
+ * @param ring ring
+ * @param data data
+ * @param len data length
+ * @param timestamp chunk timestamp
+ * @return size_t written length
+ */
+size_t protocol_ring_write(struct protocol_ring *ring, const uint8_t *data, size_t len, int64_t timestamp)
+{
+    size_t free_len = protocol_ring_free(ring);
+    size_t write_len = len > free_len ? free_len : len;
+    size_t offset = ring->write & (ring->size - 1);
+    size_t first = ring->size - offset;
+
+    if (ring->chunk_write - RING_LOAD(ring->chunk_read) >= ring->chunk_num) {
+        write_len = 0;
+    }
+    ring->overrun += len - write_len;
+    if (write_len == 0) {
+        return 0;
+    }
+    if (first > write_len) {
+        first = write_len;
+    }
+    memcpy(ring->buffer + offset, data, first);
+    memcpy(ring->buffer, data + first, write_len - first);
+    return protocol_ring_commit(ring, write_len, timestamp);
+}
+
+/**
+ * @brief count data that could not be stored as overrun
+ *
+ * @param ring ring
+ * @param len dropped length
+ */
+void protocol_ring_drop(struct protocol_ring *ring, size_t len)
+{
+    ring->overrun += len;
+}
+
+/**
+ * @brief get the contiguous readable area of the oldest chunk
+ *
+ * @param ring ring
+ * @param data readable area
+ * @param timestamp chunk timestamp
+ * @return size_t readable length, 0 if ring is empty
+ */
+size_t protocol_ring_peek(struct protocol_ring *ring, const uint8_t **data, int64_t *timestamp)
+{
+    size_t chunk_read = ring->chunk_read;
+
+    if (chunk_read == RING_LOAD(ring->chunk_write)) {
+        return 0;
+    }
+    struct protocol_ring_chunk *chunk = &ring->chunks[chunk_read & (ring->chunk_num - 1)];
+    size_t offset = ring->read & (ring->size - 1);
+    size_t len = ring->size - offset;
+    if (len > chunk->length) {
+        len = chunk->length;
+    }
+    *data = ring->buffer + offset;
+    if (timestamp) {
+        *timestamp = chunk->timestamp;
+    }
+    return len;
+}
+
+/**
+ * @brief release data returned by peek
+ *
+ * @param ring ring
+ * @param len released length
+ */
+void protocol_ring_consume(struct protocol_ring *ring, size_t len)
+{
+    while (len > 0 && ring->chunk_read != RING_LOAD(ring->chunk_write)) {
+        struct protocol_ring_chunk *chunk = &ring->chunks[ring->chunk_read & (ring->chunk_num - 1)];
+        size_t step = len > chunk->length ? chunk->length : len;
+        chunk->length -= step;
+        len -= step;
+        RING_STORE(ring->read, ring->read + step);
+        if (chunk->length == 0) {
+            RING_STORE(ring->chunk_read, ring->chunk_read + 1);
+        }
+    }
+}
+
+/**
+ * @brief copy data out of the oldest chunk, never crosses a chunk boundary
+ *
+ * @param ring ring
+ * @param data output buffer
+ * @param len buffer length
+ * @param timestamp chunk timestamp
+ * @return size_t read length
+ */
+size_t protocol_ring_read(struct protocol_ring *ring, uint8_t *data, size_t len, int64_t *timestamp)
+{
+    size_t total = 0;
+    const uint8_t *area;
+    size_t chunk_read = ring->chunk_read;
+
+    while (total < len && ring->chunk_read == chunk_read) {
+        size_t size = protocol_ring_peek(ring, &area, total == 0 ? timestamp : NULL);
+        if (size == 0) {
+            break;
+        }
+        if (size > len - total) {
+            size = len - total;
+        }
+        memcpy(data + total, area, size);
+        total += size;
+        protocol_ring_consume(ring, size);
+    }
+    return total;
+}
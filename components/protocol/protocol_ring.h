@@ -0,0 +1,56 @@
+/**
+ * @file protocol_ring.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol capture ring
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_RING_H__
+#define __PROTOCOL_RING_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief one received chunk, data is stored in the byte ring in order
+ */
+struct protocol_ring_chunk {
+    int64_t timestamp;
+    uint32_t length;
+};
+
+/**
+ * @brief single producer, single consumer byte ring with per chunk timestamps
+ *
+ * buffer size and chunk number must be power of 2, the producer only touches
+ * `write` and `chunk_write`, the consumer only touches `read` and `chunk_read`
+ */
+struct protocol_ring {
+    uint8_t *buffer;
+    size_t size;
+    struct protocol_ring_chunk *chunks;
+    size_t chunk_num;
+    size_t write;
+    size_t read;
+    size_t chunk_write;
+    size_t chunk_read;
+    size_t overrun;
+};
+
+int protocol_ring_init(struct protocol_ring *ring, uint8_t *buffer, size_t size,
+                       struct protocol_ring_chunk *chunks, size_t chunk_num);
+void protocol_ring_reset(struct protocol_ring *ring);
+size_t protocol_ring_used(struct protocol_ring *ring);
+size_t protocol_ring_free(struct protocol_ring *ring);
+
+uint8_t *protocol_ring_reserve(struct protocol_ring *ring, size_t *len);
+size_t protocol_ring_commit(struct protocol_ring *ring, size_t len, int64_t timestamp);
+size_t protocol_ring_write(struct protocol_ring *ring, const uint8_t *data, size_t len, int64_t timestamp);
+void protocol_ring_drop(struct protocol_ring *ring, size_t len);
+
+size_t protocol_ring_peek(struct protocol_ring *ring, const uint8_t **data, int64_t *timestamp);
+void protocol_ring_consume(struct protocol_ring *ring, size_t len);
+size_t protocol_ring_read(struct protocol_ring *ring, uint8_t *data, size_t len, int64_t *timestamp);
+
+#endif /* __PROTOCOL_RING_H__ */
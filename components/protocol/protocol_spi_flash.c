@@ -0,0 +1,364 @@
+/**
+ * @file protocol_spi_flash.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief spi nor flash command set
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_spi_flash.h"
+
+#define PROTOCOL_SPI_FLASH_SFDP_SIGNATURE   0x50444653 /* "SFDP" */
+#define PROTOCOL_SPI_FLASH_3B_LIMIT         (16 * 1024 * 1024)
+
+#define PROTOCOL_SPI_FLASH_PROGRAM_POLL_US  20
+#define PROTOCOL_SPI_FLASH_PROGRAM_TIMEOUT  1000000 /* us */
+#define PROTOCOL_SPI_FLASH_ERASE_POLL_US    1000
+#define PROTOCOL_SPI_FLASH_ERASE_TIMEOUT    5000000 /* us */
+
+static uint32_t protocol_spi_flash_le32(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static int protocol_spi_flash_cmd(struct protocol_spi_flash *flash, uint8_t cmd,
+                                  uint8_t *rx, size_t rx_len)
+{
+    struct protocol_spi_flash_op op = {
+        .cmd = cmd,
+        .rx = rx,
+        .rx_len = rx_len,
+    };
+    return flash->io.transfer(flash->io.ctx, &op) == 0 ? PROTOCOL_SPI_FLASH_OK : PROTOCOL_SPI_FLASH_ERR_IO;
+}
+
+static int protocol_spi_flash_sfdp(struct protocol_spi_flash *flash, uint32_t addr, uint8_t *data, size_t len)
+{
+    struct protocol_spi_flash_op op = {
+        .cmd = PROTOCOL_SPI_FLASH_CMD_SFDP,
+        .addr_bytes = 3,
+        .dummy_cycles = 8,
+        .addr = addr,
+        .rx = data,
+        .rx_len = len,
+    };
+    return flash->io.transfer(flash->io.ctx, &op) == 0 ? PROTOCOL_SPI_FLASH_OK : PROTOCOL_SPI_FLASH_ERR_IO;
+}
+
+/**
+ * @brief read size, erase opcode and address width from the basic parameter
+ *        table of jesd216
+ */
+static bool protocol_spi_flash_parse_sfdp(struct protocol_spi_flash *flash)
+{
+    uint8_t header[16];
+    uint8_t table[8];
+    if (protocol_spi_flash_sfdp(flash, 0, header, sizeof(header)) != PROTOCOL_SPI_FLASH_OK
+        || protocol_spi_flash_le32(header) != PROTOCOL_SPI_FLASH_SFDP_SIGNATURE
+        || header[8] != 0x00 || header[11] < 2) {
+        return false;
+    }
+    uint32_t pointer = header[12] | (header[13] << 8) | (header[14] << 16);
+    if (protocol_spi_flash_sfdp(flash, pointer, table, sizeof(table)) != PROTOCOL_SPI_FLASH_OK) {
+        return false;
+    }
+    uint32_t dword1 = protocol_spi_flash_le32(table);
+    uint32_t dword2 = protocol_spi_flash_le32(table + 4);
+    if (dword2 & 0x80000000) {
+        uint32_t shift = dword2 & 0x7FFFFFFF;
+        if (shift < 3 || shift > 34) {
+            return false;
+        }
+        flash->size = 1UL << (shift - 3);
+    } else {
+        flash->size = (dword2 >> 3) + 1;
+    }
+    flash->erase_cmd = (dword1 & 0x03) == 0x01 ? (dword1 >> 8) & 0xFF : PROTOCOL_SPI_FLASH_CMD_SE;
+    flash->addr_bytes = ((dword1 >> 17) & 0x03) == 0x00 ? 3 : 4;
+    return true;
+}
+
+/**
+ * @brief identify the flash by jedec id and sfdp, falls back to the capacity
+ *        byte of the jedec id if sfdp is not supported
+ *
+ * @param flash flash
+ * @param io bus access
+ *
+ * @return int PROTOCOL_SPI_FLASH_OK or an error
+ */
+int protocol_spi_flash_probe(struct protocol_spi_flash *flash, const struct protocol_spi_flash_io *io)
+{
+    uint8_t id[3];
+    memset(flash, 0, sizeof(*flash));
+    flash->io = *io;
+    if (protocol_spi_flash_cmd(flash, PROTOCOL_SPI_FLASH_CMD_JEDEC_ID, id, sizeof(id)) != PROTOCOL_SPI_FLASH_OK) {
+        return PROTOCOL_SPI_FLASH_ERR_IO;
+    }
+    flash->jedec_id = (id[0] << 16) | (id[1] << 8) | id[2];
+    if (flash->jedec_id == 0 || flash->jedec_id == 0xFFFFFF) {
+        return PROTOCOL_SPI_FLASH_ERR_NOT_FOUND;
+    }
+    flash->sfdp = protocol_spi_flash_parse_sfdp(flash);
+    if (!flash->sfdp) {
+        if (id[2] < 0x10 || id[2] > 0x1F) {
+            return PROTOCOL_SPI_FLASH_ERR_NOT_FOUND;
+        }
+        flash->size = 1UL << id[2];
+        flash->erase_cmd = PROTOCOL_SPI_FLASH_CMD_SE;
+        flash->addr_bytes = 3;
+    }
+    if (flash->size <= PROTOCOL_SPI_FLASH_3B_LIMIT) {
+        flash->addr_bytes = 3;
+    } else {
+        flash->addr_bytes = 4;
+    }
+    return PROTOCOL_SPI_FLASH_OK;
+}
+
+/**
+ * @brief build a read op, for callers queueing the transfer themselves
+ */
+void protocol_spi_flash_read_op(const struct protocol_spi_flash *flash, uint32_t addr,
+                                uint8_t *data, size_t len, struct protocol_spi_flash_op *op)
+{
+    memset(op, 0, sizeof(*op));
+    op->cmd = flash->addr_bytes == 4 ? PROTOCOL_SPI_FLASH_CMD_READ4 : PROTOCOL_SPI_FLASH_CMD_READ;
+    op->addr_bytes = flash->addr_bytes;
+    op->addr = addr;
+    op->rx = data;
+    op->rx_len = len;
+}
+
+int protocol_spi_flash_read(struct protocol_spi_flash *flash, uint32_t addr, uint8_t *data, size_t len)
+{
+    struct protocol_spi_flash_op op;
+    if (addr > flash->size || len > flash->size - addr) {
+        return PROTOCOL_SPI_FLASH_ERR_RANGE;
+    }
+    while (len > 0) {
+        size_t chunk = flash->io.max_transfer && len > flash->io.max_transfer ? flash->io.max_transfer : len;
+        protocol_spi_flash_read_op(flash, addr, data, chunk, &op);
+        if (flash->io.transfer(flash->io.ctx, &op) != 0) {
+            return PROTOCOL_SPI_FLASH_ERR_IO;
+        }
+        addr += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+    return PROTOCOL_SPI_FLASH_OK;
+}
+
+/**
+ * @brief poll wip until it clears, the timeout counts the time the delay
+ *        hook reports it really slept, which can be a whole rtos tick
+ */
+static int protocol_spi_flash_wait(struct protocol_spi_flash *flash, uint32_t poll_us, uint32_t timeout_us)
+{
+    uint8_t status;
+    for (uint32_t elapsed = 0; elapsed < timeout_us; ) {
+        if (protocol_spi_flash_cmd(flash, PROTOCOL_SPI_FLASH_CMD_RDSR, &status, 1) != PROTOCOL_SPI_FLASH_OK) {
+            return PROTOCOL_SPI_FLASH_ERR_IO;
+        }
+        if (!(status & PROTOCOL_SPI_FLASH_SR_WIP)) {
+            return PROTOCOL_SPI_FLASH_OK;
+        }
+        uint32_t waited = flash->io.delay ? flash->io.delay(flash->io.ctx, poll_us) : 0;
+        elapsed += waited > poll_us ? waited : poll_us;
+    }
+    return PROTOCOL_SPI_FLASH_ERR_TIMEOUT;
+}
+
+static int protocol_spi_flash_write_enable(struct protocol_spi_flash *flash)
+{
+    uint8_t status;
+    if (protocol_spi_flash_cmd(flash, PROTOCOL_SPI_FLASH_CMD_WREN, NULL, 0) != PROTOCOL_SPI_FLASH_OK
+        || protocol_spi_flash_cmd(flash, PROTOCOL_SPI_FLASH_CMD_RDSR, &status, 1) != PROTOCOL_SPI_FLASH_OK) {
+        return PROTOCOL_SPI_FLASH_ERR_IO;
+    }
+    return status & PROTOCOL_SPI_FLASH_SR_WEL ? PROTOCOL_SPI_FLASH_OK : PROTOCOL_SPI_FLASH_ERR_IO;
+}
+
+/**
+ * @brief start erasing the 4 KB sector containing addr, the caller may do
+ *        other work before protocol_spi_flash_erase_wait
+ */
+int protocol_spi_flash_erase_start(struct protocol_spi_flash *flash, uint32_t addr)
+{
+    if (addr >= flash->size) {
+        return PROTOCOL_SPI_FLASH_ERR_RANGE;
+    }
+    int ret = protocol_spi_flash_write_enable(flash);
+    if (ret != PROTOCOL_SPI_FLASH_OK) {
+        return ret;
+    }
+    struct protocol_spi_flash_op op = {
+        .cmd = flash->addr_bytes == 4 ? PROTOCOL_SPI_FLASH_CMD_SE4 : flash->erase_cmd,
+        .addr_bytes = flash->addr_bytes,
+        .addr = addr & ~(PROTOCOL_SPI_FLASH_SECTOR_SIZE - 1),
+    };
+    return flash->io.transfer(flash->io.ctx, &op) == 0 ? PROTOCOL_SPI_FLASH_OK : PROTOCOL_SPI_FLASH_ERR_IO;
+}
+
+int protocol_spi_flash_erase_wait(struct protocol_spi_flash *flash)
+{
+    return protocol_spi_flash_wait(flash, PROTOCOL_SPI_FLASH_ERASE_POLL_US, PROTOCOL_SPI_FLASH_ERASE_TIMEOUT);
+}
+
+int protocol_spi_flash_erase_sector(struct protocol_spi_flash *flash, uint32_t addr)
+{
+    int ret = protocol_spi_flash_erase_start(flash, addr);
+    return ret == PROTOCOL_SPI_FLASH_OK ? protocol_spi_flash_erase_wait(flash) : ret;
+}
+
+/**
+ * @brief program erased flash, split at page boundaries
+ */
+int protocol_spi_flash_program(struct protocol_spi_flash *flash, uint32_t addr, const uint8_t *data, size_t len)
+{
+    if (addr > flash->size || len > flash->size - addr) {
+        return PROTOCOL_SPI_FLASH_ERR_RANGE;
+    }
+    while (len > 0) {
+        size_t chunk = PROTOCOL_SPI_FLASH_PAGE_SIZE - (addr & (PROTOCOL_SPI_FLASH_PAGE_SIZE - 1));
+        if (chunk > len) {
+            chunk = len;
+        }
+        int ret = protocol_spi_flash_write_enable(flash);
+        if (ret != PROTOCOL_SPI_FLASH_OK) {
+            return ret;
+        }
+        struct protocol_spi_flash_op op = {
+            .cmd = flash->addr_bytes == 4 ? PROTOCOL_SPI_FLASH_CMD_PP4 : PROTOCOL_SPI_FLASH_CMD_PP,
+            .addr_bytes = flash->addr_bytes,
+            .addr = addr,
+            .tx = data,
+            .tx_len = chunk,
+        };
+        if (flash->io.transfer(flash->io.ctx, &op) != 0) {
+            return PROTOCOL_SPI_FLASH_ERR_IO;
+        }
+        ret = protocol_spi_flash_wait(flash, PROTOCOL_SPI_FLASH_PROGRAM_POLL_US, PROTOCOL_SPI_FLASH_PROGRAM_TIMEOUT);
+        if (ret != PROTOCOL_SPI_FLASH_OK) {
+            return ret;
+        }
+        addr += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+    return PROTOCOL_SPI_FLASH_OK;
+}
+
+void protocol_spi_flash_sim_init(struct protocol_spi_flash_sim *sim, uint8_t *memory, uint32_t size,
+                                 uint32_t jedec_id)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->memory = memory;
+    sim->size = size;
+    sim->jedec_id = jedec_id;
+    sim->busy_polls = 3;
+    memset(memory, 0xFF, size);
+}
+
+static uint8_t protocol_spi_flash_sim_sfdp(const struct protocol_spi_flash_sim *sim, uint32_t addr)
+{
+    uint32_t dword1 = 0x01 | (PROTOCOL_SPI_FLASH_CMD_SE << 8)
+                      | (sim->size > PROTOCOL_SPI_FLASH_3B_LIMIT ? 0x01 << 17 : 0);
+    uint32_t dword2 = sim->size * 8 - 1;
+    static const uint8_t header[] = {
+        'S', 'F', 'D', 'P', 0x06, 0x01, 0x00, 0xFF,
+        0x00, 0x06, 0x01, 0x10, 0x30, 0x00, 0x00, 0xFF,
+    };
+    if (addr < sizeof(header)) {
+        return header[addr];
+    }
+    if (addr >= 0x30 && addr < 0x34) {
+        return dword1 >> ((addr - 0x30) * 8);
+    }
+    if (addr >= 0x34 && addr < 0x38) {
+        return dword2 >> ((addr - 0x34) * 8);
+    }
+    return 0xFF;
+}
+
+/**
+ * @brief transfer of the simulated device, same contract as a bus transfer
+ */
+int protocol_spi_flash_sim_transfer(void *ctx, const struct protocol_spi_flash_op *op)
+{
+    struct protocol_spi_flash_sim *sim = ctx;
+    uint32_t addr = op->addr_bytes == 3 ? op->addr & 0xFFFFFF : op->addr;
+    sim->ops++;
+
+    if (sim->busy && op->cmd != PROTOCOL_SPI_FLASH_CMD_RDSR) {
+        return 0;
+    }
+    switch (op->cmd) {
+    case PROTOCOL_SPI_FLASH_CMD_JEDEC_ID:
+        for (size_t i = 0; i < op->rx_len; i++) {
+            op->rx[i] = i < 3 ? sim->jedec_id >> (16 - i * 8) : 0xFF;
+        }
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_RDSR:
+        for (size_t i = 0; i < op->rx_len; i++) {
+            op->rx[i] = sim->status | (sim->busy ? PROTOCOL_SPI_FLASH_SR_WIP : 0);
+        }
+        if (sim->busy) {
+            sim->busy--;
+        }
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_WREN:
+        sim->status |= PROTOCOL_SPI_FLASH_SR_WEL;
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_WRDI:
+        sim->status &= ~PROTOCOL_SPI_FLASH_SR_WEL;
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_SFDP:
+        for (size_t i = 0; i < op->rx_len; i++) {
+            op->rx[i] = protocol_spi_flash_sim_sfdp(sim, addr + i);
+        }
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_READ:
+    case PROTOCOL_SPI_FLASH_CMD_READ4:
+    case PROTOCOL_SPI_FLASH_CMD_FAST_READ:
+    case PROTOCOL_SPI_FLASH_CMD_FAST_READ4:
+        for (size_t i = 0; i < op->rx_len; i++) {
+            op->rx[i] = sim->memory[(addr + i) % sim->size];
+        }
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_PP:
+    case PROTOCOL_SPI_FLASH_CMD_PP4:
+        if (!(sim->status & PROTOCOL_SPI_FLASH_SR_WEL) || addr >= sim->size) {
+            break;
+        }
+        for (size_t i = 0; i < op->tx_len; i++) {
+            uint32_t offset = (addr & ~(PROTOCOL_SPI_FLASH_PAGE_SIZE - 1))
+                              | ((addr + i) & (PROTOCOL_SPI_FLASH_PAGE_SIZE - 1));
+            sim->memory[offset] &= op->tx[i];
+        }
+        sim->status &= ~PROTOCOL_SPI_FLASH_SR_WEL;
+        sim->busy = sim->busy_polls;
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_SE:
+    case PROTOCOL_SPI_FLASH_CMD_SE4:
+        if (!(sim->status & PROTOCOL_SPI_FLASH_SR_WEL) || addr >= sim->size) {
+            break;
+        }
+        memset(&sim->memory[addr & ~(PROTOCOL_SPI_FLASH_SECTOR_SIZE - 1)], 0xFF, PROTOCOL_SPI_FLASH_SECTOR_SIZE);
+        sim->status &= ~PROTOCOL_SPI_FLASH_SR_WEL;
+        sim->busy = sim->busy_polls;
+        break;
+    case PROTOCOL_SPI_FLASH_CMD_CE:
+        if (!(sim->status & PROTOCOL_SPI_FLASH_SR_WEL)) {
+            break;
+        }
+        memset(sim->memory, 0xFF, sim->size);
+        sim->status &= ~PROTOCOL_SPI_FLASH_SR_WEL;
+        sim->busy = sim->busy_polls;
+        break;
+    default:
+        break;
+    }
+    return 0;
+}
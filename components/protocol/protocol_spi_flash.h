@@ -0,0 +1,106 @@
+/**
+ * @file protocol_spi_flash.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief spi nor flash command set
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_SPI_FLASH_H__
+#define __PROTOCOL_SPI_FLASH_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROTOCOL_SPI_FLASH_CMD_WRSR         0x01
+#define PROTOCOL_SPI_FLASH_CMD_PP           0x02
+#define PROTOCOL_SPI_FLASH_CMD_READ         0x03
+#define PROTOCOL_SPI_FLASH_CMD_WRDI         0x04
+#define PROTOCOL_SPI_FLASH_CMD_RDSR         0x05
+#define PROTOCOL_SPI_FLASH_CMD_WREN         0x06
+#define PROTOCOL_SPI_FLASH_CMD_FAST_READ    0x0B
+#define PROTOCOL_SPI_FLASH_CMD_FAST_READ4   0x0C
+#define PROTOCOL_SPI_FLASH_CMD_PP4          0x12
+#define PROTOCOL_SPI_FLASH_CMD_READ4        0x13
+#define PROTOCOL_SPI_FLASH_CMD_SE           0x20
+#define PROTOCOL_SPI_FLASH_CMD_SE4          0x21
+#define PROTOCOL_SPI_FLASH_CMD_SFDP         0x5A
+#define PROTOCOL_SPI_FLASH_CMD_JEDEC_ID     0x9F
+#define PROTOCOL_SPI_FLASH_CMD_CE           0xC7
+
+#define PROTOCOL_SPI_FLASH_SR_WIP           0x01
+#define PROTOCOL_SPI_FLASH_SR_WEL           0x02
+
+#define PROTOCOL_SPI_FLASH_PAGE_SIZE        256
+#define PROTOCOL_SPI_FLASH_SECTOR_SIZE      4096
+
+#define PROTOCOL_SPI_FLASH_OK               0
+#define PROTOCOL_SPI_FLASH_ERR_IO           -1
+#define PROTOCOL_SPI_FLASH_ERR_TIMEOUT      -2
+#define PROTOCOL_SPI_FLASH_ERR_NOT_FOUND    -3
+#define PROTOCOL_SPI_FLASH_ERR_RANGE        -4
+
+/**
+ * @brief one flash command: opcode, optional address, dummy cycles, then
+ *        either tx data or rx data. data reads use the plain read opcodes
+ *        without dummy cycles, only sfdp needs them
+ */
+struct protocol_spi_flash_op {
+    uint8_t cmd;
+    uint8_t addr_bytes;
+    uint8_t dummy_cycles;
+    uint32_t addr;
+    const uint8_t *tx;
+    size_t tx_len;
+    uint8_t *rx;
+    size_t rx_len;
+};
+
+/**
+ * @brief bus access, a spi transaction on the target or a simulated device
+ */
+struct protocol_spi_flash_io {
+    int (*transfer)(void *ctx, const struct protocol_spi_flash_op *op);
+    uint32_t (*delay)(void *ctx, uint32_t us);   /* returns the us really waited */
+    void *ctx;
+    size_t max_transfer;    /* max data bytes of one op, 0 for no limit */
+};
+
+struct protocol_spi_flash {
+    struct protocol_spi_flash_io io;
+    uint32_t jedec_id;
+    uint32_t size;
+    uint8_t addr_bytes;
+    uint8_t erase_cmd;
+    bool sfdp;
+};
+
+int protocol_spi_flash_probe(struct protocol_spi_flash *flash, const struct protocol_spi_flash_io *io);
+void protocol_spi_flash_read_op(const struct protocol_spi_flash *flash, uint32_t addr,
+                                uint8_t *data, size_t len, struct protocol_spi_flash_op *op);
+int protocol_spi_flash_read(struct protocol_spi_flash *flash, uint32_t addr, uint8_t *data, size_t len);
+int protocol_spi_flash_erase_start(struct protocol_spi_flash *flash, uint32_t addr);
+int protocol_spi_flash_erase_wait(struct protocol_spi_flash *flash);
+int protocol_spi_flash_erase_sector(struct protocol_spi_flash *flash, uint32_t addr);
+int protocol_spi_flash_program(struct protocol_spi_flash *flash, uint32_t addr, const uint8_t *data, size_t len);
+
+/**
+ * @brief simulated flash device, a memory array answering the command set
+ *        above with sfdp, status polling and nor write semantics
+ */
+struct protocol_spi_flash_sim {
+    uint8_t *memory;
+    uint32_t size;
+    uint32_t jedec_id;
+    uint8_t status;
+    uint32_t busy_polls;    /* status reads with wip set after program/erase */
+    uint32_t busy;
+    uint32_t ops;
+};
+
+void protocol_spi_flash_sim_init(struct protocol_spi_flash_sim *sim, uint8_t *memory, uint32_t size,
+                                 uint32_t jedec_id);
+int protocol_spi_flash_sim_transfer(void *ctx, const struct protocol_spi_flash_op *op);
+
+#endif /* __PROTOCOL_SPI_FLASH_H__ */
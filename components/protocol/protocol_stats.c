@@ -0,0 +1,111 @@
+/**
+ * @file protocol_stats.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol statistics
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "string.h"
+#include "protocol_stats.h"
+
+uint32_t protocol_stats_counter[PROTOCOL_STATS_SOURCE_NUM][PROTOCOL_STATS_COUNTER_NUM] = {0};
+
+struct protocol_stats_publisher {
+    protocol_stats_publish_t publish;
+    bool dirty;
+    struct protocol_stats_snapshot last;
+};
+
+static struct protocol_stats_publisher publishers[PROTOCOL_STATS_SOURCE_NUM] = {0};
+static lv_timer_t *stats_timer = NULL;
+static int64_t last_time = 0;
+
+void protocol_stats_reset(int source)
+{
+    for (int i = 0; i < PROTOCOL_STATS_COUNTER_NUM; i++) {
+        __atomic_store_n(&protocol_stats_counter[source][i], 0, __ATOMIC_RELAXED);
+    }
+    protocol_stats_invalidate(source);
+}
+
+/**
+ * @brief set the callback formatting one source, called in gui context
+ *
+ * @param source stats source
+ * @param publish publish callback
+ */
+void protocol_stats_register(int source, protocol_stats_publish_t publish)
+{
+    publishers[source].publish = publish;
+    publishers[source].dirty = true;
+}
+
+/**
+ * @brief request a publish on next period even if no counter changed,
+ *        for settings shown along with the counters
+ *
+ * @param source stats source
+ */
+void protocol_stats_invalidate(int source)
+{
+    __atomic_store_n(&publishers[source].dirty, true, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief publish all sources, runs in the lvgl timer handler so the gui lock
+ *        is already held, and sources without change are not redrawn
+ */
+static void protocol_stats_timer_cb(lv_timer_t *timer)
+{
+    int64_t now = esp_timer_get_time();
+    int64_t elapsed = now - last_time;
+    last_time = now;
+
+    for (int source = 0; source < PROTOCOL_STATS_SOURCE_NUM; source++) {
+        struct protocol_stats_publisher *publisher = &publishers[source];
+        struct protocol_stats_snapshot snapshot;
+        for (int i = 0; i < PROTOCOL_STATS_COUNTER_NUM; i++) {
+            snapshot.total[i] = protocol_stats_get(source, i);
+            snapshot.rate[i] = elapsed > 0
+                ? (uint32_t) ((uint64_t) (snapshot.total[i] - publisher->last.total[i]) * 1000000 / elapsed)
+                : 0;
+        }
+        bool dirty = __atomic_exchange_n(&publisher->dirty, false, __ATOMIC_RELAXED);
+        if (publisher->publish && (dirty || memcmp(&snapshot, &publisher->last, sizeof(snapshot)) != 0)) {
+            publisher->publish(&snapshot);
+        }
+        publisher->last = snapshot;
+    }
+}
+
+/**
+ * @brief start the publisher, called in gui context
+ */
+void protocol_stats_start(void)
+{
+    if (stats_timer) {
+        return;
+    }
+    last_time = esp_timer_get_time();
+    for (int source = 0; source < PROTOCOL_STATS_SOURCE_NUM; source++) {
+        for (int i = 0; i < PROTOCOL_STATS_COUNTER_NUM; i++) {
+            publishers[source].last.total[i] = protocol_stats_get(source, i);
+        }
+        publishers[source].dirty = true;
+    }
+    stats_timer = lv_timer_create(protocol_stats_timer_cb, PROTOCOL_STATS_PERIOD, NULL);
+}
+
+/**
+ * @brief stop the publisher, called in gui context
+ */
+void protocol_stats_stop(void)
+{
+    if (stats_timer) {
+        lv_timer_delete(stats_timer);
+        stats_timer = NULL;
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file protocol_stats.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief protocol statistics
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_STATS_H__
+#define __PROTOCOL_STATS_H__
+
+#include <stdint.h>
+
+#define PROTOCOL_STATS_PERIOD           200 /* ms */
+
+#define PROTOCOL_STATS_SOURCE_UART      0
+#define PROTOCOL_STATS_SOURCE_I2C       1
+#define PROTOCOL_STATS_SOURCE_SPI       2
+#define PROTOCOL_STATS_SOURCE_NUM       3
+
+#define PROTOCOL_STATS_TX               0
+#define PROTOCOL_STATS_RX               1
+#define PROTOCOL_STATS_FRAMES           2
+#define PROTOCOL_STATS_ERRORS           3
+#define PROTOCOL_STATS_OVERRUN          4
+#define PROTOCOL_STATS_COUNTER_NUM      5
+
+/**
+ * @brief counters seen by the publisher, rate is per second over the last period
+ */
+struct protocol_stats_snapshot {
+    uint32_t total[PROTOCOL_STATS_COUNTER_NUM];
+    uint32_t rate[PROTOCOL_STATS_COUNTER_NUM];
+};
+
+typedef void (*protocol_stats_publish_t)(const struct protocol_stats_snapshot *snapshot);
+
+extern uint32_t protocol_stats_counter[PROTOCOL_STATS_SOURCE_NUM][PROTOCOL_STATS_COUNTER_NUM];
+
+/**
+ * @brief bump a counter, safe from any task, no lock taken
+ *
+ * @param source stats source
+ * @param counter counter
+ * @param value value to add
+ */
+static inline void protocol_stats_add(int source, int counter, uint32_t value)
+{
+    __atomic_fetch_add(&protocol_stats_counter[source][counter], value, __ATOMIC_RELAXED);
+}
+
+static inline uint32_t protocol_stats_get(int source, int counter)
+{
+    return __atomic_load_n(&protocol_stats_counter[source][counter], __ATOMIC_RELAXED);
+}
+
+void protocol_stats_reset(int source);
+void protocol_stats_register(int source, protocol_stats_publish_t publish);
+void protocol_stats_invalidate(int source);
+void protocol_stats_start(void);
+void protocol_stats_stop(void);
+
+#endif /* __PROTOCOL_STATS_H__ */
@@ -0,0 +1,217 @@
+/**
+ * @file protocol_uart_sniff.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief uart decoder for rmt symbol streams
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * a block is one rmt receive, starting at an edge after idle and ending
+ * with the line idle high, bits are sampled in the middle of each bit time
+ * counted from the falling edge of the start bit
+ */
+#include "string.h"
+#include "protocol_uart_sniff.h"
+
+/**
+ * @brief walks the level runs of a block, times in ticks, 8 bit fraction
+ */
+struct uart_sniff_cursor {
+    const uint32_t *symbols;
+    size_t num;
+    size_t index;
+    int64_t start;
+    int64_t end;
+    uint8_t level;
+    bool done;
+};
+
+static void protocol_uart_sniff_cursor_load(struct uart_sniff_cursor *cursor)
+{
+    uint16_t half = 0;
+    if (cursor->index < cursor->num * 2) {
+        uint32_t symbol = cursor->symbols[cursor->index / 2];
+        half = (cursor->index & 1) ? symbol >> 16 : symbol & 0xFFFF;
+    }
+    if ((half & 0x7FFF) == 0) {
+        cursor->done = true;
+        cursor->level = 1;
+        cursor->end = INT64_MAX;
+    } else {
+        cursor->level = half >> 15;
+        cursor->end = cursor->start + ((int64_t) (half & 0x7FFF) << 8);
+    }
+}
+
+static void protocol_uart_sniff_cursor_next(struct uart_sniff_cursor *cursor)
+{
+    if (!cursor->done) {
+        cursor->start = cursor->end;
+        cursor->index++;
+        protocol_uart_sniff_cursor_load(cursor);
+    }
+}
+
+static uint8_t protocol_uart_sniff_level_at(struct uart_sniff_cursor *cursor, int64_t time)
+{
+    while (cursor->end <= time) {
+        protocol_uart_sniff_cursor_next(cursor);
+    }
+    return cursor->level;
+}
+
+/**
+ * @brief init decoder
+ *
+ * @param sniff decoder
+ * @param channel channel number copied to the decoded bytes
+ * @param tick_hz symbol duration resolution
+ * @param baudrate baudrate
+ * @param parity PROTOCOL_UART_SNIFF_PARITY_xxx, 8 data bits and 1 stop bit
+ */
+void protocol_uart_sniff_init(struct protocol_uart_sniff *sniff, uint8_t channel,
+                              uint32_t tick_hz, uint32_t baudrate, uint8_t parity)
+{
+    memset(sniff, 0, sizeof(*sniff));
+    sniff->tick_hz = tick_hz;
+    sniff->baudrate = baudrate;
+    sniff->bit_q8 = (uint32_t) (((uint64_t) tick_hz * 256 + baudrate / 2) / baudrate);
+    sniff->parity = parity;
+    sniff->channel = channel;
+}
+
+/**
+ * @brief decode one block
+ *
+ * @param sniff decoder
+ * @param symbols symbol words
+ * @param num symbol number
+ * @param timestamp time of the first edge of the block, us
+ * @param cb called for each byte
+ * @param param callback param
+ *
+ * @return size_t decoded bytes
+ */
+size_t protocol_uart_sniff_decode(struct protocol_uart_sniff *sniff, const uint32_t *symbols, size_t num,
+                                  int64_t timestamp, protocol_uart_sniff_cb_t cb, void *param)
+{
+    struct uart_sniff_cursor cursor = {.symbols = symbols, .num = num};
+    int64_t bit = sniff->bit_q8;
+    int bits = 8 + (sniff->parity != PROTOCOL_UART_SNIFF_PARITY_NONE) + 1;
+    int64_t search = -1;
+    size_t count = 0;
+
+    protocol_uart_sniff_cursor_load(&cursor);
+    while (!cursor.done) {
+        /* the line is taken as idle high before the block */
+        protocol_uart_sniff_level_at(&cursor, search < 0 ? 0 : search);
+        if (search >= 0 || cursor.level != 0) {
+            do {
+                protocol_uart_sniff_cursor_next(&cursor);
+            } while (!cursor.done && cursor.level != 0);
+        }
+        if (cursor.done) {
+            break;
+        }
+        int64_t start = cursor.start;
+        if (protocol_uart_sniff_level_at(&cursor, start + bit / 2) != 0) {
+            search = start + bit / 2;
+            continue;
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < bits; i++) {
+            value |= (uint32_t) protocol_uart_sniff_level_at(&cursor, start + bit * (i + 1) + bit / 2) << i;
+        }
+        search = start + bit * bits + bit / 2;
+
+        struct protocol_uart_sniff_byte byte = {
+            .timestamp = timestamp + start * 1000000 / ((int64_t) sniff->tick_hz << 8),
+            .channel = sniff->channel,
+            .data = value & 0xFF,
+        };
+        if (sniff->parity != PROTOCOL_UART_SNIFF_PARITY_NONE) {
+            uint32_t ones = __builtin_popcount(value & 0x1FF);
+            if ((ones & 1) != (sniff->parity == PROTOCOL_UART_SNIFF_PARITY_ODD)) {
+                byte.flags |= PROTOCOL_UART_SNIFF_FLAG_PARITY;
+            }
+        }
+        if (!(value >> (bits - 1))) {
+            byte.flags |= value == 0 ? PROTOCOL_UART_SNIFF_FLAG_BREAK | PROTOCOL_UART_SNIFF_FLAG_FRAMING
+                                     : PROTOCOL_UART_SNIFF_FLAG_FRAMING;
+        }
+        sniff->bytes++;
+        sniff->errors += byte.flags ? 1 : 0;
+        count++;
+        if (cb) {
+            cb(param, &byte);
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief init merge buffer
+ *
+ * @param merge merge buffer
+ * @param entries entry storage
+ * @param size entry number
+ */
+void protocol_uart_sniff_merge_init(struct protocol_uart_sniff_merge *merge,
+                                    struct protocol_uart_sniff_byte *entries, size_t size)
+{
+    merge->entries = entries;
+    merge->size = size;
+    merge->count = 0;
+    merge->forced = 0;
+}
+
+/**
+ * @brief add a byte in timestamp order, bytes of one channel arrive in order
+ *        so the insert point is near the end, the oldest byte is released
+ *        when the buffer is full
+ */
+void protocol_uart_sniff_merge_push(struct protocol_uart_sniff_merge *merge,
+                                    const struct protocol_uart_sniff_byte *byte,
+                                    protocol_uart_sniff_cb_t cb, void *param)
+{
+    if (merge->size == 0) {
+        return;
+    }
+    if (merge->count == merge->size) {
+        if (cb) {
+            cb(param, &merge->entries[0]);
+        }
+        memmove(&merge->entries[0], &merge->entries[1], (merge->count - 1) * sizeof(merge->entries[0]));
+        merge->count--;
+        merge->forced++;
+    }
+    size_t index = merge->count;
+    while (index > 0 && merge->entries[index - 1].timestamp > byte->timestamp) {
+        index--;
+    }
+    memmove(&merge->entries[index + 1], &merge->entries[index], (merge->count - index) * sizeof(merge->entries[0]));
+    merge->entries[index] = *byte;
+    merge->count++;
+}
+
+/**
+ * @brief release the bytes older than a time, in order
+ *
+ * @return size_t released bytes
+ */
+size_t protocol_uart_sniff_merge_pop(struct protocol_uart_sniff_merge *merge, int64_t before,
+                                     protocol_uart_sniff_cb_t cb, void *param)
+{
+    size_t num = 0;
+    while (num < merge->count && merge->entries[num].timestamp < before) {
+        if (cb) {
+            cb(param, &merge->entries[num]);
+        }
+        num++;
+    }
+    if (num) {
+        memmove(&merge->entries[0], &merge->entries[num], (merge->count - num) * sizeof(merge->entries[0]));
+        merge->count -= num;
+    }
+    return num;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file protocol_uart_sniff.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief uart decoder for rmt symbol streams
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PROTOCOL_UART_SNIFF_H__
+#define __PROTOCOL_UART_SNIFF_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * symbol word, same layout as rmt_symbol_word_t: bits 0..14 duration0,
+ * bit 15 level0, bits 16..30 duration1, bit 31 level1, durations in ticks,
+ * a zero duration ends the block with the line idle
+ */
+#define PROTOCOL_UART_SNIFF_SYMBOL(_d0, _l0, _d1, _l1) \
+    (((uint32_t) (_d0) & 0x7FFF) | ((uint32_t) (_l0) << 15) \
+     | (((uint32_t) (_d1) & 0x7FFF) << 16) | ((uint32_t) (_l1) << 31))
+
+#define PROTOCOL_UART_SNIFF_PARITY_NONE 0
+#define PROTOCOL_UART_SNIFF_PARITY_EVEN 1
+#define PROTOCOL_UART_SNIFF_PARITY_ODD  2
+
+#define PROTOCOL_UART_SNIFF_FLAG_PARITY  0x01 /* parity bit mismatch */
+#define PROTOCOL_UART_SNIFF_FLAG_FRAMING 0x02 /* stop bit low */
+#define PROTOCOL_UART_SNIFF_FLAG_BREAK   0x04 /* whole frame low */
+
+struct protocol_uart_sniff_byte {
+    int64_t timestamp;          /* start bit, us */
+    uint8_t channel;
+    uint8_t data;
+    uint8_t flags;
+};
+
+typedef void (*protocol_uart_sniff_cb_t)(void *param, const struct protocol_uart_sniff_byte *byte);
+
+struct protocol_uart_sniff {
+    uint32_t tick_hz;
+    uint32_t baudrate;
+    uint32_t bit_q8;            /* ticks per bit, 24.8 fixed point */
+    uint8_t parity;
+    uint8_t channel;
+    uint32_t bytes;
+    uint32_t errors;
+};
+
+/**
+ * @brief bytes of several channels, kept in timestamp order until released
+ */
+struct protocol_uart_sniff_merge {
+    struct protocol_uart_sniff_byte *entries;
+    size_t size;
+    size_t count;
+    uint32_t forced;            /* released early because the buffer was full */
+};
+
+void protocol_uart_sniff_init(struct protocol_uart_sniff *sniff, uint8_t channel,
+                              uint32_t tick_hz, uint32_t baudrate, uint8_t parity);
+size_t protocol_uart_sniff_decode(struct protocol_uart_sniff *sniff, const uint32_t *symbols, size_t num,
+                                  int64_t timestamp, protocol_uart_sniff_cb_t cb, void *param);
+
+void protocol_uart_sniff_merge_init(struct protocol_uart_sniff_merge *merge,
+                                    struct protocol_uart_sniff_byte *entries, size_t size);
+void protocol_uart_sniff_merge_push(struct protocol_uart_sniff_merge *merge,
+                                    const struct protocol_uart_sniff_byte *byte,
+                                    protocol_uart_sniff_cb_t cb, void *param);
+size_t protocol_uart_sniff_merge_pop(struct protocol_uart_sniff_merge *merge, int64_t before,
+                                     protocol_uart_sniff_cb_t cb, void *param);
+
+#endif /* __PROTOCOL_UART_SNIFF_H__ */
@@ -14,6 +14,7 @@
 #include "driver/ledc.h"
 #include "esp_err.h"
 #include "esp_rom_gpio.h"
+#include "freertos/FreeRTOS.h"
 #include "hal/ledc_types.h"
 #include "lvgl.h"
 #include "launcher.h"
@@ -26,32 +27,53 @@
 #include "misc/lv_palette.h"
 #include "misc/lv_text.h"
 #include "protocol_common.h"
+#include "pwm.h"
+#include "pwm_phase.h"
+#include "pwm_solver.h"
 #include "rtam.h"
 #include "shell.h"
 #include "shell_cmd_group.h"
 #include "soc/clk_tree_defs.h"
 #include "soc/ledc_periph.h"
+#include "soc/soc.h"
+#include "soc/soc_caps.h"
+#include "math.h"
 #include "stdlib/lv_sprintf.h"
 #include "widgets/label/lv_label.h"
+#include "widgets/line/lv_line.h"
 #include "widgets/slider/lv_slider.h"
 
 #define PWM_GROUP_NUM           2
 #define PWM_GROUP_CHANNEL_NUM   3
-#define PWM_DUTY_RESOLUTION     LEDC_TIMER_10_BIT
-
-#define PWM_DUTY_MAX            (1 << PWM_DUTY_RESOLUTION)
-
+#define PWM_DEFAULT_FREQ        5000
+#define PWM_FREQ_MIN            2 /* 16384 * 1024 steps of the ~17.5 MHz rc clock */
+#define PWM_FREQ_MAX            40000000
+#define PWM_FREQ_SLIDER_SCALE   100 /* slider value is 100 * log10(freq) */
+#define PWM_DEAD_MAX_NS         1000000
+#define PWM_WAVE_HEIGHT         16
+#define PWM_WAVE_GAP            8
 
 struct pwm_group {
     ledc_timer_t timer;
+    bool configured;
+    uint32_t freq;
+    uint64_t freq_mhz;
+    uint8_t bits;
+    bool complementary;         /* channel 1 follows channel 0 inverted */
+    uint32_t dead_ns;
     lv_obj_t *freq_content;
     lv_obj_t *freq_slider;
     struct {
         ledc_channel_t channel;
         int pin;
         const char *name;
+        uint32_t duty;
+        uint32_t phase;         /* 0.01 % of the period */
+        bool taken;             /* pin handed over to another peripheral */
         lv_obj_t *duty_content;
         lv_obj_t *duty_slider;
+        lv_obj_t *wave;
+        lv_point_precise_t wave_points[PWM_PHASE_WAVE_POINTS];
     } pwm_cfg[PWM_GROUP_CHANNEL_NUM];
 };
 
@@ -67,20 +89,41 @@ struct pwm_group pwm_group[PWM_GROUP_NUM] = {
     {
         .timer = 2,
         .pwm_cfg = {
-            {LEDC_CHANNEL_1, 12, "P1-0"},
-            {LEDC_CHANNEL_2, 10, "P1-1"},
-            {LEDC_CHANNEL_3, 8, "P1-2"},
+            {LEDC_CHANNEL_4, 12, "P1-0"},
+            {LEDC_CHANNEL_5, 10, "P1-1"},
+            {LEDC_CHANNEL_6, 8, "P1-2"},
         }
     }
 };
 
 static const char *TAG = "pwm";
 
+/*
+ * the low speed timers share one clock source, sources are listed in order
+ * of preference, rc fast is only picked below the xtal range
+ */
+static const uint32_t pwm_source_hz[] = {
+    APB_CLK_FREQ,
+    XTAL_CLK_FREQ,
+    SOC_CLK_RC_FAST_FREQ_APPROX,
+};
+
+static const ledc_clk_cfg_t pwm_source_clk[] = {
+    LEDC_USE_APB_CLK,
+    LEDC_USE_XTAL_CLK,
+    LEDC_USE_RC_FAST_CLK,
+};
+
+static int pwm_source = -1;
+
+static portMUX_TYPE pwm_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
 static lv_obj_t *screen = NULL;
 
 static lv_obj_t* pwm_get_screen(void);
 static int pwm_set_freq(int group, int freq);
 static int pwm_set_duty(int group, int index, int duty);
+static void pwm_update_wave(int group);
 static lv_obj_t* pwm_create_pin_map_screen(void);
 
 static int pwm_gesture_callback(lv_dir_t dir)
@@ -128,7 +171,7 @@ void pwm_slider_event_cb(lv_event_t *event)
         for (int i = 0; i < PWM_GROUP_NUM; i++)
         {
             if (obj == pwm_group[i].freq_slider) {
-                int freq = lv_slider_get_value(obj);
+                int freq = (int) (powf(10, (float) lv_slider_get_value(obj) / PWM_FREQ_SLIDER_SCALE) + 0.5f);
                 pwm_set_freq(i, freq);
             } else {
                 for (int j = 0; j < PWM_GROUP_CHANNEL_NUM; j++)
@@ -153,18 +196,37 @@ static lv_obj_t* pwm_get_screen(void)
     return screen;
 }
 
+/**
+ * @brief hpoint and duty ticks of all channels of a group
+ */
+static void pwm_layout(int group, struct pwm_phase_output *out)
+{
+    uint32_t duty[PWM_GROUP_CHANNEL_NUM];
+    uint32_t phase[PWM_GROUP_CHANNEL_NUM];
+    for (int i = 0; i < PWM_GROUP_CHANNEL_NUM; i++) {
+        duty[i] = pwm_group[group].pwm_cfg[i].duty;
+        phase[i] = pwm_group[group].pwm_cfg[i].phase;
+    }
+    pwm_phase_layout(duty, phase, PWM_GROUP_CHANNEL_NUM, pwm_group[group].bits, pwm_group[group].complementary,
+                     pwm_phase_dead_ticks(pwm_group[group].dead_ns, pwm_group[group].bits,
+                                          pwm_group[group].freq_mhz),
+                     out);
+}
+
 static esp_err_t pwm_init_channel(int group_id, int index)
 {
+    struct pwm_phase_output layout[PWM_GROUP_CHANNEL_NUM];
     int io = protocol_get_io(pwm_group[group_id].pwm_cfg[index].pin);
     ESP_LOGI(TAG, "pwm%d: io: %d", index, io);
+    pwm_layout(group_id, layout);
     ledc_channel_config_t ledc_conf = {
         .channel = pwm_group[group_id].pwm_cfg[index].channel,
-        .duty = 0,
+        .duty = layout[index].duty,
         .gpio_num = io,
         .speed_mode = LEDC_LOW_SPEED_MODE,
         .timer_sel = pwm_group[group_id].timer,
         .intr_type = LEDC_INTR_DISABLE,
-        .hpoint = 0,
+        .hpoint = layout[index].hpoint,
     };
     esp_err_t ret = ledc_channel_config(&ledc_conf);
     protocol_set_pin(pwm_group[group_id].pwm_cfg[index].pin, pwm_group[group_id].pwm_cfg[index].name, lv_palette_main(LV_PALETTE_BLUE));
@@ -181,16 +243,153 @@ static void pwm_deinit_channel(int group_id, int index)
     gpio_reset_pin(protocol_get_io(pwm_group[group_id].pwm_cfg[index].pin));
 }
 
-static esp_err_t pwm_init_group(int group_id)
+static esp_err_t pwm_config_timer(int group_id, int source, const struct pwm_solution *solution)
+{
+    ledc_timer_config_t timer_conf = {
+        .duty_resolution = solution->bits,
+        .freq_hz = pwm_group[group_id].freq,
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .timer_num = pwm_group[group_id].timer,
+        .clk_cfg = pwm_source_clk[source]
+    };
+    esp_err_t ret = ledc_timer_config(&timer_conf);
+    if (ret == ESP_OK) {
+        pwm_group[group_id].bits = solution->bits;
+        pwm_group[group_id].configured = true;
+    }
+    return ret;
+}
+
+static void pwm_deconfig_timer(int group_id)
 {
     ledc_timer_config_t timer_conf = {
-        .duty_resolution = LEDC_TIMER_10_BIT,
-        .freq_hz = 5000,
         .speed_mode = LEDC_LOW_SPEED_MODE,
         .timer_num = pwm_group[group_id].timer,
-        .clk_cfg = LEDC_AUTO_CLK
+        .deconfigure = true
     };
-    ESP_ERROR_CHECK(ledc_timer_config(&timer_conf));
+    ledc_timer_pause(LEDC_LOW_SPEED_MODE, pwm_group[group_id].timer);
+    ledc_timer_config(&timer_conf);
+    pwm_group[group_id].configured = false;
+}
+
+/**
+ * @brief write duty and phase of some channels of a group for the current
+ *        resolution
+ *
+ * the channels latch new values at the end of a period, so the update
+ * requests are issued back to back with interrupts off to land in the same
+ * period. a running fade is stopped first, the driver would otherwise block
+ * until it ends. taken channels are left alone, an update would turn the
+ * stopped ledc output back on
+ *
+ * @param group group
+ * @param mask channels to write, bit per index
+ *
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t pwm_apply_channels(int group, uint32_t mask)
+{
+    struct pwm_phase_output layout[PWM_GROUP_CHANNEL_NUM];
+    esp_err_t ret = ESP_OK;
+
+    pwm_layout(group, layout);
+    for (int i = 0; i < PWM_GROUP_CHANNEL_NUM && ret == ESP_OK; i++) {
+        if (!(mask & (1 << i)) || pwm_group[group].pwm_cfg[i].taken) {
+            continue;
+        }
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[i].channel);
+        ret = ledc_set_duty_with_hpoint(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[i].channel,
+                                        layout[i].duty, layout[i].hpoint);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    taskENTER_CRITICAL(&pwm_spinlock);
+    for (int i = 0; i < PWM_GROUP_CHANNEL_NUM && ret == ESP_OK; i++) {
+        if ((mask & (1 << i)) && !pwm_group[group].pwm_cfg[i].taken) {
+            ret = ledc_update_duty(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[i].channel);
+        }
+    }
+    taskEXIT_CRITICAL(&pwm_spinlock);
+    return ret;
+}
+
+static esp_err_t pwm_apply_group(int group)
+{
+    return pwm_apply_channels(group, (1 << PWM_GROUP_CHANNEL_NUM) - 1);
+}
+
+/**
+ * @brief configure a group for a frequency, picking the clock source and the
+ *        highest duty resolution
+ *
+ * a different source is only taken if the other group's frequency can be
+ * kept with it, both timers are then reconfigured since they share the
+ * source. if the other timer refuses the new source both timers go back to
+ * the previous one
+ *
+ * @param group group
+ * @param freq frequency, Hz
+ * @param solution resulting timer setup
+ *
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t pwm_config_freq(int group, uint32_t freq, struct pwm_solution *solution)
+{
+    size_t source_num = sizeof(pwm_source_hz) / sizeof(pwm_source_hz[0]);
+    int other = group ^ 1;
+    bool configured = pwm_group[group].configured;
+    struct pwm_solution other_solution;
+    bool shared = pwm_group[other].configured && pwm_source >= 0;
+    uint32_t previous_freq = pwm_group[group].freq;
+    esp_err_t ret;
+
+    if (pwm_solve(freq, pwm_source_hz, source_num, SOC_LEDC_TIMER_BIT_WIDTH, solution) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (shared && solution->source != pwm_source
+        && pwm_solve(pwm_group[other].freq, &pwm_source_hz[solution->source], 1,
+                     SOC_LEDC_TIMER_BIT_WIDTH, &other_solution) != 0) {
+        if (pwm_solve(freq, &pwm_source_hz[pwm_source], 1, SOC_LEDC_TIMER_BIT_WIDTH, solution) != 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        solution->source = pwm_source;
+    }
+    pwm_group[group].freq = freq;
+    if (pwm_source >= 0 && solution->source != pwm_source) {
+        pwm_deconfig_timer(group);
+        if (shared) {
+            pwm_deconfig_timer(other);
+            ret = pwm_config_timer(other, solution->source, &other_solution);
+            if (ret != ESP_OK) {
+                struct pwm_solution previous = {.source = pwm_source, .bits = pwm_group[other].bits};
+                pwm_config_timer(other, pwm_source, &previous);
+                pwm_apply_group(other);
+                pwm_group[group].freq = previous_freq;
+                if (configured) {
+                    previous.bits = pwm_group[group].bits;
+                    pwm_config_timer(group, pwm_source, &previous);
+                    pwm_apply_group(group);
+                }
+                return ret;
+            }
+            pwm_group[other].freq_mhz = other_solution.freq_mhz;
+            pwm_apply_group(other);
+        }
+    }
+    pwm_source = solution->source;
+    ret = pwm_config_timer(group, pwm_source, solution);
+    pwm_group[group].freq_mhz = solution->freq_mhz;
+    if (ret == ESP_OK && configured) {
+        ret = pwm_apply_group(group);
+    }
+    return ret;
+}
+
+static esp_err_t pwm_init_group(int group_id)
+{
+    struct pwm_solution solution;
+    ESP_ERROR_CHECK(pwm_config_freq(group_id, PWM_DEFAULT_FREQ, &solution));
 
     for (int i = 0; i < PWM_GROUP_CHANNEL_NUM; i++)
     {
@@ -206,52 +405,119 @@ static esp_err_t pwm_deinit_timer(int group_id)
         pwm_deinit_channel(group_id, i);
     }
 
-    ledc_timer_config_t timer_conf = {
-        .speed_mode = LEDC_LOW_SPEED_MODE,
-        .timer_num = pwm_group[group_id].timer,
-        .deconfigure = true
-    };
-    ledc_timer_pause(LEDC_LOW_SPEED_MODE, pwm_group[group_id].timer);
-    return ledc_timer_config(&timer_conf);
+    pwm_deconfig_timer(group_id);
+    if (!pwm_group[group_id ^ 1].configured) {
+        pwm_source = -1;
+    }
+    return ESP_OK;
+}
+
+static void pwm_format_freq(char *buf, size_t size, uint64_t freq_mhz)
+{
+    if (freq_mhz >= 1000000000) {
+        lv_snprintf(buf, size, "%d.%03d MHz", (int) (freq_mhz / 1000000000), (int) (freq_mhz / 1000000 % 1000));
+    } else if (freq_mhz >= 1000000) {
+        lv_snprintf(buf, size, "%d.%03d kHz", (int) (freq_mhz / 1000000), (int) (freq_mhz / 1000 % 1000));
+    } else {
+        lv_snprintf(buf, size, "%d.%03d Hz", (int) (freq_mhz / 1000), (int) (freq_mhz % 1000));
+    }
+}
+
+/**
+ * @brief redraw the timing diagram of a group, one period of each channel
+ */
+static void pwm_update_wave(int group)
+{
+    struct pwm_phase_output layout[PWM_GROUP_CHANNEL_NUM];
+    struct pwm_phase_point points[PWM_PHASE_WAVE_POINTS];
+
+    if (screen == NULL || pwm_group[group].pwm_cfg[0].wave == NULL) {
+        return;
+    }
+    pwm_layout(group, layout);
+    for (int i = 0; i < PWM_GROUP_CHANNEL_NUM; i++) {
+        lv_obj_t *wave = pwm_group[group].pwm_cfg[i].wave;
+        int num = pwm_phase_wave(&layout[i], pwm_group[group].bits,
+                                 lv_obj_get_content_width(lv_obj_get_parent(wave)) - 1,
+                                 0, PWM_WAVE_HEIGHT - 1, points);
+        for (int j = 0; j < num; j++) {
+            pwm_group[group].pwm_cfg[i].wave_points[j].x = points[j].x;
+            pwm_group[group].pwm_cfg[i].wave_points[j].y = points[j].y;
+        }
+        lv_line_set_points(wave, pwm_group[group].pwm_cfg[i].wave_points, num);
+    }
 }
 
 static int pwm_set_freq(int group, int freq)
 {
-    if (group < 0 || group > PWM_GROUP_NUM) {
+    struct pwm_solution solution;
+
+    if (group < 0 || group >= PWM_GROUP_NUM) {
+        return -1;
+    }
+    if (freq < PWM_FREQ_MIN || freq > PWM_FREQ_MAX) {
         return -1;
     }
-    if (freq <= 0) {
+    if (pwm_config_freq(group, freq, &solution) != ESP_OK) {
+        if (shellGetCurrent() != NULL) {
+            shellPrint(shellGetCurrent(), "%d Hz can not be reached\r\n", freq);
+        }
         return -1;
     }
-    ledc_set_freq(LEDC_LOW_SPEED_MODE, pwm_group[group].timer, freq);
+    char buf[24];
+    pwm_format_freq(buf, sizeof(buf), solution.freq_mhz);
     if (pwm_group[group].freq_content) {
-        char buf[16];
-        lv_snprintf(buf, 15, "%d", freq);
         lv_label_set_text(pwm_group[group].freq_content, buf);
     }
-    if (shellGetCurrent() != NULL && pwm_group[group].freq_slider) {
-        lv_slider_set_value(pwm_group[group].freq_slider, freq, LV_ANIM_ON);
+    pwm_update_wave(group);
+    if (shellGetCurrent() != NULL) {
+        shellPrint(shellGetCurrent(), "%s, %d bit, source %lu Hz, divider %lu.%03lu\r\n",
+                   buf, solution.bits, (unsigned long) pwm_source_hz[solution.source],
+                   (unsigned long) (solution.div >> PWM_SOLVER_DIV_FRAC_BITS),
+                   (unsigned long) ((solution.div & 0xFF) * 1000 >> PWM_SOLVER_DIV_FRAC_BITS));
+        if (pwm_group[group].freq_slider) {
+            lv_slider_set_value(pwm_group[group].freq_slider,
+                                (int) (log10f(freq) * PWM_FREQ_SLIDER_SCALE + 0.5f), LV_ANIM_ON);
+        }
     }
     return 0;
 
 }
 
+/**
+ * @brief set duty
+ *
+ * @param group group
+ * @param index channel index
+ * @param duty duty, 0.01 % units, kept across frequency and resolution changes
+ */
 static int pwm_set_duty(int group, int index, int duty)
 {
-    if (group < 0 || group > PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM) {
+    if (group < 0 || group >= PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM) {
         return -1;
     }
     if (duty < 0) {
         duty = 0;
     }
-    if (duty > PWM_DUTY_MAX) {
-        duty = PWM_DUTY_MAX;
+    if (duty > PWM_SOLVER_DUTY_SCALE) {
+        duty = PWM_SOLVER_DUTY_SCALE;
+    }
+    if (pwm_group[group].pwm_cfg[index].taken) {
+        if (pwm_group[group].pwm_cfg[index].duty_slider) {
+            lv_slider_set_value(pwm_group[group].pwm_cfg[index].duty_slider,
+                                pwm_group[group].pwm_cfg[index].duty, LV_ANIM_OFF);
+        }
+        if (shellGetCurrent() != NULL) {
+            shellPrint(shellGetCurrent(), "%s is taken by rmt\r\n", pwm_group[group].pwm_cfg[index].name);
+        }
+        return -1;
     }
-    if (ledc_set_duty(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[index].channel, duty) == ESP_OK
-        && ledc_update_duty(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[index].channel) == ESP_OK) {
+    pwm_group[group].pwm_cfg[index].duty = duty;
+    if (pwm_apply_group(group) == ESP_OK) {
+        pwm_update_wave(group);
         if (pwm_group[group].pwm_cfg[index].duty_content) {
             char buf[16];
-            lv_snprintf(buf, 15, "%d", duty);
+            lv_snprintf(buf, 15, "%d.%02d%%", duty / 100, duty % 100);
             lv_label_set_text(pwm_group[group].pwm_cfg[index].duty_content, buf);
         }
         if (shellGetCurrent() != NULL && pwm_group[group].pwm_cfg[index].duty_slider) {
@@ -262,16 +528,201 @@ static int pwm_set_duty(int group, int index, int duty)
     return ESP_FAIL;
 }
 
+/**
+ * @brief set the phase offset of a channel
+ *
+ * @param group group
+ * @param index channel index
+ * @param phase offset of the rising edge, 0.01 % of the period
+ */
+static int pwm_set_phase(int group, int index, int phase)
+{
+    if (group < 0 || group >= PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM
+        || phase < 0 || phase >= PWM_PHASE_SCALE || pwm_group[group].pwm_cfg[index].taken) {
+        return -1;
+    }
+    pwm_group[group].pwm_cfg[index].phase = phase;
+    if (pwm_apply_group(group) != ESP_OK) {
+        return -1;
+    }
+    pwm_update_wave(group);
+    return 0;
+}
+
+/**
+ * @brief pair channel 1 with channel 0 as its complement
+ *
+ * @param group group
+ * @param enable 1 on, 0 off
+ * @param dead dead time around each edge, ns
+ */
+static int pwm_set_complementary(int group, int enable, int dead)
+{
+    if (group < 0 || group >= PWM_GROUP_NUM || dead < 0 || dead > PWM_DEAD_MAX_NS) {
+        return -1;
+    }
+    pwm_group[group].complementary = enable;
+    pwm_group[group].dead_ns = dead;
+    if (pwm_apply_group(group) != ESP_OK) {
+        return -1;
+    }
+    if (enable && shellGetCurrent() != NULL) {
+        shellPrint(shellGetCurrent(), "dead time %lu ticks\r\n",
+                   (unsigned long) pwm_phase_dead_ticks(dead, pwm_group[group].bits, pwm_group[group].freq_mhz));
+    }
+    pwm_update_wave(group);
+    return 0;
+}
+
+/**
+ * @brief frequency for the sequencer, only the timer is touched
+ *
+ * @return int 0 on success
+ */
+int pwm_output_freq(int group, uint32_t freq)
+{
+    struct pwm_solution solution;
+    if (group < 0 || group >= PWM_GROUP_NUM || !pwm_group[group].configured) {
+        return -1;
+    }
+    if (freq < PWM_FREQ_MIN || freq > PWM_FREQ_MAX) {
+        return -1;
+    }
+    return pwm_config_freq(group, freq, &solution) == ESP_OK ? 0 : -1;
+}
+
+/**
+ * @brief duty for the sequencer, only the channel and its complementary
+ *        partner are touched, fades on the others keep running
+ *
+ * @param duty duty, 0.01 % units
+ * @return int 0 on success
+ */
+int pwm_output_duty(int group, int index, uint32_t duty)
+{
+    if (group < 0 || group >= PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM
+        || pwm_group[group].pwm_cfg[index].taken) {
+        return -1;
+    }
+    pwm_group[group].pwm_cfg[index].duty = duty > PWM_SOLVER_DUTY_SCALE ? PWM_SOLVER_DUTY_SCALE : duty;
+    uint32_t mask = pwm_group[group].complementary && index < 2 ? 0x3 : 1 << index;
+    return pwm_apply_channels(group, mask) == ESP_OK ? 0 : -1;
+}
+
+/**
+ * @brief start a hardware fade, returns at once
+ *
+ * the fade only moves the duty of one channel, so it is refused on a
+ * complementary pair, where the partner and the dead time would not follow,
+ * and on a phase shifted channel
+ *
+ * @param duty target duty, 0.01 % units
+ * @param time fade time, ms
+ * @return int 0 on success
+ */
+int pwm_output_fade(int group, int index, uint32_t duty, uint32_t time)
+{
+    if (group < 0 || group >= PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM
+        || pwm_group[group].pwm_cfg[index].taken) {
+        return -1;
+    }
+    if ((pwm_group[group].complementary && index < 2) || pwm_group[group].pwm_cfg[index].phase != 0) {
+        return -1;
+    }
+    pwm_group[group].pwm_cfg[index].duty = duty > PWM_SOLVER_DUTY_SCALE ? PWM_SOLVER_DUTY_SCALE : duty;
+    return ledc_set_fade_time_and_start(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[index].channel,
+                                        pwm_solver_duty(pwm_group[group].pwm_cfg[index].duty, pwm_group[group].bits),
+                                        time, LEDC_FADE_NO_WAIT) == ESP_OK ? 0 : -1;
+}
+
+/**
+ * @brief bring labels and sliders in line with the outputs
+ */
+void pwm_sync_view(void)
+{
+    char buf[24];
+    if (screen == NULL) {
+        return;
+    }
+    for (int i = 0; i < PWM_GROUP_NUM; i++) {
+        if (pwm_group[i].freq_content) {
+            pwm_format_freq(buf, sizeof(buf), pwm_group[i].freq_mhz);
+            lv_label_set_text(pwm_group[i].freq_content, buf);
+            lv_slider_set_value(pwm_group[i].freq_slider,
+                                (int) (log10f(pwm_group[i].freq) * PWM_FREQ_SLIDER_SCALE + 0.5f), LV_ANIM_OFF);
+        }
+        for (int j = 0; j < PWM_GROUP_CHANNEL_NUM; j++) {
+            uint32_t duty = pwm_group[i].pwm_cfg[j].duty;
+            if (pwm_group[i].pwm_cfg[j].duty_content) {
+                lv_snprintf(buf, sizeof(buf), "%d.%02d%%", (int) duty / 100, (int) duty % 100);
+                lv_label_set_text(pwm_group[i].pwm_cfg[j].duty_content, buf);
+                lv_slider_set_value(pwm_group[i].pwm_cfg[j].duty_slider, duty, LV_ANIM_OFF);
+            }
+        }
+        pwm_update_wave(i);
+    }
+}
+
+bool pwm_running(void)
+{
+    return pwm_group[0].configured;
+}
+
+/**
+ * @brief hand a header pin over to another peripheral, the ledc channel
+ *        stops and keeps its settings, writes to it are refused until it is
+ *        given back
+ *
+ * @return int gpio of the pin, -1 on bad params or if already taken
+ */
+int pwm_take_output(int group, int index)
+{
+    if (group < 0 || group >= PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM
+        || !pwm_group[group].configured || pwm_group[group].pwm_cfg[index].taken) {
+        return -1;
+    }
+    ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[index].channel);
+    ledc_stop(LEDC_LOW_SPEED_MODE, pwm_group[group].pwm_cfg[index].channel, 0);
+    pwm_group[group].pwm_cfg[index].taken = true;
+    protocol_set_pin(pwm_group[group].pwm_cfg[index].pin, pwm_group[group].pwm_cfg[index].name,
+                     lv_palette_main(LV_PALETTE_ORANGE));
+    return protocol_get_io(pwm_group[group].pwm_cfg[index].pin);
+}
+
+/**
+ * @brief route a header pin back to its ledc channel
+ */
+void pwm_give_output(int group, int index)
+{
+    if (group < 0 || group >= PWM_GROUP_NUM || index < 0 || index >= PWM_GROUP_CHANNEL_NUM
+        || !pwm_group[group].configured || !pwm_group[group].pwm_cfg[index].taken) {
+        return;
+    }
+    pwm_group[group].pwm_cfg[index].taken = false;
+    pwm_init_channel(group, index);
+}
+
 static ShellCommand pwm_cmd_group[] =
 {
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, freq, pwm_set_freq, 
         set pwm freq\r\npwm freq [group] [freq]\r\n
-        group: 0),
+        group: 0-1\r\n
+        freq: 2-40000000 Hz),
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, duty, pwm_set_duty,
         set pwm duty\r\npwm duty [group] [index] [duty]\r\n
-        group: 0\r\n
+        group: 0-1\r\n
         index: 0-2\r\n
-        duty: 0-1024),
+        duty: 0-10000 (0.01 %)),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, phase, pwm_set_phase,
+        set pwm phase\r\npwm phase [group] [index] [phase]\r\n
+        group: 0-1\r\n
+        index: 0-2\r\n
+        phase: 0-9999 (0.01 % of the period)),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, comp, pwm_set_complementary,
+        complementary pair, channel 1 follows channel 0 inverted\r\npwm comp [group] [enable] [dead ns]\r\n
+        group: 0-1\r\n
+        enable: 0-1\r\n
+        dead: 0-1000000 ns),
     SHELL_CMD_GROUP_END()
 };
 SHELL_EXPORT_CMD_GROUP(
@@ -299,15 +750,15 @@ static lv_obj_t* pwm_init_duty_view(int group, int index, lv_obj_t *parent)
     lv_obj_align_to(duty_title, view, LV_ALIGN_BOTTOM_LEFT, 0, 0);
 
     lv_obj_t *duty_cont = lv_label_create(view);
-    lv_label_set_text(duty_cont, "0");
+    lv_label_set_text(duty_cont, "0.00%");
     lv_obj_set_width(duty_cont, LV_PCT(50));
     lv_obj_set_style_text_align(duty_cont, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
     lv_obj_align_to(duty_cont, duty_title, LV_ALIGN_OUT_RIGHT_MID, 0, 0);
 
     lv_obj_t *duty_slider = gui_create_slider(view, LV_PALETTE_BLUE, 8);
     lv_obj_set_width(duty_slider, LV_PCT(100));
-    lv_slider_set_range(duty_slider, 0, PWM_DUTY_MAX);
-    lv_slider_set_value(duty_slider, 0, LV_ANIM_ON);
+    lv_slider_set_range(duty_slider, 0, PWM_SOLVER_DUTY_SCALE);
+    lv_slider_set_value(duty_slider, pwm_group[group].pwm_cfg[index].duty, LV_ANIM_ON);
     lv_obj_add_event_cb(duty_slider, pwm_slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
     lv_obj_align_to(duty_slider, duty_title, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 16);
 
@@ -317,6 +768,35 @@ static lv_obj_t* pwm_init_duty_view(int group, int index, lv_obj_t *parent)
     return view;
 }
 
+static lv_obj_t* pwm_init_wave_view(int group, lv_obj_t *parent)
+{
+    lv_obj_t *view = lv_obj_create(parent);
+    lv_obj_set_width(view, LV_PCT(100));
+    lv_obj_set_height(view, LV_SIZE_CONTENT);
+    lv_obj_set_style_bg_color(view, lv_color_hex(0x000000), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(view, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_style_border_width(view, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(view, 12, LV_PART_MAIN);
+
+    lv_obj_t *wave_title = lv_label_create(view);
+    lv_label_set_text(wave_title, "Timing");
+    lv_obj_set_align(wave_title, LV_ALIGN_TOP_LEFT);
+
+    for (int i = 0; i < PWM_GROUP_CHANNEL_NUM; i++)
+    {
+        lv_obj_t *wave = lv_line_create(view);
+        lv_obj_set_style_line_width(wave, 2, LV_PART_MAIN);
+        lv_obj_set_style_line_color(wave, lv_palette_main(LV_PALETTE_BLUE), LV_PART_MAIN);
+        lv_obj_align_to(wave, wave_title, LV_ALIGN_OUT_BOTTOM_LEFT, 0,
+                        16 + i * (PWM_WAVE_HEIGHT + PWM_WAVE_GAP));
+        pwm_group[group].pwm_cfg[i].wave = wave;
+    }
+    lv_obj_update_layout(view);
+    pwm_update_wave(group);
+
+    return view;
+}
+
 static void pwm_init_tab(lv_obj_t *tab, int group)
 {
     lv_obj_t *view = lv_obj_create(tab);
@@ -336,15 +816,19 @@ static void pwm_init_tab(lv_obj_t *tab, int group)
 
     // freq
     lv_obj_t *freq_cont = lv_label_create(view);
-    lv_label_set_text(freq_cont, "5000");
+    char buf[24];
+    pwm_format_freq(buf, sizeof(buf), (uint64_t) pwm_group[group].freq * 1000);
+    lv_label_set_text(freq_cont, buf);
     lv_obj_set_width(freq_cont, LV_PCT(40));
     lv_obj_set_style_text_align(freq_cont, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
     lv_obj_align_to(freq_cont, freq_title, LV_ALIGN_OUT_RIGHT_MID, 0, 0);
 
     lv_obj_t *freq_slider = gui_create_slider(view, LV_PALETTE_BLUE, 8);
     lv_obj_set_width(freq_slider, LV_PCT(100));
-    lv_slider_set_range(freq_slider, 100, 10000);
-    lv_slider_set_value(freq_slider, 5000, LV_ANIM_ON);
+    lv_slider_set_range(freq_slider, (int) (log10f(PWM_FREQ_MIN) * PWM_FREQ_SLIDER_SCALE + 0.5f),
+                        (int) (log10f(PWM_FREQ_MAX) * PWM_FREQ_SLIDER_SCALE));
+    lv_slider_set_value(freq_slider, (int) (log10f(pwm_group[group].freq) * PWM_FREQ_SLIDER_SCALE + 0.5f),
+                        LV_ANIM_ON);
     lv_obj_add_event_cb(freq_slider, pwm_slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
     lv_obj_align_to(freq_slider, freq_title, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 16);
 
@@ -358,6 +842,9 @@ static void pwm_init_tab(lv_obj_t *tab, int group)
 
     pwm_group[group].freq_content = freq_cont;
     pwm_group[group].freq_slider = freq_slider;
+
+    lv_obj_t *wave_view = pwm_init_wave_view(group, tab);
+    lv_obj_align_to(wave_view, front, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
 }
 
 static void pwm_init_screen(void)
@@ -407,11 +894,15 @@ static RtAppErr pwm_init(void)
     {
         pwm_init_group(i);
     }
+    ledc_fade_func_install(0);
     return RTAM_OK;
 }
 
 static RtAppErr pwm_deinit(void)
 {
+    pwm_rmt_stop();
+    pwm_sequencer_stop();
+    ledc_fade_func_uninstall();
     for (int i = 0; i < PWM_GROUP_NUM; i++)
     {
         pwm_deinit_timer(i);
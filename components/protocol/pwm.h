@@ -0,0 +1,26 @@
+/**
+ * @file pwm.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief pwm
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PWM_H__
+#define __PWM_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int pwm_output_freq(int group, uint32_t freq);
+int pwm_output_duty(int group, int index, uint32_t duty);
+int pwm_output_fade(int group, int index, uint32_t duty, uint32_t time);
+void pwm_sync_view(void);
+bool pwm_running(void);
+int pwm_take_output(int group, int index);
+void pwm_give_output(int group, int index);
+
+void pwm_sequencer_stop(void);
+void pwm_rmt_stop(void);
+
+#endif /* __PWM_H__ */
@@ -0,0 +1,103 @@
+/**
+ * @file pwm_phase.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief pwm channel phase and complementary pair layout
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "pwm_phase.h"
+#include "pwm_solver.h"
+
+/**
+ * @brief dead time in timer ticks, rounded
+ *
+ * @param dead_ns dead time, ns
+ * @param bits duty resolution
+ * @param freq_mhz timer frequency, mHz
+ *
+ * @return uint32_t ticks
+ */
+uint32_t pwm_phase_dead_ticks(uint32_t dead_ns, uint8_t bits, uint64_t freq_mhz)
+{
+    /* ns * Hz * 2^bits stays below ns * source clock */
+    uint64_t ns_hz = ((uint64_t) dead_ns * freq_mhz + 500) / 1000;
+    return (uint32_t) (((ns_hz << bits) + 500000000) / 1000000000);
+}
+
+/**
+ * @brief place all channels of a group in the period
+ *
+ * with complementary set, channel 1 is the inverse of channel 0 with dead_ticks
+ * of both outputs low around each edge, its own duty and phase are ignored
+ *
+ * @param duty channel duties, 0.01 %
+ * @param phase channel phase offsets, 0.01 % of the period
+ * @param num channel number
+ * @param bits duty resolution
+ * @param complementary pair channel 1 with channel 0
+ * @param dead_ticks dead time of the pair
+ * @param out hpoint and duty ticks of each channel
+ */
+void pwm_phase_layout(const uint32_t *duty, const uint32_t *phase, int num, uint8_t bits,
+                      bool complementary, uint32_t dead_ticks, struct pwm_phase_output *out)
+{
+    uint32_t period = 1u << bits;
+
+    for (int i = 0; i < num; i++) {
+        out[i].duty = pwm_solver_duty(duty[i], bits);
+        out[i].hpoint = pwm_solver_duty(phase[i] % PWM_PHASE_SCALE, bits) & (period - 1);
+    }
+    if (complementary && num > 1) {
+        uint32_t used = out[0].duty + 2 * dead_ticks;
+        out[1].duty = used < period ? period - used : 0;
+        out[1].hpoint = (out[0].hpoint + out[0].duty + dead_ticks) & (period - 1);
+    }
+}
+
+/**
+ * @brief polyline of one period of a channel, for the timing diagram
+ *
+ * @param output channel layout
+ * @param bits duty resolution
+ * @param width diagram width
+ * @param high y of the high level
+ * @param low y of the low level
+ * @param points PWM_PHASE_WAVE_POINTS points at most
+ *
+ * @return int point number
+ */
+int pwm_phase_wave(const struct pwm_phase_output *output, uint8_t bits, int32_t width,
+                   int32_t high, int32_t low, struct pwm_phase_point *points)
+{
+    uint32_t period = 1u << bits;
+    int num = 0;
+
+    if (output->duty == 0 || output->duty >= period) {
+        int32_t y = output->duty ? high : low;
+        points[num++] = (struct pwm_phase_point) {0, y};
+        points[num++] = (struct pwm_phase_point) {width, y};
+        return num;
+    }
+    uint32_t rise = output->hpoint;
+    uint32_t fall = output->hpoint + output->duty;
+    /* a pulse running over the end of the period starts the period high */
+    bool wrap = fall > period;
+    if (wrap) {
+        fall -= period;
+    }
+    int32_t x_rise = (int32_t) (((uint64_t) rise * width + period / 2) >> bits);
+    int32_t x_fall = (int32_t) (((uint64_t) fall * width + period / 2) >> bits);
+    int32_t first = wrap ? high : low;
+    int32_t second = wrap ? low : high;
+    int32_t x_first = wrap ? x_fall : x_rise;
+    int32_t x_second = wrap ? x_rise : x_fall;
+
+    points[num++] = (struct pwm_phase_point) {0, first};
+    points[num++] = (struct pwm_phase_point) {x_first, first};
+    points[num++] = (struct pwm_phase_point) {x_first, second};
+    points[num++] = (struct pwm_phase_point) {x_second, second};
+    points[num++] = (struct pwm_phase_point) {x_second, first};
+    points[num++] = (struct pwm_phase_point) {width, first};
+    return num;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file pwm_phase.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief pwm channel phase and complementary pair layout
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PWM_PHASE_H__
+#define __PWM_PHASE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PWM_PHASE_SCALE             10000 /* phase unit, 0.01 % of the period */
+#define PWM_PHASE_WAVE_POINTS       6
+
+/*
+ * a ledc channel goes high when the timer counter hits hpoint and low duty
+ * ticks later, wrapping over the end of the period
+ */
+struct pwm_phase_output {
+    uint32_t hpoint;
+    uint32_t duty;
+};
+
+struct pwm_phase_point {
+    int32_t x;
+    int32_t y;
+};
+
+uint32_t pwm_phase_dead_ticks(uint32_t dead_ns, uint8_t bits, uint64_t freq_mhz);
+void pwm_phase_layout(const uint32_t *duty, const uint32_t *phase, int num, uint8_t bits,
+                      bool complementary, uint32_t dead_ticks, struct pwm_phase_output *out);
+int pwm_phase_wave(const struct pwm_phase_output *output, uint8_t bits, int32_t width,
+                   int32_t high, int32_t low, struct pwm_phase_point *points);
+
+#endif /* __PWM_PHASE_H__ */
@@ -0,0 +1,258 @@
+/**
+ * @file pwm_program.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief pwm sequencer program compiler
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * one statement per line or per `;`, `#` starts a comment:
+ *   f <group> <freq>                           set frequency, Hz
+ *   d <group> <index> <duty>                   set duty, 0.01 %
+ *   fade <group> <index> <duty> <ms>           hardware fade, runs on while the program goes on
+ *   w <ms>                                     wait
+ *   sweep <group> <from> <to> <steps> <ms> [log]
+ *                                              frequency sweep, steps points, ms each
+ *   ramp <group> <index> <from> <to> <steps> <ms>
+ *                                              duty ramp, steps points, ms each
+ * waits are relative to the previous deadline, not to when a step finished
+ */
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pwm_program.h"
+
+#define PWM_PROGRAM_MAX_ARGS        8
+
+static struct pwm_step *pwm_program_emit(struct pwm_program *program, uint8_t type)
+{
+    if (program->step_num >= PWM_PROGRAM_MAX_STEPS) {
+        return NULL;
+    }
+    struct pwm_step *step = &program->steps[program->step_num++];
+    memset(step, 0, sizeof(*step));
+    step->type = type;
+    return step;
+}
+
+static int pwm_program_wait(struct pwm_program *program, uint32_t time)
+{
+    struct pwm_step *step = pwm_program_emit(program, PWM_STEP_WAIT);
+    if (!step) {
+        return -1;
+    }
+    step->time = time;
+    return 0;
+}
+
+/**
+ * @brief clear a program
+ */
+void pwm_program_clear(struct pwm_program *program)
+{
+    program->step_num = 0;
+    program->error_line = 0;
+}
+
+/**
+ * @brief append a frequency sweep
+ *
+ * @param program program
+ * @param group pwm group
+ * @param from start frequency, Hz
+ * @param to end frequency, Hz
+ * @param steps points including both ends, at least 2
+ * @param step_us time of each point
+ * @param log logarithmic spacing, linear otherwise
+ *
+ * @return int 0 on success, -1 on bad params or a full program
+ */
+int pwm_program_sweep(struct pwm_program *program, uint8_t group, uint32_t from, uint32_t to,
+                      uint32_t steps, uint32_t step_us, bool log)
+{
+    if (steps < 2 || from == 0 || to == 0) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < steps; i++) {
+        struct pwm_step *step = pwm_program_emit(program, PWM_STEP_FREQ);
+        if (!step || pwm_program_wait(program, step_us) != 0) {
+            return -1;
+        }
+        step->group = group;
+        if (log) {
+            step->value = (uint32_t) lround(from * pow((double) to / from, (double) i / (steps - 1)));
+        } else {
+            step->value = (uint32_t) (from + ((int64_t) to - from) * i / (steps - 1));
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief append a duty ramp
+ *
+ * @param program program
+ * @param group pwm group
+ * @param index channel index
+ * @param from start duty, 0.01 %
+ * @param to end duty, 0.01 %
+ * @param steps points including both ends, at least 2
+ * @param step_us time of each point
+ *
+ * @return int 0 on success, -1 on bad params or a full program
+ */
+int pwm_program_ramp(struct pwm_program *program, uint8_t group, uint8_t index, uint32_t from, uint32_t to,
+                     uint32_t steps, uint32_t step_us)
+{
+    if (steps < 2) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < steps; i++) {
+        struct pwm_step *step = pwm_program_emit(program, PWM_STEP_DUTY);
+        if (!step || pwm_program_wait(program, step_us) != 0) {
+            return -1;
+        }
+        step->group = group;
+        step->index = index;
+        step->value = (uint32_t) (from + ((int64_t) to - from) * i / (steps - 1));
+    }
+    return 0;
+}
+
+/**
+ * @brief total wait time of a program
+ *
+ * @return uint64_t us
+ */
+uint64_t pwm_program_duration(const struct pwm_program *program)
+{
+    uint64_t time = 0;
+    for (size_t i = 0; i < program->step_num; i++) {
+        if (program->steps[i].type == PWM_STEP_WAIT) {
+            time += program->steps[i].time;
+        }
+    }
+    return time;
+}
+
+static int pwm_program_statement(struct pwm_program *program, char **argv, int argc)
+{
+    uint32_t args[PWM_PROGRAM_MAX_ARGS];
+    struct pwm_step *step;
+    bool log = false;
+
+    if (argc > 1 && strcmp(argv[argc - 1], "log") == 0) {
+        log = true;
+        argc--;
+    }
+    for (int i = 1; i < argc; i++) {
+        char *end;
+        args[i] = strtoul(argv[i], &end, 0);
+        if (*end) {
+            return -1;
+        }
+    }
+
+    if (strcmp(argv[0], "f") == 0 && argc == 3 && !log) {
+        if (args[2] == 0 || !(step = pwm_program_emit(program, PWM_STEP_FREQ))) {
+            return -1;
+        }
+        step->group = args[1];
+        step->value = args[2];
+        return 0;
+    }
+    if (strcmp(argv[0], "d") == 0 && argc == 4 && !log) {
+        if (!(step = pwm_program_emit(program, PWM_STEP_DUTY))) {
+            return -1;
+        }
+        step->group = args[1];
+        step->index = args[2];
+        step->value = args[3];
+        return 0;
+    }
+    if (strcmp(argv[0], "fade") == 0 && argc == 5 && !log) {
+        if (!(step = pwm_program_emit(program, PWM_STEP_FADE))) {
+            return -1;
+        }
+        step->group = args[1];
+        step->index = args[2];
+        step->value = args[3];
+        step->time = args[4];
+        return 0;
+    }
+    if (strcmp(argv[0], "w") == 0 && argc == 2 && !log) {
+        return args[1] > UINT32_MAX / 1000 ? -1 : pwm_program_wait(program, args[1] * 1000);
+    }
+    if (strcmp(argv[0], "sweep") == 0 && argc == 6) {
+        return args[5] > UINT32_MAX / 1000 ? -1
+            : pwm_program_sweep(program, args[1], args[2], args[3], args[4], args[5] * 1000, log);
+    }
+    if (strcmp(argv[0], "ramp") == 0 && argc == 7 && !log) {
+        return args[6] > UINT32_MAX / 1000 ? -1
+            : pwm_program_ramp(program, args[1], args[2], args[3], args[4], args[5], args[6] * 1000);
+    }
+    return -1;
+}
+
+/**
+ * @brief compile a program, replacing the steps
+ *
+ * @param program program
+ * @param text program text, not required to be null terminated
+ * @param len text length
+ *
+ * @return int 0 on success, -1 on error with program->error_line set (1 based)
+ */
+int pwm_program_compile(struct pwm_program *program, const char *text, size_t len)
+{
+    char line[128];
+    int line_num = 1;
+
+    pwm_program_clear(program);
+
+    size_t pos = 0;
+    while (pos < len) {
+        size_t line_len = 0;
+        bool comment = false;
+        while (pos < len && text[pos] != '\n' && text[pos] != ';') {
+            if (text[pos] == '#') {
+                comment = true;
+            }
+            if (!comment && line_len < sizeof(line) - 1) {
+                line[line_len++] = text[pos];
+            }
+            pos++;
+        }
+        line[line_len] = '\0';
+
+        char *argv[PWM_PROGRAM_MAX_ARGS];
+        int argc = 0;
+        char *p = line;
+        while (*p) {
+            while (isspace((unsigned char) *p)) {
+                *p++ = '\0';
+            }
+            if (!*p) {
+                break;
+            }
+            if (argc >= PWM_PROGRAM_MAX_ARGS) {
+                program->error_line = line_num;
+                return -1;
+            }
+            argv[argc++] = p;
+            while (*p && !isspace((unsigned char) *p)) {
+                p++;
+            }
+        }
+        if (argc > 0 && pwm_program_statement(program, argv, argc) != 0) {
+            program->error_line = line_num;
+            return -1;
+        }
+        if (pos < len && text[pos] == '\n') {
+            line_num++;
+        }
+        pos++;
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file pwm_program.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief pwm sequencer program compiler
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PWM_PROGRAM_H__
+#define __PWM_PROGRAM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PWM_PROGRAM_MAX_STEPS       512
+
+#define PWM_STEP_FREQ               0 /* set group frequency to value Hz */
+#define PWM_STEP_DUTY               1 /* set channel duty to value, 0.01 % */
+#define PWM_STEP_FADE               2 /* hardware fade of channel duty to value over time ms */
+#define PWM_STEP_WAIT               3 /* wait time us from the previous deadline */
+
+struct pwm_step {
+    uint8_t type;
+    uint8_t group;
+    uint8_t index;
+    uint32_t value;
+    uint32_t time;
+};
+
+struct pwm_program {
+    struct pwm_step steps[PWM_PROGRAM_MAX_STEPS];
+    uint16_t step_num;
+    int error_line;
+};
+
+void pwm_program_clear(struct pwm_program *program);
+int pwm_program_compile(struct pwm_program *program, const char *text, size_t len);
+int pwm_program_sweep(struct pwm_program *program, uint8_t group, uint32_t from, uint32_t to,
+                      uint32_t steps, uint32_t step_us, bool log);
+int pwm_program_ramp(struct pwm_program *program, uint8_t group, uint8_t index, uint32_t from, uint32_t to,
+                     uint32_t steps, uint32_t step_us);
+uint64_t pwm_program_duration(const struct pwm_program *program);
+
+#endif /* __PWM_PROGRAM_H__ */
@@ -0,0 +1,280 @@
+/**
+ * @file pwm_pulse.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief rmt pulse train encoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * everything is encoded into symbol buffers before a transmission starts,
+ * levels longer than one symbol half are split over several halves
+ *
+ * symbol files are a list of tokens, `h<us>` high and `l<us>` low, split by
+ * white space or `;`, `#` starts a comment up to the end of the line
+ */
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include "pwm_pulse.h"
+
+#define PWM_PULSE_TOKEN_MAX         16
+
+/**
+ * @brief init a buffer
+ *
+ * @param buffer buffer
+ * @param symbols symbol memory
+ * @param size symbol number
+ */
+void pwm_pulse_init(struct pwm_pulse_buffer *buffer, uint32_t *symbols, size_t size)
+{
+    buffer->symbols = symbols;
+    buffer->size = size;
+    buffer->num = 0;
+    buffer->half = false;
+}
+
+static void pwm_pulse_half(struct pwm_pulse_buffer *buffer, bool level, uint32_t ticks)
+{
+    if (buffer->half) {
+        buffer->symbols[buffer->num - 1] |= PWM_PULSE_SYMBOL(0, 0, ticks, level);
+        buffer->half = false;
+    } else {
+        buffer->symbols[buffer->num++] = PWM_PULSE_SYMBOL(ticks, level, 0, 0);
+        buffer->half = true;
+    }
+}
+
+/**
+ * @brief append a level
+ *
+ * @param buffer buffer
+ * @param level level
+ * @param ticks duration, 0 is ignored
+ *
+ * @return int 0 on success, -1 if it does not fit, the buffer is unchanged then
+ */
+int pwm_pulse_level(struct pwm_pulse_buffer *buffer, bool level, uint32_t ticks)
+{
+    uint32_t halves = (ticks + PWM_PULSE_DURATION_MAX - 1) / PWM_PULSE_DURATION_MAX;
+    size_t free_halves = (buffer->size - buffer->num) * 2 + (buffer->half ? 1 : 0);
+
+    if (halves > free_halves) {
+        return -1;
+    }
+    /* equal parts, so that no part is too short to be split again */
+    for (uint32_t i = 0; i < halves; i++) {
+        uint32_t part = ticks / (halves - i);
+        pwm_pulse_half(buffer, level, part);
+        ticks -= part;
+    }
+    return 0;
+}
+
+/**
+ * @brief complete a pending half symbol
+ *
+ * the last level is split over both halves, a one tick level is stretched
+ * to two ticks
+ *
+ * @return int 0
+ */
+int pwm_pulse_finish(struct pwm_pulse_buffer *buffer)
+{
+    if (!buffer->half) {
+        return 0;
+    }
+    uint32_t *symbol = &buffer->symbols[buffer->num - 1];
+    uint32_t ticks = *symbol & PWM_PULSE_DURATION_MAX;
+    bool level = (*symbol >> 15) & 1;
+    uint32_t first = ticks > 1 ? ticks - ticks / 2 : 1;
+    uint32_t second = ticks > 1 ? ticks / 2 : 1;
+    *symbol = PWM_PULSE_SYMBOL(first, level, second, level);
+    buffer->half = false;
+    return 0;
+}
+
+/**
+ * @brief append one period, high first
+ *
+ * @param buffer buffer
+ * @param period period, ticks
+ * @param high high time, ticks
+ *
+ * @return int 0 on success, -1 if it does not fit
+ */
+int pwm_pulse_period(struct pwm_pulse_buffer *buffer, uint32_t period, uint32_t high)
+{
+    size_t num = buffer->num;
+    bool half = buffer->half;
+
+    if (high > period) {
+        high = period;
+    }
+    if (pwm_pulse_level(buffer, true, high) != 0 || pwm_pulse_level(buffer, false, period - high) != 0) {
+        buffer->num = num;
+        buffer->half = half;
+        if (half) {
+            buffer->symbols[num - 1] &= PWM_PULSE_SYMBOL(PWM_PULSE_DURATION_MAX, 1, 0, 0);
+        }
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief total duration of a buffer
+ *
+ * @return uint64_t ticks
+ */
+uint64_t pwm_pulse_ticks(const struct pwm_pulse_buffer *buffer)
+{
+    uint64_t ticks = 0;
+    for (size_t i = 0; i < buffer->num; i++) {
+        ticks += (buffer->symbols[i] & PWM_PULSE_DURATION_MAX) + ((buffer->symbols[i] >> 16) & PWM_PULSE_DURATION_MAX);
+    }
+    return ticks;
+}
+
+/**
+ * @brief encode a trapezoidal stepper move
+ *
+ * step n of a move from rest with constant acceleration a happens at
+ * sqrt(2 * n / a), the ramp ends at the cruise speed or half way, the
+ * deceleration is the ramp reversed
+ *
+ * @param accel acceleration steps
+ * @param decel deceleration steps
+ * @param tick_hz tick frequency
+ * @param steps step number
+ * @param speed cruise speed, steps/s
+ * @param accel_rate acceleration, steps/s^2
+ * @param width step pulse width, ticks
+ * @param ramp resulting move
+ *
+ * @return int 0 on success, -1 on bad params or if the ramp does not fit
+ */
+int pwm_pulse_stepper(struct pwm_pulse_buffer *accel, struct pwm_pulse_buffer *decel, uint32_t tick_hz,
+                      uint32_t steps, uint32_t speed, uint32_t accel_rate, uint32_t width,
+                      struct pwm_pulse_ramp *ramp)
+{
+    if (steps == 0 || speed == 0 || accel_rate == 0 || tick_hz / speed <= width) {
+        return -1;
+    }
+    uint32_t cruise_period = tick_hz / speed;
+    /* clamped while still a double, v^2 / 2a can be far beyond uint32_t */
+    double full_ramp = (double) speed * speed / (2.0 * accel_rate);
+    bool triangle = full_ramp >= steps / 2 + 1;
+    uint32_t ramp_steps = triangle ? steps / 2 : (uint32_t) full_ramp;
+    /* every step takes at least one symbol */
+    if (ramp_steps > accel->size || ramp_steps > decel->size) {
+        return -1;
+    }
+    uint32_t *periods = malloc(ramp_steps ? ramp_steps * sizeof(uint32_t) : 1);
+    double last = 0;
+    int ret = 0;
+
+    if (!periods) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < ramp_steps; i++) {
+        double time = sqrt(2.0 * (i + 1) / accel_rate);
+        uint32_t period = (uint32_t) llround((time - last) * tick_hz);
+        last = time;
+        periods[i] = period < cruise_period ? cruise_period : period <= width ? width + 1 : period;
+    }
+    pwm_pulse_init(accel, accel->symbols, accel->size);
+    pwm_pulse_init(decel, decel->symbols, decel->size);
+    for (uint32_t i = 0; i < ramp_steps && ret == 0; i++) {
+        ret = pwm_pulse_period(accel, periods[i], width);
+    }
+    for (uint32_t i = ramp_steps; i > 0 && ret == 0; i--) {
+        ret = pwm_pulse_period(decel, periods[i - 1], width);
+    }
+    if (ret != 0) {
+        free(periods);
+        return -1;
+    }
+    pwm_pulse_finish(accel);
+    pwm_pulse_finish(decel);
+    /* a triangle move cruises its odd step at the peak of the ramp */
+    if (triangle && ramp_steps && periods[ramp_steps - 1] > cruise_period) {
+        cruise_period = periods[ramp_steps - 1];
+    }
+    free(periods);
+    ramp->ramp_steps = ramp_steps;
+    ramp->cruise_steps = steps - 2 * ramp_steps;
+    ramp->cruise_period = cruise_period;
+    return 0;
+}
+
+/**
+ * @brief encode symbol file text
+ *
+ * @param buffer buffer
+ * @param tick_hz tick frequency
+ * @param text text
+ * @param len text length
+ * @param final no more text follows, a token at the end is complete
+ * @param error set to 1 on a bad token
+ *
+ * @return size_t bytes consumed, stops before a token that does not fit
+ */
+size_t pwm_pulse_parse(struct pwm_pulse_buffer *buffer, uint32_t tick_hz, const char *text, size_t len,
+                       bool final, int *error)
+{
+    size_t pos = 0;
+
+    *error = 0;
+    while (pos < len) {
+        char c = text[pos];
+        if (isspace((unsigned char) c) || c == ';') {
+            pos++;
+            continue;
+        }
+        if (c == '#') {
+            size_t end = pos;
+            while (end < len && text[end] != '\n') {
+                end++;
+            }
+            if (end == len && !final) {
+                break;
+            }
+            pos = end;
+            continue;
+        }
+        size_t end = pos;
+        while (end < len && !isspace((unsigned char) text[end]) && text[end] != ';' && text[end] != '#') {
+            end++;
+        }
+        if (end == len && !final) {
+            break;
+        }
+        char token[PWM_PULSE_TOKEN_MAX];
+        char *tail;
+        if (end - pos >= PWM_PULSE_TOKEN_MAX || end - pos < 2
+            || (tolower((unsigned char) c) != 'h' && tolower((unsigned char) c) != 'l')) {
+            *error = 1;
+            break;
+        }
+        for (size_t i = 1; i < end - pos; i++) {
+            token[i - 1] = text[pos + i];
+        }
+        token[end - pos - 1] = 0;
+        unsigned long us = strtoul(token, &tail, 10);
+        if (*tail != 0) {
+            *error = 1;
+            break;
+        }
+        uint64_t ticks = ((uint64_t) us * tick_hz + 500000) / 1000000;
+        if (ticks > UINT32_MAX) {
+            *error = 1;
+            break;
+        }
+        if (pwm_pulse_level(buffer, tolower((unsigned char) c) == 'h', (uint32_t) ticks) != 0) {
+            break;
+        }
+        pos = end;
+    }
+    return pos;
+}
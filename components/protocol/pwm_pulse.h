@@ -0,0 +1,52 @@
+/**
+ * @file pwm_pulse.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief rmt pulse train encoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PWM_PULSE_H__
+#define __PWM_PULSE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * symbols use the rmt layout: duration0 bits 0-14, level0 bit 15,
+ * duration1 bits 16-30, level1 bit 31, a zero duration ends a transmission
+ */
+#define PWM_PULSE_DURATION_MAX      0x7FFF
+#define PWM_PULSE_SYMBOL(_d0, _l0, _d1, _l1) \
+    ((uint32_t) (_d0) | ((uint32_t) (_l0) << 15) | ((uint32_t) (_d1) << 16) | ((uint32_t) (_l1) << 31))
+
+struct pwm_pulse_buffer {
+    uint32_t *symbols;
+    size_t size;
+    size_t num;             /* symbols, including a pending half one */
+    bool half;              /* last symbol has only its first half */
+};
+
+/**
+ * @brief stepper move, accel and decel are in their own buffers, cruise is
+ *        one period repeated
+ */
+struct pwm_pulse_ramp {
+    uint32_t ramp_steps;
+    uint32_t cruise_steps;
+    uint32_t cruise_period; /* ticks */
+};
+
+void pwm_pulse_init(struct pwm_pulse_buffer *buffer, uint32_t *symbols, size_t size);
+int pwm_pulse_level(struct pwm_pulse_buffer *buffer, bool level, uint32_t ticks);
+int pwm_pulse_finish(struct pwm_pulse_buffer *buffer);
+int pwm_pulse_period(struct pwm_pulse_buffer *buffer, uint32_t period, uint32_t high);
+uint64_t pwm_pulse_ticks(const struct pwm_pulse_buffer *buffer);
+int pwm_pulse_stepper(struct pwm_pulse_buffer *accel, struct pwm_pulse_buffer *decel, uint32_t tick_hz,
+                      uint32_t steps, uint32_t speed, uint32_t accel_rate, uint32_t width,
+                      struct pwm_pulse_ramp *ramp);
+size_t pwm_pulse_parse(struct pwm_pulse_buffer *buffer, uint32_t tick_hz, const char *text, size_t len,
+                       bool final, int *error);
+
+#endif /* __PWM_PULSE_H__ */
@@ -0,0 +1,651 @@
+/**
+ * @file pwm_rmt.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief rmt pulse train output on the pwm pins
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * the pins of one pwm group are taken over from ledc by rmt tx channels.
+ * every waveform is encoded into symbol buffers before it starts: bursts
+ * and servo frames are one period that the rmt repeats by itself, a
+ * stepper move is the accel ramp, one cruise period repeated and the decel
+ * ramp queued back to back. symbol files are streamed through two buffers
+ * on a dma channel, the stream task encodes one while the other is sent
+ */
+#include "driver/gpio.h"
+#include "driver/rmt_tx.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "stdio.h"
+#include "string.h"
+#include "pwm.h"
+#include "pwm_pulse.h"
+
+#define PWM_RMT_OUTPUT_NUM          3
+#define PWM_RMT_TICK_HZ             1000000
+#define PWM_RMT_BURST_TICK_HZ       10000000
+#define PWM_RMT_MEM_SYMBOLS         48
+#define PWM_RMT_STEP_MEM_SYMBOLS    96
+#define PWM_RMT_DMA_SYMBOLS         1024
+#define PWM_RMT_QUEUE_DEPTH         4
+#define PWM_RMT_BURST_MAX           1000000
+#define PWM_RMT_RAMP_SYMBOLS        2048
+#define PWM_RMT_STEP_WIDTH_US       10
+#define PWM_RMT_SERVO_PERIOD_US     20000
+#define PWM_RMT_SERVO_MIN_US        500
+#define PWM_RMT_SERVO_MAX_US        2500
+#define PWM_RMT_STREAM_SYMBOLS      1024
+#define PWM_RMT_STREAM_TEXT         1024
+#define PWM_RMT_STREAM_PRIORITY     (configMAX_PRIORITIES - 3)
+
+enum {
+    PWM_RMT_IDLE = 0,
+    PWM_RMT_BURST,
+    PWM_RMT_STEPPER,
+    PWM_RMT_SERVO,
+    PWM_RMT_STREAM,
+};
+
+static const char *TAG = "pwm_rmt";
+
+static const char *pwm_rmt_mode_name[] = {"idle", "burst", "stepper", "servo", "stream"};
+
+struct pwm_rmt_output {
+    rmt_channel_handle_t channel;
+    rmt_encoder_handle_t encoder;
+    int index;
+    uint32_t value;                 /* burst freq, servo width */
+    struct pwm_pulse_buffer buffer;
+    uint32_t symbols[PWM_RMT_MEM_SYMBOLS];
+};
+
+static struct {
+    int mode;
+    int group;
+    int num;
+    struct pwm_rmt_output outputs[PWM_RMT_OUTPUT_NUM];
+    rmt_sync_manager_handle_t sync;
+    int dir;                        /* stepper dir channel, -1 none */
+    uint32_t count;
+    uint32_t *ramp;
+    struct pwm_pulse_buffer accel;
+    struct pwm_pulse_buffer decel;
+    struct pwm_pulse_ramp move;
+    /* stream */
+    TaskHandle_t task;
+    SemaphoreHandle_t done;
+    Shell *shell;
+    volatile bool run;
+    volatile bool tail;             /* the file ended, the last buffers run out */
+    FILE *file;
+    char *text;
+    size_t text_len;
+    bool eof;
+    bool pass_data;
+    uint32_t loops;
+    uint32_t loop;
+    uint32_t *stream;
+    struct pwm_pulse_buffer buffers[2];
+    int pending;
+    int error;
+    uint32_t underruns;
+    uint64_t sent;
+} pwm_rmt = {
+    .dir = -1,
+};
+
+static bool IRAM_ATTR pwm_rmt_stream_done(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata,
+                                          void *user_ctx)
+{
+    BaseType_t woken = pdFALSE;
+    pwm_rmt.sent += edata->num_symbols;
+    if (__atomic_sub_fetch(&pwm_rmt.pending, 1, __ATOMIC_ACQ_REL) == 0 && !pwm_rmt.tail) {
+        pwm_rmt.underruns++;
+    }
+    xSemaphoreGiveFromISR(pwm_rmt.done, &woken);
+    return woken == pdTRUE;
+}
+
+/**
+ * @brief take a pin and put an rmt tx channel on it
+ *
+ * @param index channel of the group
+ * @param tick_hz channel resolution
+ * @param mem_symbols rmt memory, dma buffer size with dma
+ * @param dma use dma
+ *
+ * @return struct pwm_rmt_output* output, NULL on failure
+ */
+static struct pwm_rmt_output *pwm_rmt_open(int index, uint32_t tick_hz, size_t mem_symbols, bool dma)
+{
+    struct pwm_rmt_output *output = &pwm_rmt.outputs[pwm_rmt.num];
+    int io = pwm_take_output(pwm_rmt.group, index);
+    if (io < 0) {
+        return NULL;
+    }
+    output->index = index;
+    rmt_tx_channel_config_t config = {
+        .gpio_num = io,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = tick_hz,
+        .mem_block_symbols = mem_symbols,
+        .trans_queue_depth = PWM_RMT_QUEUE_DEPTH,
+        .flags.with_dma = dma,
+    };
+    rmt_copy_encoder_config_t encoder = {};
+    if (rmt_new_tx_channel(&config, &output->channel) != ESP_OK) {
+        ESP_LOGE(TAG, "rmt channel on io %d failed", io);
+        output->channel = NULL;
+        pwm_give_output(pwm_rmt.group, index);
+        return NULL;
+    }
+    if (rmt_new_copy_encoder(&encoder, &output->encoder) != ESP_OK) {
+        ESP_LOGE(TAG, "rmt encoder failed");
+        rmt_del_channel(output->channel);
+        output->channel = NULL;
+        pwm_give_output(pwm_rmt.group, index);
+        return NULL;
+    }
+    pwm_pulse_init(&output->buffer, output->symbols, PWM_RMT_MEM_SYMBOLS);
+    pwm_rmt.num++;
+    return output;
+}
+
+static esp_err_t pwm_rmt_send(struct pwm_rmt_output *output, const struct pwm_pulse_buffer *buffer, int loops)
+{
+    rmt_transmit_config_t config = {
+        .loop_count = loops,
+    };
+    return rmt_transmit(output->channel, output->encoder, buffer->symbols,
+                        buffer->num * sizeof(uint32_t), &config);
+}
+
+/**
+ * @brief stop all outputs and give the pins back to ledc
+ */
+void pwm_rmt_stop(void)
+{
+    if (pwm_rmt.task) {
+        pwm_rmt.run = false;
+        xSemaphoreGive(pwm_rmt.done);
+        while (pwm_rmt.task) {
+            vTaskDelay(1);
+        }
+    }
+    if (pwm_rmt.sync) {
+        rmt_del_sync_manager(pwm_rmt.sync);
+        pwm_rmt.sync = NULL;
+    }
+    for (int i = 0; i < pwm_rmt.num; i++) {
+        struct pwm_rmt_output *output = &pwm_rmt.outputs[i];
+        if (output->channel) {
+            rmt_disable(output->channel);
+            rmt_del_channel(output->channel);
+            output->channel = NULL;
+        }
+        if (output->encoder) {
+            rmt_del_encoder(output->encoder);
+            output->encoder = NULL;
+        }
+        pwm_give_output(pwm_rmt.group, output->index);
+    }
+    pwm_rmt.num = 0;
+    if (pwm_rmt.dir >= 0) {
+        pwm_give_output(pwm_rmt.group, pwm_rmt.dir);
+        pwm_rmt.dir = -1;
+    }
+    if (pwm_rmt.ramp) {
+        heap_caps_free(pwm_rmt.ramp);
+        pwm_rmt.ramp = NULL;
+    }
+    if (pwm_rmt.stream) {
+        heap_caps_free(pwm_rmt.stream);
+        pwm_rmt.stream = NULL;
+    }
+    if (pwm_rmt.text) {
+        heap_caps_free(pwm_rmt.text);
+        pwm_rmt.text = NULL;
+    }
+    if (pwm_rmt.file) {
+        fclose(pwm_rmt.file);
+        pwm_rmt.file = NULL;
+    }
+    if (pwm_rmt.done) {
+        vSemaphoreDelete(pwm_rmt.done);
+        pwm_rmt.done = NULL;
+    }
+    pwm_rmt.mode = PWM_RMT_IDLE;
+}
+
+/**
+ * @brief stop the last waveform and check the group
+ *
+ * @return int 0 when ready
+ */
+static int pwm_rmt_prepare(int group, int mode)
+{
+    if (!pwm_running()) {
+        shellPrint(shellGetCurrent(), "pwm app not running\r\n");
+        return -1;
+    }
+    if (group < 0 || group > 1) {
+        return -1;
+    }
+    pwm_rmt_stop();
+    pwm_rmt.group = group;
+    pwm_rmt.mode = mode;
+    return 0;
+}
+
+static int pwm_rmt_enable(void)
+{
+    for (int i = 0; i < pwm_rmt.num; i++) {
+        if (rmt_enable(pwm_rmt.outputs[i].channel) != ESP_OK) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief a burst of pulses
+ *
+ * @param freq frequency, Hz
+ * @param duty duty, 0.01 %
+ * @param count pulse number
+ */
+static void pwm_rmt_burst(int group, int index, int freq, int duty, int count)
+{
+    if (freq <= 0 || freq > PWM_RMT_BURST_TICK_HZ / 2 || duty < 0 || duty > 10000
+        || count <= 0 || count > PWM_RMT_BURST_MAX) {
+        return;
+    }
+    if (pwm_rmt_prepare(group, PWM_RMT_BURST) != 0) {
+        return;
+    }
+    struct pwm_rmt_output *output = pwm_rmt_open(index, PWM_RMT_BURST_TICK_HZ, PWM_RMT_MEM_SYMBOLS, false);
+    if (!output || pwm_rmt_enable() != 0) {
+        pwm_rmt_stop();
+        return;
+    }
+    uint32_t period = PWM_RMT_BURST_TICK_HZ / freq;
+    /* the rmt only repeats a buffer that fits in its memory */
+    if (pwm_pulse_period(&output->buffer, period, (uint64_t) period * duty / 10000) != 0) {
+        shellPrint(shellGetCurrent(), "frequency too low\r\n");
+        pwm_rmt_stop();
+        return;
+    }
+    pwm_pulse_finish(&output->buffer);
+    output->value = PWM_RMT_BURST_TICK_HZ / period;
+    pwm_rmt.count = count;
+    if (pwm_rmt_send(output, &output->buffer, count > 1 ? count : 0) != ESP_OK) {
+        ESP_LOGE(TAG, "transmit failed");
+        pwm_rmt_stop();
+        return;
+    }
+    shellPrint(shellGetCurrent(), "%d pulses at %lu Hz\r\n", count, (unsigned long) output->value);
+}
+
+/**
+ * @brief stepper move with a trapezoidal speed profile
+ *
+ * @param step step channel
+ * @param dir dir channel, same as step for none
+ * @param steps steps, the sign sets the dir level
+ * @param speed cruise speed, steps/s
+ * @param accel acceleration, steps/s^2
+ */
+static void pwm_rmt_step(int group, int step, int dir, int steps, int speed, int accel)
+{
+    if (steps == 0 || speed <= 0 || accel <= 0 || step < 0 || step > 2 || dir < 0 || dir > 2) {
+        return;
+    }
+    if (pwm_rmt_prepare(group, PWM_RMT_STEPPER) != 0) {
+        return;
+    }
+    pwm_rmt.ramp = heap_caps_malloc(PWM_RMT_RAMP_SYMBOLS * 2 * sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    if (!pwm_rmt.ramp) {
+        ESP_LOGE(TAG, "malloc failed");
+        pwm_rmt_stop();
+        return;
+    }
+    pwm_pulse_init(&pwm_rmt.accel, pwm_rmt.ramp, PWM_RMT_RAMP_SYMBOLS);
+    pwm_pulse_init(&pwm_rmt.decel, pwm_rmt.ramp + PWM_RMT_RAMP_SYMBOLS, PWM_RMT_RAMP_SYMBOLS);
+    if (pwm_pulse_stepper(&pwm_rmt.accel, &pwm_rmt.decel, PWM_RMT_TICK_HZ, steps > 0 ? steps : -steps,
+                          speed, accel, PWM_RMT_STEP_WIDTH_US, &pwm_rmt.move) != 0) {
+        shellPrint(shellGetCurrent(), "profile does not fit, raise accel or lower speed\r\n");
+        pwm_rmt_stop();
+        return;
+    }
+    if (dir != step) {
+        int io = pwm_take_output(group, dir);
+        if (io < 0) {
+            ESP_LOGE(TAG, "dir pin unavailable");
+            pwm_rmt_stop();
+            return;
+        }
+        pwm_rmt.dir = dir;
+        gpio_set_direction(io, GPIO_MODE_OUTPUT);
+        gpio_set_level(io, steps > 0);
+    }
+    struct pwm_rmt_output *output = pwm_rmt_open(step, PWM_RMT_TICK_HZ, PWM_RMT_STEP_MEM_SYMBOLS, false);
+    if (!output || pwm_rmt_enable() != 0) {
+        pwm_rmt_stop();
+        return;
+    }
+    if (pwm_pulse_period(&output->buffer, pwm_rmt.move.cruise_period, PWM_RMT_STEP_WIDTH_US) != 0) {
+        shellPrint(shellGetCurrent(), "cruise period does not fit, raise speed\r\n");
+        pwm_rmt_stop();
+        return;
+    }
+    pwm_pulse_finish(&output->buffer);
+    pwm_rmt.count = steps > 0 ? steps : -steps;
+    esp_err_t ret = ESP_OK;
+    if (pwm_rmt.accel.num) {
+        ret = pwm_rmt_send(output, &pwm_rmt.accel, 0);
+    }
+    if (ret == ESP_OK && pwm_rmt.move.cruise_steps) {
+        ret = pwm_rmt_send(output, &output->buffer, pwm_rmt.move.cruise_steps > 1 ? pwm_rmt.move.cruise_steps : 0);
+    }
+    if (ret == ESP_OK && pwm_rmt.decel.num) {
+        ret = pwm_rmt_send(output, &pwm_rmt.decel, 0);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "transmit failed");
+        pwm_rmt_stop();
+        return;
+    }
+    shellPrint(shellGetCurrent(), "ramp %lu steps, cruise %lu steps at %lu us\r\n",
+               (unsigned long) pwm_rmt.move.ramp_steps, (unsigned long) pwm_rmt.move.cruise_steps,
+               (unsigned long) pwm_rmt.move.cruise_period);
+}
+
+/**
+ * @brief rc servo frames, the channels start together
+ *
+ * @param width0 pulse width of channel 0, us, 0 for unused
+ * @param width1 pulse width of channel 1
+ * @param width2 pulse width of channel 2
+ */
+static void pwm_rmt_servo(int group, int width0, int width1, int width2)
+{
+    int widths[PWM_RMT_OUTPUT_NUM] = {width0, width1, width2};
+    rmt_channel_handle_t channels[PWM_RMT_OUTPUT_NUM];
+
+    for (int i = 0; i < PWM_RMT_OUTPUT_NUM; i++) {
+        if (widths[i] != 0 && (widths[i] < PWM_RMT_SERVO_MIN_US || widths[i] > PWM_RMT_SERVO_MAX_US)) {
+            shellPrint(shellGetCurrent(), "width: %d-%d us\r\n", PWM_RMT_SERVO_MIN_US, PWM_RMT_SERVO_MAX_US);
+            return;
+        }
+    }
+    if (!width0 && !width1 && !width2) {
+        return;
+    }
+    if (pwm_rmt_prepare(group, PWM_RMT_SERVO) != 0) {
+        return;
+    }
+    for (int i = 0; i < PWM_RMT_OUTPUT_NUM; i++) {
+        if (!widths[i]) {
+            continue;
+        }
+        struct pwm_rmt_output *output = pwm_rmt_open(i, PWM_RMT_TICK_HZ, PWM_RMT_MEM_SYMBOLS, false);
+        if (!output) {
+            pwm_rmt_stop();
+            return;
+        }
+        output->value = widths[i];
+        pwm_pulse_period(&output->buffer, PWM_RMT_SERVO_PERIOD_US, widths[i]);
+        pwm_pulse_finish(&output->buffer);
+        channels[pwm_rmt.num - 1] = output->channel;
+    }
+    if (pwm_rmt_enable() != 0) {
+        pwm_rmt_stop();
+        return;
+    }
+    if (pwm_rmt.num > 1) {
+        rmt_sync_manager_config_t config = {
+            .tx_channel_array = channels,
+            .array_size = pwm_rmt.num,
+        };
+        if (rmt_new_sync_manager(&config, &pwm_rmt.sync) != ESP_OK) {
+            ESP_LOGE(TAG, "sync manager failed");
+            pwm_rmt_stop();
+            return;
+        }
+    }
+    for (int i = 0; i < pwm_rmt.num; i++) {
+        if (pwm_rmt_send(&pwm_rmt.outputs[i], &pwm_rmt.outputs[i].buffer, -1) != ESP_OK) {
+            ESP_LOGE(TAG, "transmit failed");
+            pwm_rmt_stop();
+            return;
+        }
+    }
+}
+
+/**
+ * @brief encode the next part of the symbol file
+ *
+ * @param buffer buffer to fill
+ *
+ * @return int symbols, 0 at the end, -1 on error
+ */
+static int pwm_rmt_stream_fill(struct pwm_pulse_buffer *buffer)
+{
+    pwm_pulse_init(buffer, buffer->symbols, buffer->size);
+    while (true) {
+        if (!pwm_rmt.eof && pwm_rmt.text_len < PWM_RMT_STREAM_TEXT) {
+            pwm_rmt.text_len += fread(pwm_rmt.text + pwm_rmt.text_len, 1,
+                                      PWM_RMT_STREAM_TEXT - pwm_rmt.text_len, pwm_rmt.file);
+            pwm_rmt.eof = feof(pwm_rmt.file) || ferror(pwm_rmt.file);
+        }
+        size_t num = buffer->num;
+        size_t used = pwm_pulse_parse(buffer, PWM_RMT_TICK_HZ, pwm_rmt.text, pwm_rmt.text_len,
+                                      pwm_rmt.eof, &pwm_rmt.error);
+        memmove(pwm_rmt.text, pwm_rmt.text + used, pwm_rmt.text_len - used);
+        pwm_rmt.text_len -= used;
+        if (pwm_rmt.error) {
+            return -1;
+        }
+        if (buffer->num != num || buffer->half) {
+            pwm_rmt.pass_data = true;
+        }
+        if (pwm_rmt.eof && pwm_rmt.text_len == 0) {
+            /* a pass without levels ends the stream, it would spin forever */
+            bool data = pwm_rmt.pass_data;
+            pwm_rmt.pass_data = false;
+            if (data) {
+                pwm_rmt.loop++;
+            }
+            if (!data || (pwm_rmt.loops && pwm_rmt.loop >= pwm_rmt.loops)) {
+                break;
+            }
+            rewind(pwm_rmt.file);
+            pwm_rmt.eof = false;
+            continue;
+        }
+        if (used == 0 && (pwm_rmt.eof || pwm_rmt.text_len == PWM_RMT_STREAM_TEXT)) {
+            /* the buffer is full, or a token that can never fit */
+            if (buffer->num == 0) {
+                pwm_rmt.error = 1;
+                return -1;
+            }
+            break;
+        }
+    }
+    pwm_pulse_finish(buffer);
+    return buffer->num;
+}
+
+static void pwm_rmt_stream_task(void *param)
+{
+    struct pwm_rmt_output *output = &pwm_rmt.outputs[0];
+    int current = 0;
+
+    while (pwm_rmt.run) {
+        if (__atomic_load_n(&pwm_rmt.pending, __ATOMIC_ACQUIRE) >= 2) {
+            xSemaphoreTake(pwm_rmt.done, portMAX_DELAY);
+            continue;
+        }
+        int num = pwm_rmt_stream_fill(&pwm_rmt.buffers[current]);
+        if (num <= 0) {
+            break;
+        }
+        __atomic_add_fetch(&pwm_rmt.pending, 1, __ATOMIC_ACQ_REL);
+        if (pwm_rmt_send(output, &pwm_rmt.buffers[current], 0) != ESP_OK) {
+            __atomic_sub_fetch(&pwm_rmt.pending, 1, __ATOMIC_ACQ_REL);
+            pwm_rmt.error = 1;
+            break;
+        }
+        current ^= 1;
+    }
+    pwm_rmt.tail = true;
+    if (pwm_rmt.run) {
+        while (pwm_rmt.run && rmt_tx_wait_all_done(output->channel, 100) != ESP_OK) {
+        }
+        if (pwm_rmt.error) {
+            shellPrint(pwm_rmt.shell, "symbol file error\r\n");
+        }
+        shellPrint(pwm_rmt.shell, "stream end, %llu symbols, %lu underruns\r\n",
+                   (unsigned long long) pwm_rmt.sent, (unsigned long) pwm_rmt.underruns);
+    }
+    pwm_rmt.task = NULL;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief stream a symbol file
+ *
+ * @param path file path
+ * @param loops times to play, 0 until stopped
+ */
+static void pwm_rmt_play(int group, int index, const char *path, int loops)
+{
+    if (!path || loops < 0 || index < 0 || index > 2) {
+        return;
+    }
+    if (pwm_rmt_prepare(group, PWM_RMT_STREAM) != 0) {
+        return;
+    }
+    pwm_rmt.file = fopen(path, "rb");
+    if (!pwm_rmt.file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        pwm_rmt_stop();
+        return;
+    }
+    pwm_rmt.text = heap_caps_malloc(PWM_RMT_STREAM_TEXT, MALLOC_CAP_DEFAULT);
+    pwm_rmt.stream = heap_caps_malloc(PWM_RMT_STREAM_SYMBOLS * 2 * sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    pwm_rmt.done = xSemaphoreCreateCounting(2, 0);
+    if (!pwm_rmt.text || !pwm_rmt.stream || !pwm_rmt.done) {
+        ESP_LOGE(TAG, "malloc failed");
+        pwm_rmt_stop();
+        return;
+    }
+    pwm_pulse_init(&pwm_rmt.buffers[0], pwm_rmt.stream, PWM_RMT_STREAM_SYMBOLS);
+    pwm_pulse_init(&pwm_rmt.buffers[1], pwm_rmt.stream + PWM_RMT_STREAM_SYMBOLS, PWM_RMT_STREAM_SYMBOLS);
+    struct pwm_rmt_output *output = pwm_rmt_open(index, PWM_RMT_TICK_HZ, PWM_RMT_DMA_SYMBOLS, true);
+    if (!output) {
+        /* only one tx channel has dma, fall back to ping-pong in rmt memory */
+        ESP_LOGW(TAG, "no dma channel");
+        output = pwm_rmt_open(index, PWM_RMT_TICK_HZ, PWM_RMT_STEP_MEM_SYMBOLS, false);
+    }
+    if (!output) {
+        pwm_rmt_stop();
+        return;
+    }
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = pwm_rmt_stream_done,
+    };
+    if (rmt_tx_register_event_callbacks(output->channel, &callbacks, NULL) != ESP_OK
+        || pwm_rmt_enable() != 0) {
+        pwm_rmt_stop();
+        return;
+    }
+    pwm_rmt.text_len = 0;
+    pwm_rmt.eof = false;
+    pwm_rmt.pass_data = false;
+    pwm_rmt.loops = loops;
+    pwm_rmt.loop = 0;
+    pwm_rmt.pending = 0;
+    pwm_rmt.tail = false;
+    pwm_rmt.error = 0;
+    pwm_rmt.underruns = 0;
+    pwm_rmt.sent = 0;
+    pwm_rmt.shell = shellGetCurrent();
+    pwm_rmt.run = true;
+    if (xTaskCreatePinnedToCore(pwm_rmt_stream_task, "pwmRmt", 3072, NULL,
+                                PWM_RMT_STREAM_PRIORITY, &pwm_rmt.task, 1) != pdPASS) {
+        ESP_LOGE(TAG, "task create failed");
+        pwm_rmt.run = false;
+        pwm_rmt_stop();
+    }
+}
+
+static void pwm_rmt_stat(void)
+{
+    Shell *shell = shellGetCurrent();
+    shellPrint(shell, "%s", pwm_rmt_mode_name[pwm_rmt.mode]);
+    if (pwm_rmt.mode == PWM_RMT_IDLE) {
+        shellPrint(shell, "\r\n");
+        return;
+    }
+    /* the stream task owns the wait on its channel */
+    bool done = pwm_rmt.mode == PWM_RMT_STREAM ? !pwm_rmt.task
+                : pwm_rmt.num && rmt_tx_wait_all_done(pwm_rmt.outputs[0].channel, 0) == ESP_OK;
+    shellPrint(shell, " on group %d, %s\r\n", pwm_rmt.group, done ? "done" : "running");
+    switch (pwm_rmt.mode) {
+    case PWM_RMT_BURST:
+        shellPrint(shell, "P%d-%d: %lu pulses at %lu Hz\r\n", pwm_rmt.group, pwm_rmt.outputs[0].index,
+                   (unsigned long) pwm_rmt.count, (unsigned long) pwm_rmt.outputs[0].value);
+        break;
+    case PWM_RMT_STEPPER:
+        shellPrint(shell, "P%d-%d: %lu steps, ramp %lu, cruise %lu us\r\n", pwm_rmt.group,
+                   pwm_rmt.outputs[0].index, (unsigned long) pwm_rmt.count,
+                   (unsigned long) pwm_rmt.move.ramp_steps, (unsigned long) pwm_rmt.move.cruise_period);
+        break;
+    case PWM_RMT_SERVO:
+        for (int i = 0; i < pwm_rmt.num; i++) {
+            shellPrint(shell, "P%d-%d: %lu us\r\n", pwm_rmt.group, pwm_rmt.outputs[i].index,
+                       (unsigned long) pwm_rmt.outputs[i].value);
+        }
+        break;
+    case PWM_RMT_STREAM:
+        shellPrint(shell, "P%d-%d: %llu symbols, loop %lu, %lu underruns\r\n", pwm_rmt.group,
+                   pwm_rmt.outputs[0].index, (unsigned long long) pwm_rmt.sent, (unsigned long) pwm_rmt.loop,
+                   (unsigned long) pwm_rmt.underruns);
+        break;
+    default:
+        break;
+    }
+}
+
+static ShellCommand pwm_rmt_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, burst, pwm_rmt_burst,
+        pulse burst\r\npwmrmt burst [group] [index] [freq] [duty] [count]\r\n
+        duty: 0-10000 (0.01 %)),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, step, pwm_rmt_step,
+        stepper move\r\npwmrmt step [group] [step index] [dir index] [steps] [speed] [accel]\r\n
+        steps: signed, dir level 1 when positive\r\n
+        speed: steps/s, accel: steps/s^2),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, servo, pwm_rmt_servo,
+        rc servo frames, 20 ms\r\npwmrmt servo [group] [us 0] [us 1] [us 2]\r\n
+        us: 500-2500, 0 leaves the channel to pwm),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, play, pwm_rmt_play,
+        stream symbol file\r\npwmrmt play [group] [index] [path] [loops: 0 until stopped]\r\n
+        h[us] high, l[us] low, # comment),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stop, pwm_rmt_stop,
+        stop and give the pins back to pwm\r\npwmrmt stop),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stat, pwm_rmt_stat,
+        show output state\r\npwmrmt stat),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+pwmrmt, pwm_rmt_group, rmt pulse train output);
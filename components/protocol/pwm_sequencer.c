@@ -0,0 +1,419 @@
+/**
+ * @file pwm_sequencer.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief pwm sweep and fade sequencer
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * a program runs in its own task on core 1, each wait arms a one shot
+ * gptimer alarm at an absolute deadline and the task sleeps until the
+ * alarm notifies it, so waits do not add up the step execution time.
+ * the wake latency against the deadline is kept as jitter, the view is
+ * only brought up to date once the program ends
+ */
+#include "driver/gptimer.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gui.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "stdio.h"
+#include "string.h"
+#include "pwm.h"
+#include "pwm_program.h"
+
+#define PWM_SEQUENCER_TIMER_HZ      1000000
+#define PWM_SEQUENCER_FILE_SIZE     8192
+#define PWM_SEQUENCER_PRIORITY      (configMAX_PRIORITIES - 2)
+
+static const char *TAG = "pwm_sequencer";
+
+static struct {
+    struct pwm_program *program;
+    gptimer_handle_t timer;
+    TaskHandle_t task;
+    Shell *shell;
+    volatile bool run;
+    uint32_t loops;
+    uint32_t steps;
+    uint32_t waits;
+    uint32_t late;
+    uint32_t errors;
+    int64_t jitter_min;
+    int64_t jitter_max;
+    int64_t jitter_sum;
+} sequencer;
+
+static bool IRAM_ATTR pwm_sequencer_alarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata,
+                                          void *user_ctx)
+{
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(sequencer.task, &woken);
+    return woken == pdTRUE;
+}
+
+/**
+ * @brief sleep until the timer reaches deadline
+ *
+ * @param deadline absolute timer count
+ *
+ * @return int64_t wake latency, us
+ */
+static int64_t pwm_sequencer_wait(uint64_t deadline)
+{
+    uint64_t now;
+    gptimer_get_raw_count(sequencer.timer, &now);
+    if (now >= deadline) {
+        sequencer.late++;
+        return (int64_t) (now - deadline);
+    }
+    gptimer_alarm_config_t alarm = {
+        .alarm_count = deadline,
+    };
+    gptimer_set_alarm_action(sequencer.timer, &alarm);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    gptimer_get_raw_count(sequencer.timer, &now);
+    return (int64_t) now - (int64_t) deadline;
+}
+
+static void pwm_sequencer_record(int64_t jitter)
+{
+    if (sequencer.waits == 0 || jitter < sequencer.jitter_min) {
+        sequencer.jitter_min = jitter;
+    }
+    if (sequencer.waits == 0 || jitter > sequencer.jitter_max) {
+        sequencer.jitter_max = jitter;
+    }
+    sequencer.jitter_sum += jitter;
+    sequencer.waits++;
+}
+
+static int pwm_sequencer_exec(const struct pwm_step *step)
+{
+    switch (step->type) {
+    case PWM_STEP_FREQ:
+        return pwm_output_freq(step->group, step->value);
+    case PWM_STEP_DUTY:
+        return pwm_output_duty(step->group, step->index, step->value);
+    case PWM_STEP_FADE:
+        return pwm_output_fade(step->group, step->index, step->value, step->time);
+    default:
+        return -1;
+    }
+}
+
+static void pwm_sequencer_print_stat(Shell *shell)
+{
+    if (!shell) {
+        return;
+    }
+    shellPrint(shell, "%lu steps, %lu errors, %lu waits, %lu late\r\n",
+               (unsigned long) sequencer.steps, (unsigned long) sequencer.errors,
+               (unsigned long) sequencer.waits, (unsigned long) sequencer.late);
+    if (sequencer.waits) {
+        shellPrint(shell, "jitter min %ld us, avg %ld us, max %ld us\r\n",
+                   (long) sequencer.jitter_min, (long) (sequencer.jitter_sum / sequencer.waits),
+                   (long) sequencer.jitter_max);
+    }
+}
+
+static void pwm_sequencer_task(void *param)
+{
+    uint64_t deadline = 0;
+    const struct pwm_program *program = sequencer.program;
+
+    gptimer_set_raw_count(sequencer.timer, 0);
+    gptimer_start(sequencer.timer);
+    for (uint32_t loop = 0; sequencer.run && (sequencer.loops == 0 || loop < sequencer.loops); loop++) {
+        for (int i = 0; i < program->step_num && sequencer.run; i++) {
+            const struct pwm_step *step = &program->steps[i];
+            if (step->type == PWM_STEP_WAIT) {
+                deadline += step->time;
+                int64_t jitter = pwm_sequencer_wait(deadline);
+                if (sequencer.run) {
+                    pwm_sequencer_record(jitter);
+                }
+                continue;
+            }
+            if (pwm_sequencer_exec(step) != 0) {
+                sequencer.errors++;
+            }
+            sequencer.steps++;
+        }
+    }
+    gptimer_stop(sequencer.timer);
+
+    /* a stop request may come from the gui, the stopper syncs the view then */
+    if (sequencer.run) {
+        gui_lock();
+        pwm_sync_view();
+        gui_unlock();
+    }
+    pwm_sequencer_print_stat(sequencer.shell);
+    sequencer.run = false;
+    sequencer.task = NULL;
+    vTaskDelete(NULL);
+}
+
+static int pwm_sequencer_init_timer(void)
+{
+    if (sequencer.timer) {
+        return 0;
+    }
+    gptimer_config_t config = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = PWM_SEQUENCER_TIMER_HZ,
+    };
+    gptimer_event_callbacks_t callbacks = {
+        .on_alarm = pwm_sequencer_alarm,
+    };
+    if (gptimer_new_timer(&config, &sequencer.timer) != ESP_OK) {
+        sequencer.timer = NULL;
+        return -1;
+    }
+    if (gptimer_register_event_callbacks(sequencer.timer, &callbacks, NULL) != ESP_OK
+        || gptimer_enable(sequencer.timer) != ESP_OK) {
+        gptimer_del_timer(sequencer.timer);
+        sequencer.timer = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief take the program, ready to be filled
+ *
+ * @return struct pwm_program* program, NULL if busy or out of memory
+ */
+static struct pwm_program *pwm_sequencer_prepare(void)
+{
+    if (!pwm_running()) {
+        shellPrint(shellGetCurrent(), "pwm app not running\r\n");
+        return NULL;
+    }
+    if (sequencer.run) {
+        shellPrint(shellGetCurrent(), "sequencer busy\r\n");
+        return NULL;
+    }
+    if (!sequencer.program) {
+        sequencer.program = heap_caps_malloc(sizeof(struct pwm_program), MALLOC_CAP_DEFAULT);
+        if (!sequencer.program) {
+            ESP_LOGE(TAG, "malloc failed");
+            return NULL;
+        }
+    }
+    pwm_program_clear(sequencer.program);
+    return sequencer.program;
+}
+
+static void pwm_sequencer_start(uint32_t loops)
+{
+    if (loops != 1 && pwm_program_duration(sequencer.program) == 0) {
+        shellPrint(shellGetCurrent(), "a looping program needs a wait\r\n");
+        return;
+    }
+    if (pwm_sequencer_init_timer() != 0) {
+        ESP_LOGE(TAG, "timer init failed");
+        return;
+    }
+    sequencer.loops = loops;
+    sequencer.steps = 0;
+    sequencer.waits = 0;
+    sequencer.late = 0;
+    sequencer.errors = 0;
+    sequencer.jitter_sum = 0;
+    sequencer.jitter_min = 0;
+    sequencer.jitter_max = 0;
+    sequencer.shell = shellGetCurrent();
+    sequencer.run = true;
+    shellPrint(shellGetCurrent(), "%u steps, %lu ms per loop\r\n",
+               sequencer.program->step_num,
+               (unsigned long) (pwm_program_duration(sequencer.program) / 1000));
+    if (xTaskCreatePinnedToCore(pwm_sequencer_task, "pwmSeq", 3072, NULL,
+                                PWM_SEQUENCER_PRIORITY, &sequencer.task, 1) != pdPASS) {
+        ESP_LOGE(TAG, "task create failed");
+        sequencer.run = false;
+    }
+}
+
+/**
+ * @brief stop the running program and release the timer
+ */
+void pwm_sequencer_stop(void)
+{
+    if (sequencer.run) {
+        sequencer.run = false;
+        if (sequencer.task) {
+            xTaskNotifyGive(sequencer.task);
+        }
+        while (sequencer.task) {
+            vTaskDelay(1);
+        }
+    }
+    if (sequencer.timer) {
+        gptimer_disable(sequencer.timer);
+        gptimer_del_timer(sequencer.timer);
+        sequencer.timer = NULL;
+    }
+    if (sequencer.program) {
+        heap_caps_free(sequencer.program);
+        sequencer.program = NULL;
+    }
+}
+
+/**
+ * @brief frequency sweep
+ *
+ * @param group pwm group
+ * @param from start frequency, Hz
+ * @param to end frequency, Hz
+ * @param steps points including both ends
+ * @param step_us time of each point, us
+ * @param log 1 for logarithmic spacing
+ */
+static void pwm_sequencer_sweep(int group, int from, int to, int steps, int step_us, int log)
+{
+    struct pwm_program *program = pwm_sequencer_prepare();
+    if (!program) {
+        return;
+    }
+    if (from <= 0 || to <= 0 || steps <= 0 || step_us <= 0
+        || pwm_program_sweep(program, group, from, to, steps, step_us, log) != 0) {
+        shellPrint(shellGetCurrent(), "param error\r\n");
+        return;
+    }
+    pwm_sequencer_start(1);
+}
+
+/**
+ * @brief duty ramp
+ *
+ * @param group pwm group
+ * @param index channel index
+ * @param from start duty, 0.01 %
+ * @param to end duty, 0.01 %
+ * @param steps points including both ends
+ * @param step_us time of each point, us
+ */
+static void pwm_sequencer_ramp(int group, int index, int from, int to, int steps, int step_us)
+{
+    struct pwm_program *program = pwm_sequencer_prepare();
+    if (!program) {
+        return;
+    }
+    if (from < 0 || to < 0 || steps <= 0 || step_us <= 0
+        || pwm_program_ramp(program, group, index, from, to, steps, step_us) != 0) {
+        shellPrint(shellGetCurrent(), "param error\r\n");
+        return;
+    }
+    pwm_sequencer_start(1);
+}
+
+/**
+ * @brief hardware fade of a channel
+ *
+ * @param group pwm group
+ * @param index channel index
+ * @param duty target duty, 0.01 %
+ * @param time fade time, ms
+ */
+static void pwm_sequencer_fade(int group, int index, int duty, int time)
+{
+    char text[48];
+    struct pwm_program *program = pwm_sequencer_prepare();
+    if (!program) {
+        return;
+    }
+    snprintf(text, sizeof(text), "fade %d %d %d %d; w %d", group, index, duty, time, time);
+    if (duty < 0 || time < 0 || pwm_program_compile(program, text, strlen(text)) != 0) {
+        shellPrint(shellGetCurrent(), "param error\r\n");
+        return;
+    }
+    pwm_sequencer_start(1);
+}
+
+/**
+ * @brief run a program file
+ *
+ * @param path file path
+ * @param loops times to run, 0 until stopped
+ */
+static void pwm_sequencer_run(const char *path, int loops)
+{
+    if (!path || loops < 0) {
+        return;
+    }
+    struct pwm_program *program = pwm_sequencer_prepare();
+    if (!program) {
+        return;
+    }
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    char *text = heap_caps_malloc(PWM_SEQUENCER_FILE_SIZE, MALLOC_CAP_DEFAULT);
+    if (!text) {
+        ESP_LOGE(TAG, "malloc failed");
+        fclose(file);
+        return;
+    }
+    size_t len = fread(text, 1, PWM_SEQUENCER_FILE_SIZE, file);
+    bool truncated = len == PWM_SEQUENCER_FILE_SIZE && fgetc(file) != EOF;
+    fclose(file);
+    if (truncated) {
+        heap_caps_free(text);
+        shellPrint(shellGetCurrent(), "%s is larger than %d bytes\r\n", path, PWM_SEQUENCER_FILE_SIZE);
+        return;
+    }
+    int ret = pwm_program_compile(program, text, len);
+    heap_caps_free(text);
+    if (ret != 0) {
+        shellPrint(shellGetCurrent(), "line %d: syntax error\r\n", program->error_line);
+        return;
+    }
+    pwm_sequencer_start(loops);
+}
+
+static void pwm_sequencer_cancel(void)
+{
+    pwm_sequencer_stop();
+    gui_lock();
+    pwm_sync_view();
+    gui_unlock();
+}
+
+static void pwm_sequencer_stat(void)
+{
+    shellPrint(shellGetCurrent(), "%s\r\n", sequencer.run ? "running" : "idle");
+    pwm_sequencer_print_stat(shellGetCurrent());
+}
+
+static ShellCommand pwm_sequencer_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, sweep, pwm_sequencer_sweep,
+        frequency sweep\r\npwmseq sweep [group] [from] [to] [steps] [step us] [log: 0/1]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, ramp, pwm_sequencer_ramp,
+        duty ramp\r\npwmseq ramp [group] [index] [from] [to] [steps] [step us]\r\n
+        duty: 0-10000 (0.01 %)),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, fade, pwm_sequencer_fade,
+        hardware fade\r\npwmseq fade [group] [index] [duty] [ms]\r\n
+        not on complementary or phase shifted channels),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, run, pwm_sequencer_run,
+        run program file\r\npwmseq run [path] [loops: 0 until stopped]\r\n
+        f [group] [freq]; d [group] [index] [duty]; fade [group] [index] [duty] [ms]; w [ms]\r\n
+        sweep [group] [from] [to] [steps] [ms] [log]; ramp [group] [index] [from] [to] [steps] [ms]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stop, pwm_sequencer_cancel,
+        stop program\r\npwmseq stop),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stat, pwm_sequencer_stat,
+        show step count and timing jitter\r\npwmseq stat),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+pwmseq, pwm_sequencer_group, pwm sweep and fade sequencer);
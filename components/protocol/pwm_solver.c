@@ -0,0 +1,90 @@
+/**
+ * @file pwm_solver.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief ledc clock and duty resolution solver
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "pwm_solver.h"
+
+/**
+ * @brief divider for a source and resolution, rounded the same way the ledc
+ *        driver does
+ *
+ * @return uint64_t divider, 8 bit fraction
+ */
+static uint64_t pwm_solver_div(uint32_t source_hz, uint32_t freq, uint8_t bits)
+{
+    uint64_t step = (uint64_t) freq << bits;
+    return (((uint64_t) source_hz << PWM_SOLVER_DIV_FRAC_BITS) + step / 2) / step;
+}
+
+/**
+ * @brief pick the clock source and the highest duty resolution reaching a
+ *        frequency
+ *
+ * the resolution is the largest one whose divider is still at least 1.0, it
+ * can only be reached if that divider does not overflow, a higher resolution
+ * wins over the source order, equal resolutions go to the smaller frequency
+ * error, then to the earlier source
+ *
+ * @param freq frequency, Hz
+ * @param source_hz source clocks, in order of preference
+ * @param source_num source number
+ * @param bits_max highest duty resolution of the timer
+ * @param solution result
+ *
+ * @return int 0 solved, -1 no source reaches the frequency
+ */
+int pwm_solve(uint32_t freq, const uint32_t *source_hz, size_t source_num, uint8_t bits_max,
+              struct pwm_solution *solution)
+{
+    int found = -1;
+    uint64_t best_error = 0;
+
+    if (freq == 0) {
+        return -1;
+    }
+    for (size_t i = 0; i < source_num; i++) {
+        if (source_hz[i] / 2 < freq) {
+            continue;
+        }
+        uint8_t bits = PWM_SOLVER_BITS_MIN;
+        while (bits < bits_max && ((uint64_t) freq << (bits + 1)) <= source_hz[i]) {
+            bits++;
+        }
+        uint64_t div = pwm_solver_div(source_hz[i], freq, bits);
+        if (div < PWM_SOLVER_DIV_MIN || div > PWM_SOLVER_DIV_MAX) {
+            continue;
+        }
+        uint64_t freq_mhz = ((uint64_t) source_hz[i] << PWM_SOLVER_DIV_FRAC_BITS) * 1000 / (div << bits);
+        uint64_t error = freq_mhz > (uint64_t) freq * 1000 ? freq_mhz - (uint64_t) freq * 1000
+                                                            : (uint64_t) freq * 1000 - freq_mhz;
+        if (found < 0 || bits > solution->bits || (bits == solution->bits && error < best_error)) {
+            solution->source = i;
+            solution->bits = bits;
+            solution->div = div;
+            solution->freq_mhz = freq_mhz;
+            best_error = error;
+            found = 0;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief duty register value for a resolution independent duty
+ *
+ * @param duty duty, 0.01 % units, 0 - PWM_SOLVER_DUTY_SCALE
+ * @param bits duty resolution
+ *
+ * @return uint32_t duty register value, 0 - 2^bits
+ */
+uint32_t pwm_solver_duty(uint32_t duty, uint8_t bits)
+{
+    if (duty > PWM_SOLVER_DUTY_SCALE) {
+        duty = PWM_SOLVER_DUTY_SCALE;
+    }
+    return (uint32_t) ((((uint64_t) duty << bits) + PWM_SOLVER_DUTY_SCALE / 2) / PWM_SOLVER_DUTY_SCALE);
+}
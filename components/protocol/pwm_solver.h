@@ -0,0 +1,37 @@
+/**
+ * @file pwm_solver.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief ledc clock and duty resolution solver
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __PWM_SOLVER_H__
+#define __PWM_SOLVER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * ledc timer: freq = source / (div / 256) / 2^bits, div is a 10.8 fixed
+ * point divider from 1.0 to 1023.996
+ */
+#define PWM_SOLVER_DIV_FRAC_BITS    8
+#define PWM_SOLVER_DIV_MIN          (1 << PWM_SOLVER_DIV_FRAC_BITS)
+#define PWM_SOLVER_DIV_MAX          0x3FFFF
+#define PWM_SOLVER_BITS_MIN         1
+
+#define PWM_SOLVER_DUTY_SCALE       10000 /* duty unit, 0.01 % */
+
+struct pwm_solution {
+    uint8_t source;             /* index into the source table */
+    uint8_t bits;               /* duty resolution */
+    uint32_t div;               /* divider, 8 bit fraction */
+    uint64_t freq_mhz;          /* actual frequency, mHz */
+};
+
+int pwm_solve(uint32_t freq, const uint32_t *source_hz, size_t source_num, uint8_t bits_max,
+              struct pwm_solution *solution);
+uint32_t pwm_solver_duty(uint32_t duty, uint8_t bits);
+
+#endif /* __PWM_SOLVER_H__ */
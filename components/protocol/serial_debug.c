@@ -28,9 +28,11 @@
 #include "misc/lv_types.h"
 #include "rtam.h"
 #include "protocol_common.h"
+#include "protocol_stats.h"
 #include "serial_debug_uart.h"
 #include "serial_debug_i2c.h"
 #include "serial_debug_spi.h"
+#include "serial_debug_uart_sniff.h"
 #include "widgets/label/lv_label.h"
 
 static const char *TAG = "serial_debug";
@@ -111,17 +113,34 @@ static void serial_debug_init_screen(void)
     lv_obj_t *i2c_tab = lv_tabview_add_tab(tabview, "I2C");
     lv_obj_t *spi_tab = lv_tabview_add_tab(tabview, "SPI");
 
+    lv_obj_set_flex_flow(uart_tab, LV_FLEX_FLOW_COLUMN);
     lv_obj_t *uart_label = lv_label_create(uart_tab);
     serial_debug_uart_init_info(uart_label);
     lv_obj_set_style_text_font(uart_label, &lv_font_montserrat_16, LV_PART_MAIN);
 
+    lv_obj_t *uart_frames = lv_list_create(uart_tab);
+    lv_obj_set_size(uart_frames, LV_PCT(100), 160);
+    lv_obj_set_style_text_font(uart_frames, &lv_font_montserrat_16, LV_PART_MAIN);
+    serial_debug_uart_init_frames(uart_frames);
+
+    lv_obj_set_flex_flow(i2c_tab, LV_FLEX_FLOW_COLUMN);
     lv_obj_t *i2c_label = lv_label_create(i2c_tab);
     serial_debug_i2c_init_info(i2c_label);
     lv_obj_set_style_text_font(i2c_label, &lv_font_montserrat_16, LV_PART_MAIN);
+    serial_debug_i2c_init_grid(i2c_tab);
+
+    lv_obj_t *i2c_frames = lv_list_create(i2c_tab);
+    lv_obj_set_size(i2c_frames, LV_PCT(100), 160);
+    lv_obj_set_style_text_font(i2c_frames, &lv_font_montserrat_16, LV_PART_MAIN);
+    serial_debug_i2c_init_frames(i2c_frames);
 
+    lv_obj_set_flex_flow(spi_tab, LV_FLEX_FLOW_COLUMN);
     lv_obj_t *spi_label = lv_label_create(spi_tab);
     serial_debug_spi_init_info(spi_label);
     lv_obj_set_style_text_font(spi_label, &lv_font_montserrat_16, LV_PART_MAIN);
+    serial_debug_spi_init_mode(spi_tab);
+
+    protocol_stats_start();
 }
 
 static RtAppErr serial_debug_resume(void)
@@ -133,6 +152,7 @@ static RtAppErr serial_debug_resume(void)
 
 static RtAppErr serial_debug_suspend(void)
 {
+    protocol_stats_stop();
     serial_debug_uart_deinit_info();
     serial_debug_i2c_deinit_info();
     serial_debug_spi_deinit_info();
@@ -161,6 +181,7 @@ static RtAppErr serial_debug_init(void)
 #if CONFIG_PROTOCOL_SERIAL_DEBUG == 1
 static RtAppErr serial_debug_stop(void)
 {
+    serial_debug_uart_sniff_stop();
     serial_debug_uart_deinit();
     serial_debug_i2c_deinit();
     serial_debug_spi_deinit();
@@ -9,14 +9,22 @@
 #include "sdkconfig.h"
 #include "driver/gpio.h"
 #include "driver/i2c.h"
+#include "driver/dedic_gpio.h"
+#include "hal/dedic_gpio_cpu_ll.h"
+#include "esp_cpu.h"
+#include "cpost.h"
 #include "esp_err.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "freertos/projdefs.h"
+#include "freertos/task.h"
 #include "hal/uart_types.h"
 #include "shell.h"
 #include "shell_cmd_group.h"
 #include "shell_ext.h"
 #include "string.h"
+#include "stdio.h"
+#include "stddef.h"
 #include "core/lv_obj.h"
 #include "core/lv_obj_pos.h"
 #include "core/lv_obj_style.h"
@@ -26,64 +34,259 @@
 #include "layouts/lv_layout.h"
 #include "lvgl.h"
 #include "gui.h"
+#include "i2c_bus.h"
 #include "misc/lv_area.h"
 #include "misc/lv_color.h"
 #include "misc/lv_palette.h"
 #include "misc/lv_types.h"
+#include "protocol_capture.h"
 #include "protocol_common.h"
+#include "protocol_i2c_script.h"
+#include "protocol_i2c_sniff.h"
+#include "protocol_stats.h"
 #include "stdlib/lv_sprintf.h"
 #include "widgets/label/lv_label.h"
 
 #define SERIAL_DEBUG_I2C_PORT CONFIG_PROTOCOL_SERIAL_DEBUG_I2C_PORT
 
+#define SERIAL_DEBUG_I2C_SCAN_FIRST 0x08
+#define SERIAL_DEBUG_I2C_SCAN_LAST 0x77
+#define SERIAL_DEBUG_I2C_PROBE_TIMEOUT pdMS_TO_TICKS(10)
+
+#define SERIAL_DEBUG_I2C_SCRIPT_TIMEOUT pdMS_TO_TICKS(100)
+#define SERIAL_DEBUG_I2C_SCRIPT_FILE_SIZE 4096
+
+#define SERIAL_DEBUG_I2C_SNIFF_RING_SIZE 8192 /* edge entries, power of 2 */
+#define SERIAL_DEBUG_I2C_SNIFF_WINDOW_US 1000
+#define SERIAL_DEBUG_I2C_SNIFF_WINDOW_MAX_US 2000
+#define SERIAL_DEBUG_I2C_SNIFF_IDLE_US 20 /* shorter than start and address at 1 MHz */
+#define SERIAL_DEBUG_I2C_SNIFF_BUSY_LOSS_NS 500 /* shorter than a scl high phase at 400 kHz */
+#define SERIAL_DEBUG_I2C_SNIFF_YIELD_MS 1000 /* scheduler yield, taken on an idle bus */
+#define SERIAL_DEBUG_I2C_SNIFF_YIELD_MAX_MS 3000 /* forced yield on a bus never idle, below the task wdt */
+#define SERIAL_DEBUG_I2C_SNIFF_PRIORITY (configMAX_PRIORITIES - 4) /* below ipc, esp_timer and wifi */
+
+#define SERIAL_DEBUG_I2C_FRAME_LOG_NUM 16
+#define SERIAL_DEBUG_I2C_FRAME_LOG_SIZE 64
+#define SERIAL_DEBUG_I2C_FRAME_LIST_MAX 32
+
+#define SERIAL_DEBUG_I2C_GRID_COLUMNS 16
+#define SERIAL_DEBUG_I2C_GRID_CELLS 128
+#define SERIAL_DEBUG_I2C_GRID_CELL_SIZE 12
+
+#define SERIAL_DEBUG_I2C_CELL_NONE 0
+#define SERIAL_DEBUG_I2C_CELL_EMPTY 1
+#define SERIAL_DEBUG_I2C_CELL_ACK 2
+#define SERIAL_DEBUG_I2C_CELL_KNOWN 3
+#define SERIAL_DEBUG_I2C_CELL_REG 4
+#define SERIAL_DEBUG_I2C_CELL_CHANGED 5
+
+#define SERIAL_DEBUG_I2C_REGMAP_SIZE 256
+#define SERIAL_DEBUG_I2C_SNAPSHOT_NUM 4
+
 static const char *TAG = "serial_debug_i2c";
 
 static lv_obj_t *i2c_info_label = NULL;
+static lv_obj_t *i2c_grid_cells[SERIAL_DEBUG_I2C_GRID_CELLS] = {0};
+static lv_obj_t *i2c_frame_list = NULL;
 
 struct i2c_info {
     int sda_io;
     int scl_io;
     bool pullup_en;
     int speed;
-    long data_num_sent;
-    long data_num_received;
 };
 
+/**
+ * @brief passive sniffer, the sample task polls both lines through dedicated
+ *        gpio in short critical sections and pushes changes into the edge ring,
+ *        the decode task turns them into transfers
+ */
+static struct {
+    volatile bool run;
+    volatile int tasks;
+    uint32_t *ring;
+    size_t head;
+    size_t tail;
+    uint32_t overruns;
+    uint32_t gaps;
+    bool lost;
+    uint32_t tick_mhz;
+    int64_t time_offset;
+    struct protocol_i2c_sniff decoder;
+} sniff = {0};
+
+static char frame_logs[SERIAL_DEBUG_I2C_FRAME_LOG_NUM][SERIAL_DEBUG_I2C_FRAME_LOG_SIZE];
+static size_t frame_log_write = 0;
+static size_t frame_log_read = 0;
+
 static struct i2c_info info = {
     .pullup_en = true,
     .speed = 100000,
 };
 
-static void serial_debug_i2c_update_info(void)
+/**
+ * @brief well known id registers, a responder is named after the first match
+ */
+struct i2c_fingerprint {
+    uint8_t addr_min;
+    uint8_t addr_max;
+    uint8_t reg;
+    uint8_t width;
+    uint16_t value;
+    const char *name;
+};
+
+static const struct i2c_fingerprint fingerprints[] = {
+    {0x40, 0x4F, 0xFE, 2, 0x5449, "INA226 (TI)"},
+    {0x76, 0x77, 0xD0, 1, 0x60, "BME280"},
+    {0x76, 0x77, 0xD0, 1, 0x58, "BMP280"},
+    {0x76, 0x77, 0xD0, 1, 0x61, "BME680"},
+    {0x68, 0x69, 0x75, 1, 0x68, "MPU6050"},
+    {0x68, 0x69, 0x75, 1, 0x70, "MPU6500"},
+    {0x68, 0x69, 0x75, 1, 0x71, "MPU9250"},
+    {0x68, 0x69, 0x00, 1, 0xEA, "ICM20948"},
+    {0x68, 0x69, 0x00, 1, 0xD1, "BMI160"},
+    {0x6A, 0x6B, 0x0F, 1, 0x69, "LSM6DS3"},
+    {0x6A, 0x6B, 0x0F, 1, 0x6C, "LSM6DSO"},
+    {0x18, 0x19, 0x0F, 1, 0x33, "LIS3DH"},
+    {0x1D, 0x1D, 0x00, 1, 0xE5, "ADXL345"},
+    {0x53, 0x53, 0x00, 1, 0xE5, "ADXL345"},
+    {0x1E, 0x1E, 0x0A, 1, 0x48, "HMC5883L"},
+    {0x0D, 0x0D, 0x0D, 1, 0xFF, "QMC5883L"},
+    {0x29, 0x29, 0xC0, 1, 0xEE, "VL53L0X"},
+    {0x15, 0x15, 0xA7, 1, 0xB5, "CST816T"},
+};
+
+static uint8_t grid_state[SERIAL_DEBUG_I2C_GRID_CELLS] = {0};
+static uint8_t grid_shown[SERIAL_DEBUG_I2C_GRID_CELLS] = {0};
+
+/**
+ * @brief register range of one device, read with a single burst transfer
+ */
+struct i2c_regmap {
+    uint8_t addr;
+    uint8_t start;
+    uint16_t len;
+    uint8_t data[SERIAL_DEBUG_I2C_REGMAP_SIZE];
+};
+
+static struct {
+    struct i2c_regmap current;
+    struct i2c_regmap reference;
+    struct i2c_regmap snapshots[SERIAL_DEBUG_I2C_SNAPSHOT_NUM];
+    int changed;
+    uint32_t watch_period;
+} regmap = {0};
+
+static void serial_debug_i2c_publish_info(const struct protocol_stats_snapshot *snapshot)
 {
     if (i2c_info_label) {
-        lv_label_set_text_fmt(i2c_info_label, "Pullup: %s\n"
+        lv_label_set_text_fmt(i2c_info_label, "Mode: %s\n"
+            "Pullup: %s\n"
             "Speed: %d\n"
             "Data sent: %ld\n"
-            "Data received: %ld",
+            "Data received: %ld\n"
+            "Transfers: %ld (%ld/s)\n"
+            "Errors: %ld",
+            sniff.ring ? "Sniffer" : "Master",
             info.pullup_en ? "Enabled" : "Disabled",
-            info.speed, info.data_num_sent, info.data_num_received);
+            info.speed,
+            (long) snapshot->total[PROTOCOL_STATS_TX],
+            (long) snapshot->total[PROTOCOL_STATS_RX],
+            (long) snapshot->total[PROTOCOL_STATS_FRAMES],
+            (long) snapshot->rate[PROTOCOL_STATS_FRAMES],
+            (long) snapshot->total[PROTOCOL_STATS_ERRORS]);
+        if (regmap.current.len) {
+            lv_label_ins_text(i2c_info_label, LV_LABEL_POS_LAST, "\n");
+            char text[48];
+            lv_snprintf(text, sizeof(text), "Regs 0x%02x[0x%02x+%d]: %d changed",
+                        regmap.current.addr, regmap.current.start, regmap.current.len, regmap.changed);
+            lv_label_ins_text(i2c_info_label, LV_LABEL_POS_LAST, text);
+        }
+    }
+    size_t write = __atomic_load_n(&frame_log_write, __ATOMIC_ACQUIRE);
+    if (write - frame_log_read > SERIAL_DEBUG_I2C_FRAME_LOG_NUM) {
+        frame_log_read = write - SERIAL_DEBUG_I2C_FRAME_LOG_NUM;
+    }
+    for (; frame_log_read != write; frame_log_read++) {
+        if (!i2c_frame_list) {
+            continue;
+        }
+        lv_list_add_text(i2c_frame_list, frame_logs[frame_log_read % SERIAL_DEBUG_I2C_FRAME_LOG_NUM]);
+        if (lv_obj_get_child_count(i2c_frame_list) > SERIAL_DEBUG_I2C_FRAME_LIST_MAX) {
+            lv_obj_delete(lv_obj_get_child(i2c_frame_list, 0));
+        }
+        lv_obj_scroll_to_y(i2c_frame_list, LV_COORD_MAX, LV_ANIM_OFF);
+    }
+    for (int i = 0; i < SERIAL_DEBUG_I2C_GRID_CELLS; i++) {
+        if (!i2c_grid_cells[i] || grid_shown[i] == grid_state[i]) {
+            continue;
+        }
+        grid_shown[i] = grid_state[i];
+        lv_color_t color = grid_state[i] == SERIAL_DEBUG_I2C_CELL_CHANGED ? lv_palette_main(LV_PALETTE_ORANGE)
+                         : grid_state[i] == SERIAL_DEBUG_I2C_CELL_REG ? lv_palette_darken(LV_PALETTE_BLUE_GREY, 1)
+                         : grid_state[i] == SERIAL_DEBUG_I2C_CELL_KNOWN ? lv_palette_main(LV_PALETTE_CYAN)
+                         : grid_state[i] == SERIAL_DEBUG_I2C_CELL_ACK ? lv_palette_main(LV_PALETTE_GREEN)
+                         : grid_state[i] == SERIAL_DEBUG_I2C_CELL_EMPTY ? lv_palette_darken(LV_PALETTE_GREY, 2)
+                         : lv_palette_darken(LV_PALETTE_GREY, 4);
+        lv_obj_set_style_bg_color(i2c_grid_cells[i], color, LV_PART_MAIN);
     }
 }
 
+static void serial_debug_i2c_update_info(void)
+{
+    protocol_stats_invalidate(PROTOCOL_STATS_SOURCE_I2C);
+}
+
 void serial_debug_i2c_init_info(lv_obj_t *label)
 {
     i2c_info_label = label;
+    protocol_stats_register(PROTOCOL_STATS_SOURCE_I2C, serial_debug_i2c_publish_info);
+}
+
+/**
+ * @brief create the address grid, one cell per 7 bit address, 16 per row
+ *
+ * @param parent parent
+ */
+void serial_debug_i2c_init_grid(lv_obj_t *parent)
+{
+    lv_obj_t *grid = lv_obj_create(parent);
+    lv_obj_set_style_pad_all(grid, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_gap(grid, 1, LV_PART_MAIN);
+    lv_obj_set_style_border_width(grid, 0, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(grid, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_size(grid, SERIAL_DEBUG_I2C_GRID_COLUMNS * (SERIAL_DEBUG_I2C_GRID_CELL_SIZE + 1), LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(grid, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_remove_flag(grid, LV_OBJ_FLAG_SCROLLABLE);
+    for (int i = 0; i < SERIAL_DEBUG_I2C_GRID_CELLS; i++) {
+        lv_obj_t *cell = lv_obj_create(grid);
+        lv_obj_set_size(cell, SERIAL_DEBUG_I2C_GRID_CELL_SIZE, SERIAL_DEBUG_I2C_GRID_CELL_SIZE);
+        lv_obj_set_style_radius(cell, 2, LV_PART_MAIN);
+        lv_obj_set_style_border_width(cell, 0, LV_PART_MAIN);
+        lv_obj_set_style_bg_color(cell, lv_palette_darken(LV_PALETTE_GREY, 4), LV_PART_MAIN);
+        lv_obj_remove_flag(cell, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+        i2c_grid_cells[i] = cell;
+        grid_shown[i] = SERIAL_DEBUG_I2C_CELL_NONE;
+    }
     serial_debug_i2c_update_info();
 }
 
+void serial_debug_i2c_init_frames(lv_obj_t *list)
+{
+    i2c_frame_list = list;
+}
+
 void serial_debug_i2c_deinit_info(void)
 {
+    protocol_stats_register(PROTOCOL_STATS_SOURCE_I2C, NULL);
     i2c_info_label = NULL;
+    i2c_frame_list = NULL;
+    memset(i2c_grid_cells, 0, sizeof(i2c_grid_cells));
 }
 
-void serial_debug_i2c_init(int sda_pin, int scl_pin)
+static void serial_debug_i2c_install(void)
 {
-    info.sda_io = protocol_get_io(sda_pin);
-    info.scl_io = protocol_get_io(scl_pin);
-    ESP_LOGI(TAG, "sda: %d, scl: %d", info.sda_io, info.scl_io);
-    protocol_set_pin(sda_pin, "SDA", lv_palette_main(LV_PALETTE_CYAN));
-    protocol_set_pin(scl_pin, "SCL", lv_palette_main(LV_PALETTE_CYAN));
     i2c_config_t conf = {
         .mode = I2C_MODE_MASTER,
         .sda_io_num = info.sda_io,
@@ -94,55 +297,97 @@ void serial_debug_i2c_init(int sda_pin, int scl_pin)
     };
     ESP_ERROR_CHECK(i2c_param_config(SERIAL_DEBUG_I2C_PORT, &conf));
     ESP_ERROR_CHECK(i2c_driver_install(SERIAL_DEBUG_I2C_PORT, conf.mode, 0, 0, ESP_INTR_FLAG_SHARED|ESP_INTR_FLAG_LEVEL3));
+    ESP_ERROR_CHECK(i2c_bus_init(SERIAL_DEBUG_I2C_PORT));
+}
+
+static void serial_debug_i2c_uninstall(void)
+{
+    i2c_bus_deinit(SERIAL_DEBUG_I2C_PORT);
+    ESP_ERROR_CHECK(i2c_driver_delete(SERIAL_DEBUG_I2C_PORT));
+}
+
+void serial_debug_i2c_init(int sda_pin, int scl_pin)
+{
+    info.sda_io = protocol_get_io(sda_pin);
+    info.scl_io = protocol_get_io(scl_pin);
+    ESP_LOGI(TAG, "sda: %d, scl: %d", info.sda_io, info.scl_io);
+    protocol_set_pin(sda_pin, "SDA", lv_palette_main(LV_PALETTE_CYAN));
+    protocol_set_pin(scl_pin, "SCL", lv_palette_main(LV_PALETTE_CYAN));
+    serial_debug_i2c_install();
     
     serial_debug_i2c_update_info();
 }
 
+static void serial_debug_i2c_sniff_stop(void);
+
 void serial_debug_i2c_deinit(void)
 {
-    ESP_ERROR_CHECK(i2c_driver_delete(SERIAL_DEBUG_I2C_PORT));
+    regmap.watch_period = 0;
+    if (sniff.ring) {
+        serial_debug_i2c_sniff_stop();
+    } else {
+        serial_debug_i2c_uninstall();
+    }
     gpio_reset_pin(info.sda_io);
     gpio_reset_pin(info.scl_io);
 }
 
-void serial_debug_i2c_set_speed(int speed)
+/**
+ * @brief apply the bus configuration to the master driver
+ *
+ * @param speed bus speed
+ * @param pullup internal pullups
+ *
+ * @return esp_err_t ESP_OK on success, the settings are kept unchanged otherwise
+ */
+static esp_err_t serial_debug_i2c_config(int speed, bool pullup)
 {
-    info.speed = speed;
+    if (sniff.ring) {
+        shellPrint(shellGetCurrent(), "sniffer owns the pins, stop it first\r\n");
+        return ESP_ERR_INVALID_STATE;
+    }
     i2c_config_t conf = {
         .mode = I2C_MODE_MASTER,
         .sda_io_num = info.sda_io,
         .scl_io_num = info.scl_io,
-        .sda_pullup_en = info.pullup_en,
-        .scl_pullup_en = info.pullup_en,
-        .master.clk_speed = info.speed,
+        .sda_pullup_en = pullup,
+        .scl_pullup_en = pullup,
+        .master.clk_speed = speed,
     };
-    ESP_ERROR_CHECK(i2c_param_config(SERIAL_DEBUG_I2C_PORT, &conf));
+    esp_err_t ret = i2c_param_config(SERIAL_DEBUG_I2C_PORT, &conf);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "config failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    info.speed = speed;
+    info.pullup_en = pullup;
     serial_debug_i2c_update_info();
+    return ESP_OK;
 }
 
-void serial_debug_i2c_set_pullup(char pullup)
+int serial_debug_i2c_set_speed(int speed)
 {
-    info.pullup_en = pullup ? true : false;
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = info.sda_io,
-        .scl_io_num = info.scl_io,
-        .sda_pullup_en = info.pullup_en,
-        .scl_pullup_en = info.pullup_en,
-        .master.clk_speed = info.speed,
-    };
-    ESP_ERROR_CHECK(i2c_param_config(SERIAL_DEBUG_I2C_PORT, &conf));
-    serial_debug_i2c_update_info();
+    return serial_debug_i2c_config(speed, info.pullup_en);
+}
+
+int serial_debug_i2c_set_pullup(char pullup)
+{
+    return serial_debug_i2c_config(info.speed, pullup ? true : false);
 }
 
 void serial_debug_i2c_send(uint8_t addr, uint8_t *data)
 {
     size_t len = shellGetArrayParamSize(data);
-    i2c_master_write_to_device(SERIAL_DEBUG_I2C_PORT, addr, data, len, pdMS_TO_TICKS(100));
+    esp_err_t ret = i2c_bus_write_read(SERIAL_DEBUG_I2C_PORT, addr, data, len, NULL, 0, pdMS_TO_TICKS(100));
+    protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_I2C, PROTOCOL_CAPTURE_DIR_TX, addr,
+                           esp_timer_get_time(), data, len);
     ESP_LOG_BUFFER_HEX("i2c send", data, len);
 
-    info.data_num_sent += len;
-    serial_debug_i2c_update_info();
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_TX, len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES, 1);
+    if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_ERRORS, 1);
+    }
 }
 
 void serial_debug_i2c_receive(uint8_t addr, size_t len)
@@ -152,13 +397,706 @@ void serial_debug_i2c_receive(uint8_t addr, size_t len)
         ESP_LOGE(TAG, "malloc failed");
         return;
     }
-    i2c_master_read_from_device(SERIAL_DEBUG_I2C_PORT, addr, data, len, pdMS_TO_TICKS(100));
+    esp_err_t ret = i2c_bus_write_read(SERIAL_DEBUG_I2C_PORT, addr, NULL, 0, data, len, pdMS_TO_TICKS(100));
+    protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_I2C, PROTOCOL_CAPTURE_DIR_RX, addr,
+                           esp_timer_get_time(), data, len);
     ESP_LOG_BUFFER_HEX("i2c receive", data, len);
     heap_caps_free(data);
-    info.data_num_received += len;
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_RX, len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES, 1);
+    if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_ERRORS, 1);
+    }
+}
+
+/**
+ * @brief address only probe, one start/address/stop with a static command link
+ */
+static esp_err_t serial_debug_i2c_probe(uint8_t addr)
+{
+    uint8_t buffer[I2C_LINK_RECOMMENDED_SIZE(1)];
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(buffer, sizeof(buffer));
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (addr << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_stop(cmd);
+    esp_err_t ret = i2c_bus_cmd(SERIAL_DEBUG_I2C_PORT, cmd, SERIAL_DEBUG_I2C_PROBE_TIMEOUT);
+    i2c_cmd_link_delete_static(cmd);
+    return ret;
+}
+
+static const char *serial_debug_i2c_fingerprint(uint8_t addr)
+{
+    for (int i = 0; i < sizeof(fingerprints) / sizeof(fingerprints[0]); i++) {
+        const struct i2c_fingerprint *fp = &fingerprints[i];
+        uint8_t data[2] = {0};
+        if (addr < fp->addr_min || addr > fp->addr_max) {
+            continue;
+        }
+        if (i2c_bus_write_read(SERIAL_DEBUG_I2C_PORT, addr, &fp->reg, 1, data, fp->width,
+                               SERIAL_DEBUG_I2C_PROBE_TIMEOUT) != ESP_OK) {
+            continue;
+        }
+        uint16_t value = fp->width == 2 ? (data[0] << 8) | data[1] : data[0];
+        if (value == fp->value) {
+            return fp->name;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief probe all 7 bit addresses, then read id registers of responders
+ */
+void serial_debug_i2c_scan(void)
+{
+    uint8_t found[SERIAL_DEBUG_I2C_SCAN_LAST - SERIAL_DEBUG_I2C_SCAN_FIRST + 1];
+    int found_num = 0;
+
+    regmap.watch_period = 0;
+    for (int i = 0; i < SERIAL_DEBUG_I2C_GRID_CELLS; i++) {
+        grid_state[i] = (i >= SERIAL_DEBUG_I2C_SCAN_FIRST && i <= SERIAL_DEBUG_I2C_SCAN_LAST)
+                        ? SERIAL_DEBUG_I2C_CELL_EMPTY : SERIAL_DEBUG_I2C_CELL_NONE;
+    }
+    int64_t start = esp_timer_get_time();
+    for (uint8_t addr = SERIAL_DEBUG_I2C_SCAN_FIRST; addr <= SERIAL_DEBUG_I2C_SCAN_LAST; addr++) {
+        if (serial_debug_i2c_probe(addr) == ESP_OK) {
+            found[found_num++] = addr;
+            grid_state[addr] = SERIAL_DEBUG_I2C_CELL_ACK;
+        }
+    }
+    int64_t probe_time = esp_timer_get_time() - start;
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES,
+                       SERIAL_DEBUG_I2C_SCAN_LAST - SERIAL_DEBUG_I2C_SCAN_FIRST + 1);
+
+    for (int i = 0; i < found_num; i++) {
+        const char *name = serial_debug_i2c_fingerprint(found[i]);
+        if (name) {
+            grid_state[found[i]] = SERIAL_DEBUG_I2C_CELL_KNOWN;
+        }
+        shellPrint(shellGetCurrent(), "0x%02x: %s\r\n", found[i], name ? name : "unknown");
+    }
+    serial_debug_i2c_update_info();
+    shellPrint(shellGetCurrent(), "%d devices, probe %lld us, total %lld us\r\n",
+               found_num, probe_time, esp_timer_get_time() - start);
+}
+
+static esp_err_t serial_debug_i2c_script_poll(const struct protocol_i2c_op *op)
+{
+    int64_t deadline = esp_timer_get_time() + (int64_t) op->time * 1000;
+    esp_err_t ret;
+    do {
+        uint8_t data[2] = {0};
+        ret = i2c_bus_write_read(SERIAL_DEBUG_I2C_PORT, op->addr, &op->reg, 1,
+                                 data, op->width, SERIAL_DEBUG_I2C_SCRIPT_TIMEOUT);
+        uint16_t value = op->width == 2 ? (data[0] << 8) | data[1] : data[0];
+        if (ret == ESP_OK && (value & op->mask) == op->expect) {
+            return ESP_OK;
+        }
+        vTaskDelay(1);
+    } while (esp_timer_get_time() < deadline);
+    return ret == ESP_OK ? ESP_ERR_TIMEOUT : ret;
+}
+
+/**
+ * @brief run a compiled script, each segment between delay/poll ops is queued
+ *        into one command link and executed with a single driver call
+ *
+ * @param script script
+ * @param result read buffer, at least script->read_len bytes
+ *
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t serial_debug_i2c_script_run(const struct protocol_i2c_script *script, uint8_t *result)
+{
+    esp_err_t ret = ESP_OK;
+    size_t index = 0;
+
+    while (index < script->op_num && ret == ESP_OK) {
+        const struct protocol_i2c_op *op = &script->ops[index];
+        size_t end = protocol_i2c_script_segment_end(script, index);
+        if (end == index) {
+            if (op->type == PROTOCOL_I2C_OP_DELAY) {
+                vTaskDelay(pdMS_TO_TICKS(op->time));
+            } else {
+                ret = serial_debug_i2c_script_poll(op);
+                protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES, 1);
+            }
+            index++;
+            continue;
+        }
+
+        i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+        if (!cmd) {
+            return ESP_ERR_NO_MEM;
+        }
+        for (size_t i = index; i < end && ret == ESP_OK; i++) {
+            op = &script->ops[i];
+            switch (op->type) {
+            case PROTOCOL_I2C_OP_START:
+                ret = i2c_master_start(cmd);
+                break;
+            case PROTOCOL_I2C_OP_WRITE:
+                ret = i2c_master_write(cmd, &script->data[op->offset], op->len, true);
+                break;
+            case PROTOCOL_I2C_OP_READ:
+                ret = i2c_master_read(cmd, &result[op->offset], op->len, I2C_MASTER_LAST_NACK);
+                break;
+            case PROTOCOL_I2C_OP_STOP:
+                ret = i2c_master_stop(cmd);
+                break;
+            default:
+                break;
+            }
+        }
+        if (ret == ESP_OK) {
+            ret = i2c_bus_cmd(SERIAL_DEBUG_I2C_PORT, cmd, SERIAL_DEBUG_I2C_SCRIPT_TIMEOUT);
+        }
+        i2c_cmd_link_delete(cmd);
+
+        int64_t timestamp = esp_timer_get_time();
+        for (size_t i = index; i < end; i++) {
+            op = &script->ops[i];
+            if (op->type == PROTOCOL_I2C_OP_WRITE && op->len > 1) {
+                protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_I2C, PROTOCOL_CAPTURE_DIR_TX, op->addr,
+                                       timestamp, &script->data[op->offset + 1], op->len - 1);
+                protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_TX, op->len - 1);
+            } else if (op->type == PROTOCOL_I2C_OP_READ && ret == ESP_OK) {
+                protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_I2C, PROTOCOL_CAPTURE_DIR_RX, op->addr,
+                                       timestamp, &result[op->offset], op->len);
+                protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_RX, op->len);
+            }
+        }
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES, 1);
+        index = end;
+    }
+    if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_ERRORS, 1);
+    }
+    return ret;
+}
+
+static void serial_debug_i2c_script_exec(const char *text, size_t len)
+{
+    Shell *shell = shellGetCurrent();
+    struct protocol_i2c_script *script = heap_caps_malloc(sizeof(struct protocol_i2c_script), MALLOC_CAP_DEFAULT);
+    uint8_t *result = heap_caps_calloc(1, PROTOCOL_I2C_SCRIPT_READ_SIZE, MALLOC_CAP_DEFAULT);
+    if (!script || !result) {
+        ESP_LOGE(TAG, "malloc failed");
+        goto exit;
+    }
+    if (protocol_i2c_script_compile(script, text, len) != 0) {
+        shellPrint(shell, "script error at line %d\r\n", script->error_line);
+        goto exit;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = serial_debug_i2c_script_run(script, result);
+    int64_t time = esp_timer_get_time() - start;
+    serial_debug_i2c_update_info();
+
+    for (int i = 0; i < script->read_len; i++) {
+        shellPrint(shell, "%02x%s", result[i], (i & 0x0F) == 0x0F || i == script->read_len - 1 ? "\r\n" : " ");
+    }
+    shellPrint(shell, "%s, %d ops, %d bytes read, %lld us\r\n",
+               esp_err_to_name(ret), script->op_num, script->read_len, time);
+exit:
+    heap_caps_free(result);
+    heap_caps_free(script);
+}
+
+/**
+ * @brief run an i2c script, statements separated by `;`
+ *
+ * @param text script, e.g. "w 0x40 0xfe; r 0x40 2"
+ */
+void serial_debug_i2c_script(const char *text)
+{
+    if (!text) {
+        return;
+    }
+    serial_debug_i2c_script_exec(text, strlen(text));
+}
+
+/**
+ * @brief run an i2c script file
+ *
+ * @param path file path
+ */
+void serial_debug_i2c_run(const char *path)
+{
+    if (!path) {
+        return;
+    }
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    char *text = heap_caps_malloc(SERIAL_DEBUG_I2C_SCRIPT_FILE_SIZE, MALLOC_CAP_DEFAULT);
+    if (text) {
+        size_t len = fread(text, 1, SERIAL_DEBUG_I2C_SCRIPT_FILE_SIZE, file);
+        serial_debug_i2c_script_exec(text, len);
+        heap_caps_free(text);
+    } else {
+        ESP_LOGE(TAG, "malloc failed");
+    }
+    fclose(file);
+}
+
+static bool serial_debug_i2c_regmap_same_range(const struct i2c_regmap *a, const struct i2c_regmap *b)
+{
+    return a->len && a->addr == b->addr && a->start == b->start && a->len == b->len;
+}
+
+/**
+ * @brief compare two register maps of the same range
+ *
+ * @param from old map
+ * @param to new map
+ * @param print print changed registers
+ *
+ * @return int changed register count, -1 if the ranges differ
+ */
+static int serial_debug_i2c_regmap_diff(const struct i2c_regmap *from, const struct i2c_regmap *to, bool print)
+{
+    int changed = 0;
+    if (!serial_debug_i2c_regmap_same_range(from, to)) {
+        return -1;
+    }
+    for (int i = 0; i < to->len; i++) {
+        if (from->data[i] != to->data[i]) {
+            changed++;
+            if (print) {
+                shellPrint(shellGetCurrent(), "0x%02x: %02x -> %02x\r\n",
+                           to->start + i, from->data[i], to->data[i]);
+            }
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief show the current map on the grid, changes to the reference highlighted
+ */
+static void serial_debug_i2c_regmap_show(void)
+{
+    const struct i2c_regmap *current = &regmap.current;
+    bool same = serial_debug_i2c_regmap_same_range(&regmap.reference, current);
+    int changed = 0;
+    for (int i = 0; i < current->len; i++) {
+        bool diff = same && regmap.reference.data[i] != current->data[i];
+        changed += diff;
+        if (i < SERIAL_DEBUG_I2C_GRID_CELLS) {
+            grid_state[i] = diff ? SERIAL_DEBUG_I2C_CELL_CHANGED : SERIAL_DEBUG_I2C_CELL_REG;
+        }
+    }
+    for (int i = current->len; i < SERIAL_DEBUG_I2C_GRID_CELLS; i++) {
+        grid_state[i] = SERIAL_DEBUG_I2C_CELL_NONE;
+    }
+    regmap.changed = changed;
     serial_debug_i2c_update_info();
 }
 
+static esp_err_t serial_debug_i2c_regmap_read(struct i2c_regmap *map)
+{
+    esp_err_t ret = i2c_bus_write_read(SERIAL_DEBUG_I2C_PORT, map->addr, &map->start, 1,
+                                       map->data, map->len, SERIAL_DEBUG_I2C_SCRIPT_TIMEOUT);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_TX, 1);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_RX, map->len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES, 1);
+    if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_ERRORS, 1);
+    }
+    return ret;
+}
+
+static void serial_debug_i2c_regmap_print(const struct i2c_regmap *map, const struct i2c_regmap *reference)
+{
+    Shell *shell = shellGetCurrent();
+    bool same = serial_debug_i2c_regmap_same_range(reference, map);
+    for (int i = 0; i < map->len; i++) {
+        if (i == 0 || ((map->start + i) & 0x0F) == 0) {
+            shellPrint(shell, "%s%02x:", i ? "\r\n" : "", (map->start + i) & 0xF0);
+            for (int j = 0; j < ((map->start + i) & 0x0F); j++) {
+                shellPrint(shell, "   ");
+            }
+        }
+        if (same && reference->data[i] != map->data[i]) {
+            shellPrint(shell, " \033[7m%02x\033[0m", map->data[i]);
+        } else {
+            shellPrint(shell, " %02x", map->data[i]);
+        }
+    }
+    shellPrint(shell, "\r\n");
+}
+
+/**
+ * @brief dump a register range with one burst read, changes to the previous
+ *        dump of the same range are highlighted
+ *
+ * @param addr device address
+ * @param start first register
+ * @param len register count
+ */
+void serial_debug_i2c_dump(uint8_t addr, uint8_t start, int len)
+{
+    if (len <= 0 || start + len > SERIAL_DEBUG_I2C_REGMAP_SIZE) {
+        shellPrint(shellGetCurrent(), "invalid range\r\n");
+        return;
+    }
+    struct i2c_regmap *map = heap_caps_malloc(sizeof(struct i2c_regmap), MALLOC_CAP_DEFAULT);
+    if (!map) {
+        ESP_LOGE(TAG, "malloc failed");
+        return;
+    }
+    map->addr = addr;
+    map->start = start;
+    map->len = len;
+    int64_t time = esp_timer_get_time();
+    esp_err_t ret = serial_debug_i2c_regmap_read(map);
+    time = esp_timer_get_time() - time;
+    if (ret == ESP_OK) {
+        memcpy(&regmap.reference, serial_debug_i2c_regmap_same_range(&regmap.current, map)
+               ? &regmap.current : map, sizeof(struct i2c_regmap));
+        memcpy(&regmap.current, map, sizeof(struct i2c_regmap));
+        serial_debug_i2c_regmap_print(&regmap.current, &regmap.reference);
+        serial_debug_i2c_regmap_show();
+    }
+    shellPrint(shellGetCurrent(), "%s, %lld us\r\n", esp_err_to_name(ret), time);
+    heap_caps_free(map);
+}
+
+static void serial_debug_i2c_watch_tick(void)
+{
+    if (regmap.watch_period == 0 || regmap.current.len == 0) {
+        return;
+    }
+    if (serial_debug_i2c_regmap_read(&regmap.current) == ESP_OK) {
+        serial_debug_i2c_regmap_show();
+    }
+    cpost(0, serial_debug_i2c_watch_tick, NULL, .delay=regmap.watch_period, .attrs.flag=CPOST_FLAG_CANCEL_CURRENT);
+}
+
+/**
+ * @brief re-read the last dumped range periodically, the grid highlights
+ *        changes to the reference
+ *
+ * @param period refresh period in ms, 0 to stop
+ */
+void serial_debug_i2c_watch(int period)
+{
+    if (period > 0 && regmap.current.len == 0) {
+        shellPrint(shellGetCurrent(), "dump a range first\r\n");
+        return;
+    }
+    regmap.watch_period = period > 0 ? period : 0;
+    if (regmap.watch_period) {
+        cpost(0, serial_debug_i2c_watch_tick, NULL, .delay=regmap.watch_period, .attrs.flag=CPOST_FLAG_CANCEL_CURRENT);
+    }
+}
+
+static struct i2c_regmap *serial_debug_i2c_snapshot(int slot)
+{
+    if (slot < 0 || slot >= SERIAL_DEBUG_I2C_SNAPSHOT_NUM) {
+        shellPrint(shellGetCurrent(), "slot 0 - %d\r\n", SERIAL_DEBUG_I2C_SNAPSHOT_NUM - 1);
+        return NULL;
+    }
+    return &regmap.snapshots[slot];
+}
+
+/**
+ * @brief store the current map into a snapshot slot
+ */
+void serial_debug_i2c_snap(int slot)
+{
+    struct i2c_regmap *snapshot = serial_debug_i2c_snapshot(slot);
+    if (snapshot) {
+        memcpy(snapshot, &regmap.current, sizeof(struct i2c_regmap));
+    }
+}
+
+/**
+ * @brief use a snapshot as the reference for dump and watch
+ */
+void serial_debug_i2c_ref(int slot)
+{
+    struct i2c_regmap *snapshot = serial_debug_i2c_snapshot(slot);
+    if (snapshot) {
+        memcpy(&regmap.reference, snapshot, sizeof(struct i2c_regmap));
+        serial_debug_i2c_regmap_show();
+    }
+}
+
+/**
+ * @brief print registers changed between two snapshots
+ */
+void serial_debug_i2c_diff(int from, int to)
+{
+    struct i2c_regmap *a = serial_debug_i2c_snapshot(from);
+    struct i2c_regmap *b = serial_debug_i2c_snapshot(to);
+    if (a && b) {
+        int changed = serial_debug_i2c_regmap_diff(a, b, true);
+        shellPrint(shellGetCurrent(), changed < 0 ? "range mismatch\r\n" : "%d changed\r\n", changed);
+    }
+}
+
+/**
+ * @brief save a snapshot to file
+ */
+void serial_debug_i2c_snapsave(int slot, const char *path)
+{
+    struct i2c_regmap *snapshot = serial_debug_i2c_snapshot(slot);
+    if (!snapshot || !path || snapshot->len == 0) {
+        return;
+    }
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    size_t size = offsetof(struct i2c_regmap, data) + snapshot->len;
+    if (fwrite(snapshot, 1, size, file) != size) {
+        ESP_LOGE(TAG, "write %s failed", path);
+    }
+    fclose(file);
+}
+
+/**
+ * @brief load a snapshot from file
+ */
+void serial_debug_i2c_snapload(int slot, const char *path)
+{
+    struct i2c_regmap *snapshot = serial_debug_i2c_snapshot(slot);
+    if (!snapshot || !path) {
+        return;
+    }
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    struct i2c_regmap map;
+    size_t size = fread(&map, 1, sizeof(map), file);
+    fclose(file);
+    if (size < offsetof(struct i2c_regmap, data) || map.len == 0
+        || map.start + map.len > SERIAL_DEBUG_I2C_REGMAP_SIZE
+        || size != offsetof(struct i2c_regmap, data) + map.len) {
+        ESP_LOGE(TAG, "invalid snapshot %s", path);
+        return;
+    }
+    memcpy(snapshot, &map, sizeof(map));
+    serial_debug_i2c_regmap_print(snapshot, snapshot);
+}
+
+static inline void serial_debug_i2c_sniff_push(uint32_t edge)
+{
+    size_t tail = __atomic_load_n(&sniff.tail, __ATOMIC_ACQUIRE);
+    if (sniff.head - tail >= SERIAL_DEBUG_I2C_SNIFF_RING_SIZE) {
+        sniff.overruns++;
+        sniff.lost = true;
+        return;
+    }
+    if (sniff.lost) {
+        edge |= PROTOCOL_I2C_SNIFF_GAP;
+        sniff.lost = false;
+    }
+    sniff.ring[sniff.head & (SERIAL_DEBUG_I2C_SNIFF_RING_SIZE - 1)] = edge;
+    __atomic_store_n(&sniff.head, sniff.head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief sample task, pinned to core 0, away from the gui task
+ *
+ * a 400 kHz bus has scl high phases of 0.6 us, shorter than most interrupt
+ * handlers, so the lines are polled inside a critical section. a window is
+ * closed once the bus has been idle for a while, or after 2 ms at most so
+ * that the tick and other interrupts of core 0 are only delayed. pending
+ * interrupts and higher priority tasks run between windows, the pause is
+ * measured and only a pause that may have hidden an edge is counted as a
+ * gap and marked on the next entry. the scheduler gets a tick about once a
+ * second while the bus is idle, lower priority tasks of core 0 only run then
+ */
+static void serial_debug_i2c_sniff_sample_task(void *param)
+{
+    int gpios[] = {info.sda_io, info.scl_io};
+    dedic_gpio_bundle_handle_t bundle = NULL;
+    dedic_gpio_bundle_config_t config = {
+        .gpio_array = gpios,
+        .array_size = 2,
+        .flags.in_en = 1,
+    };
+    uint32_t offset = 0;
+    if (dedic_gpio_new_bundle(&config, &bundle) != ESP_OK) {
+        ESP_LOGE(TAG, "dedicated gpio unavailable");
+        sniff.run = false;
+    } else {
+        dedic_gpio_get_in_offset(bundle, &offset);
+    }
+
+    uint32_t window = SERIAL_DEBUG_I2C_SNIFF_WINDOW_US * sniff.tick_mhz;
+    uint32_t window_max = SERIAL_DEBUG_I2C_SNIFF_WINDOW_MAX_US * sniff.tick_mhz;
+    uint32_t idle = SERIAL_DEBUG_I2C_SNIFF_IDLE_US * sniff.tick_mhz;
+    uint32_t busy_loss = SERIAL_DEBUG_I2C_SNIFF_BUSY_LOSS_NS * sniff.tick_mhz / 1000;
+    const uint32_t lines = PROTOCOL_I2C_SNIFF_SDA | PROTOCOL_I2C_SNIFF_SCL;
+
+    sniff.time_offset = esp_timer_get_time()
+        - (int64_t) ((esp_cpu_get_cycle_count() << PROTOCOL_I2C_SNIFF_TIME_SHIFT) >> PROTOCOL_I2C_SNIFF_TIME_SHIFT)
+          / sniff.tick_mhz;
+    static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t levels = lines;
+    uint32_t closed = esp_cpu_get_cycle_count();
+    bool closed_idle = true;
+    int64_t yielded = esp_timer_get_time();
+    while (sniff.run) {
+        portENTER_CRITICAL(&lock);
+        uint32_t start = esp_cpu_get_cycle_count();
+        uint32_t now = (dedic_gpio_cpu_ll_read_in() >> offset) & lines;
+        /* an idle bus hides no edge for a short pause, a busy one for hardly any */
+        bool gap = start - closed > (closed_idle ? idle : busy_loss) || __builtin_popcount(now ^ levels) > 1;
+        uint32_t changed = start;
+        levels = now;
+        /* one entry per window even without a change, keeps the wrapping time base */
+        serial_debug_i2c_sniff_push(PROTOCOL_I2C_SNIFF_EDGE(start, levels | (gap ? PROTOCOL_I2C_SNIFF_GAP : 0)));
+        while (true) {
+            now = (dedic_gpio_cpu_ll_read_in() >> offset) & lines;
+            uint32_t cycles = esp_cpu_get_cycle_count();
+            if (now != levels) {
+                levels = now;
+                changed = cycles;
+                serial_debug_i2c_sniff_push(PROTOCOL_I2C_SNIFF_EDGE(cycles, levels));
+            } else if (cycles - start > window
+                       && ((levels == lines && cycles - changed > idle) || cycles - start > window_max)) {
+                closed = cycles;
+                break;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+        closed_idle = levels == lines && closed - changed > idle;
+        if (gap) {
+            sniff.gaps++;
+        }
+        int64_t time = esp_timer_get_time();
+        if ((closed_idle && time - yielded > SERIAL_DEBUG_I2C_SNIFF_YIELD_MS * 1000)
+            || time - yielded > SERIAL_DEBUG_I2C_SNIFF_YIELD_MAX_MS * 1000) {
+            vTaskDelay(1);
+            yielded = esp_timer_get_time();
+        }
+    }
+    if (bundle) {
+        dedic_gpio_del_bundle(bundle);
+    }
+    __atomic_fetch_sub(&sniff.tasks, 1, __ATOMIC_RELEASE);
+    vTaskDelete(NULL);
+}
+
+static void serial_debug_i2c_sniff_frame(void *param, const struct protocol_i2c_sniff_frame *frame)
+{
+    bool error = frame->flags & (PROTOCOL_I2C_SNIFF_FLAG_NACK | PROTOCOL_I2C_SNIFF_FLAG_ERROR);
+    int64_t timestamp = frame->timestamp + sniff.time_offset;
+    protocol_capture_write_flags(PROTOCOL_CAPTURE_SOURCE_I2C,
+                                 frame->read ? PROTOCOL_CAPTURE_DIR_RX : PROTOCOL_CAPTURE_DIR_TX, frame->addr,
+                                 PROTOCOL_CAPTURE_FLAG_FRAME | (error ? PROTOCOL_CAPTURE_FLAG_ERROR : 0),
+                                 timestamp, frame->data, frame->len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, frame->read ? PROTOCOL_STATS_RX : PROTOCOL_STATS_TX, frame->len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_FRAMES, 1);
+    if (error) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_I2C, PROTOCOL_STATS_ERRORS, 1);
+    }
+
+    char *text = frame_logs[frame_log_write % SERIAL_DEBUG_I2C_FRAME_LOG_NUM];
+    int pos = snprintf(text, SERIAL_DEBUG_I2C_FRAME_LOG_SIZE, "%s%lld.%03lld %c%02x%s ",
+                       frame->flags & PROTOCOL_I2C_SNIFF_FLAG_ERROR ? "! " : "",
+                       timestamp / 1000000, timestamp / 1000 % 1000,
+                       frame->read ? 'R' : 'W', frame->addr,
+                       frame->flags & PROTOCOL_I2C_SNIFF_FLAG_NACK ? " nack" : "");
+    for (size_t i = 0; i < frame->len && pos < SERIAL_DEBUG_I2C_FRAME_LOG_SIZE - 4; i++) {
+        pos += snprintf(text + pos, SERIAL_DEBUG_I2C_FRAME_LOG_SIZE - pos, "%02x ", frame->data[i]);
+    }
+    text[pos < SERIAL_DEBUG_I2C_FRAME_LOG_SIZE ? pos : SERIAL_DEBUG_I2C_FRAME_LOG_SIZE - 1] = 0;
+    __atomic_store_n(&frame_log_write, frame_log_write + 1, __ATOMIC_RELEASE);
+}
+
+static void serial_debug_i2c_sniff_decode_task(void *param)
+{
+    while (true) {
+        bool run = sniff.run;
+        size_t head = __atomic_load_n(&sniff.head, __ATOMIC_ACQUIRE);
+        while (sniff.tail != head) {
+            size_t index = sniff.tail & (SERIAL_DEBUG_I2C_SNIFF_RING_SIZE - 1);
+            size_t num = SERIAL_DEBUG_I2C_SNIFF_RING_SIZE - index;
+            if (num > head - sniff.tail) {
+                num = head - sniff.tail;
+            }
+            protocol_i2c_sniff_feed(&sniff.decoder, &sniff.ring[index], num, serial_debug_i2c_sniff_frame, NULL);
+            __atomic_store_n(&sniff.tail, sniff.tail + num, __ATOMIC_RELEASE);
+        }
+        if (!run && __atomic_load_n(&sniff.tasks, __ATOMIC_ACQUIRE) == 1) {
+            break;
+        }
+        vTaskDelay(1);
+    }
+    __atomic_fetch_sub(&sniff.tasks, 1, __ATOMIC_RELEASE);
+    vTaskDelete(NULL);
+}
+
+static void serial_debug_i2c_sniff_start(void)
+{
+    sniff.ring = heap_caps_malloc(SERIAL_DEBUG_I2C_SNIFF_RING_SIZE * sizeof(uint32_t),
+                                  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!sniff.ring) {
+        ESP_LOGE(TAG, "malloc failed");
+        return;
+    }
+    regmap.watch_period = 0;
+    serial_debug_i2c_uninstall();
+    gpio_set_direction(info.sda_io, GPIO_MODE_INPUT);
+    gpio_set_direction(info.scl_io, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(info.sda_io, GPIO_FLOATING);
+    gpio_set_pull_mode(info.scl_io, GPIO_FLOATING);
+
+    sniff.head = 0;
+    sniff.tail = 0;
+    sniff.overruns = 0;
+    sniff.gaps = 0;
+    sniff.lost = true; /* the first entry starts the decoder */
+    sniff.tick_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    protocol_i2c_sniff_init(&sniff.decoder, sniff.tick_mhz * 1000000);
+    sniff.run = true;
+    sniff.tasks = 2;
+    xTaskCreatePinnedToCore(serial_debug_i2c_sniff_decode_task, "i2cSniffDecode", 4096, NULL, 3, NULL, 1);
+    xTaskCreatePinnedToCore(serial_debug_i2c_sniff_sample_task, "i2cSniffSample", 2048, NULL,
+                            SERIAL_DEBUG_I2C_SNIFF_PRIORITY, NULL, 0);
+    serial_debug_i2c_update_info();
+}
+
+static void serial_debug_i2c_sniff_stop(void)
+{
+    sniff.run = false;
+    while (__atomic_load_n(&sniff.tasks, __ATOMIC_ACQUIRE) > 0) {
+        vTaskDelay(1);
+    }
+    shellPrint(shellGetCurrent(), "%lu overruns, %lu gaps\r\n",
+               (unsigned long) sniff.overruns, (unsigned long) sniff.gaps);
+    heap_caps_free(sniff.ring);
+    sniff.ring = NULL;
+}
+
+/**
+ * @brief passive sniffer on the sda/scl pins, the master driver is released
+ *        while sniffing
+ *
+ * @param enable 1 start, 0 stop
+ */
+void serial_debug_i2c_sniff(int enable)
+{
+    if (enable && !sniff.ring) {
+        serial_debug_i2c_sniff_start();
+    } else if (!enable && sniff.ring) {
+        serial_debug_i2c_sniff_stop();
+        serial_debug_i2c_install();
+        serial_debug_i2c_update_info();
+    }
+}
+
 static ShellCommand i2c_group[] =
 {
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, speed, serial_debug_i2c_set_speed, 
@@ -171,6 +1109,35 @@ static ShellCommand i2c_group[] =
         send data to i2c device\r\ni2cd send [addr] [data], .data.cmd.signature="q[q"),
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, receive, serial_debug_i2c_receive,
         receive data from i2c device\r\ni2cd receive [len]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, scan, serial_debug_i2c_scan,
+        scan i2c bus and identify devices\r\ni2cd scan),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, script, serial_debug_i2c_script,
+        run i2c script\r\ni2cd script "w 0x40 0xfe; r 0x40 2"\r\n
+        w [addr] [data...]  write, repeated start if bus held\r\n
+        r [addr] [len]      read, repeated start if bus held\r\n
+        p                   stop\r\n
+        d [ms]              delay\r\n
+        poll [addr] [reg] [mask] [value] [timeout ms]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, run, serial_debug_i2c_run,
+        run i2c script file\r\ni2cd run [path]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, dump, serial_debug_i2c_dump,
+        dump registers with a burst read\r\ni2cd dump [addr] [start] [len]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, watch, serial_debug_i2c_watch,
+        refresh the last dump periodically\r\ni2cd watch [period ms, 0 to stop]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, snap, serial_debug_i2c_snap,
+        store the last dump into a snapshot\r\ni2cd snap [slot]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, ref, serial_debug_i2c_ref,
+        use a snapshot as diff reference\r\ni2cd ref [slot]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, diff, serial_debug_i2c_diff,
+        diff two snapshots\r\ni2cd diff [from slot] [to slot]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, snapsave, serial_debug_i2c_snapsave,
+        save a snapshot to file\r\ni2cd snapsave [slot] [path]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, snapload, serial_debug_i2c_snapload,
+        load a snapshot from file\r\ni2cd snapload [slot] [path]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, sniff, serial_debug_i2c_sniff,
+        passive bus sniffer\r\ni2cd sniff [enable]\r\n
+        0 - Stop, back to master\r\n
+        1 - Start),
     SHELL_CMD_GROUP_END()
 };
 SHELL_EXPORT_CMD_GROUP(
@@ -12,6 +12,8 @@
 #include "lvgl.h"
 
 void serial_debug_i2c_init_info(lv_obj_t *label);
+void serial_debug_i2c_init_grid(lv_obj_t *parent);
+void serial_debug_i2c_init_frames(lv_obj_t *list);
 void serial_debug_i2c_deinit_info(void);
 void serial_debug_i2c_init(int sda_pin, int scl_pin);
 void serial_debug_i2c_deinit(void);
@@ -9,14 +9,19 @@
 #include "driver/gpio.h"
 #include "driver/spi_common.h"
 #include "driver/spi_master.h"
+#include "esp_attr.h"
 #include "esp_err.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "freertos/projdefs.h"
+#include "hal/gpio_ll.h"
 #include "hal/uart_types.h"
 #include "sdkconfig.h"
+#include "soc/soc_caps.h"
 #include "shell.h"
 #include "shell_cmd_group.h"
 #include "shell_ext.h"
+#include "stdlib.h"
 #include "string.h"
 #include "core/lv_obj.h"
 #include "core/lv_obj_pos.h"
@@ -31,12 +36,28 @@
 #include "misc/lv_color.h"
 #include "misc/lv_palette.h"
 #include "misc/lv_types.h"
+#include "protocol_capture.h"
 #include "protocol_common.h"
+#include "protocol_prbs.h"
+#include "protocol_stats.h"
+#include "serial_debug_spi_flash.h"
 #include "stdlib/lv_sprintf.h"
 #include "widgets/label/lv_label.h"
 
 #define SERIAL_DEBUG_SPI_PORT CONFIG_PROTOCOL_SERIAL_DEBUG_SPI_PORT
 
+#define SERIAL_DEBUG_SPI_MAX_TRANSFER_SIZE CONFIG_PROTOCOL_SERIAL_DEBUG_SPI_MAX_TRANSFER_SIZE
+#define SERIAL_DEBUG_SPI_QUEUE_SIZE 10
+
+#define SERIAL_DEBUG_SPI_BENCH_BLOCK (SERIAL_DEBUG_SPI_MAX_TRANSFER_SIZE & ~3)
+#define SERIAL_DEBUG_SPI_BENCH_DEPTH 4
+#define SERIAL_DEBUG_SPI_BENCH_KBYTES 1024
+
+#define SERIAL_DEBUG_SPI_CACHE_SIZE 4
+
+#define SERIAL_DEBUG_SPI_MULTILINE_ADDR 0x01
+#define SERIAL_DEBUG_SPI_MULTILINE_CMD  0x02
+
 static const char *TAG = "serial_debug_spi";
 
 static lv_obj_t *spi_info_label = NULL;
@@ -49,38 +70,216 @@ struct spi_info {
     int mio2_io;
     int mio3_io;
     int speed;
-    long data_num_sent;
-    long data_num_received;
+    int actual_khz;
+    int mode;
+    int cs_high;
     int flags;
+    int lines;
+    int multiline;
+    int cmd_bits;
+    int addr_bits;
+    int dummy_bits;
 };
 
 static spi_device_handle_t spi;
 
+/**
+ * @brief cached device, keyed by everything that needs a device re-add
+ */
+struct spi_device_entry {
+    spi_device_handle_t handle;
+    int speed;
+    uint8_t mode;
+    uint8_t cs_high;
+    uint8_t half_duplex;
+    uint32_t used;
+};
+
+static struct spi_device_entry spi_devices[SERIAL_DEBUG_SPI_CACHE_SIZE] = {0};
+static uint32_t spi_device_clock = 0;
+
 static struct spi_info info = {
     .speed = 1000000,
+    .lines = 1,
 };
 
-static void serial_debug_spi_update_info(void)
+static lv_obj_t *spi_mode_buttons = NULL;
+static int spi_mode_shown = 0;
+
+static const char *spi_mode_map[] = {"1-bit", "2-bit", "4-bit", NULL};
+
+/**
+ * @brief transactions are half duplex once phases or more than one data
+ *        line are used, full duplex otherwise
+ */
+static bool serial_debug_spi_half_duplex(void)
+{
+    return info.lines > 1 || info.cmd_bits || info.addr_bits || info.dummy_bits;
+}
+
+static const char *serial_debug_spi_mode_name(void)
+{
+    switch (info.lines) {
+    case 2:
+        return "Dual";
+    case 4:
+        return "Quad";
+    default:
+        return serial_debug_spi_half_duplex() ? "Half duplex" : "Full duplex";
+    }
+}
+
+static void serial_debug_spi_publish_info(const struct protocol_stats_snapshot *snapshot)
 {
     if (spi_info_label) {
-        lv_label_set_text_fmt(spi_info_label, "Speed: %d\n"
+        lv_label_set_text_fmt(spi_info_label, "Speed: %d (actual %d kHz)\n"
+            "Mode %d, CS active %s\n"
+            "Lines: %s, cmd %d/%d, addr %d/%d, dummy %d\n"
             "Data sent: %ld\n"
-            "Data received: %ld\n",
-            info.speed,
-            info.data_num_sent,
-            info.data_num_received);
+            "Data received: %ld\n"
+            "Transfers: %ld (%ld/s)\n"
+            "Errors: %ld",
+            info.speed, info.actual_khz,
+            info.mode, info.cs_high ? "high" : "low",
+            serial_debug_spi_mode_name(),
+            info.cmd_bits, (info.multiline & SERIAL_DEBUG_SPI_MULTILINE_CMD) ? info.lines : 1,
+            info.addr_bits, (info.multiline & SERIAL_DEBUG_SPI_MULTILINE_ADDR) ? info.lines : 1,
+            info.dummy_bits,
+            (long) snapshot->total[PROTOCOL_STATS_TX],
+            (long) snapshot->total[PROTOCOL_STATS_RX],
+            (long) snapshot->total[PROTOCOL_STATS_FRAMES],
+            (long) snapshot->rate[PROTOCOL_STATS_FRAMES],
+            (long) snapshot->total[PROTOCOL_STATS_ERRORS]);
+        if (spi_mode_buttons && spi_mode_shown != info.lines) {
+            lv_buttonmatrix_clear_button_ctrl_all(spi_mode_buttons, LV_BUTTONMATRIX_CTRL_CHECKED);
+            lv_buttonmatrix_set_button_ctrl(spi_mode_buttons, info.lines == 4 ? 2 : info.lines - 1,
+                                            LV_BUTTONMATRIX_CTRL_CHECKED);
+            spi_mode_shown = info.lines;
+        }
+        char flash[48];
+        if (serial_debug_spi_flash_info(flash, sizeof(flash)) > 0) {
+            lv_label_ins_text(spi_info_label, LV_LABEL_POS_LAST, "\n");
+            lv_label_ins_text(spi_info_label, LV_LABEL_POS_LAST, flash);
+        }
     }
 }
 
+static void serial_debug_spi_update_info(void)
+{
+    protocol_stats_invalidate(PROTOCOL_STATS_SOURCE_SPI);
+}
+
 void serial_debug_spi_init_info(lv_obj_t *label)
 {
     spi_info_label = label;
-    serial_debug_spi_update_info();
+    protocol_stats_register(PROTOCOL_STATS_SOURCE_SPI, serial_debug_spi_publish_info);
 }
 
 void serial_debug_spi_deinit_info(void)
 {
+    protocol_stats_register(PROTOCOL_STATS_SOURCE_SPI, NULL);
     spi_info_label = NULL;
+    spi_mode_buttons = NULL;
+}
+
+/*
+ * cs is driven from the transaction callbacks, the cached devices share one
+ * cs pin which the hardware cs signals can not
+ */
+static void IRAM_ATTR serial_debug_spi_cs_low_pre(spi_transaction_t *trans)
+{
+    gpio_ll_set_level(&GPIO, info.cs_io, 0);
+}
+
+static void IRAM_ATTR serial_debug_spi_cs_low_post(spi_transaction_t *trans)
+{
+    gpio_ll_set_level(&GPIO, info.cs_io, 1);
+}
+
+static void IRAM_ATTR serial_debug_spi_cs_high_pre(spi_transaction_t *trans)
+{
+    gpio_ll_set_level(&GPIO, info.cs_io, 1);
+}
+
+static void IRAM_ATTR serial_debug_spi_cs_high_post(spi_transaction_t *trans)
+{
+    gpio_ll_set_level(&GPIO, info.cs_io, 0);
+}
+
+static bool serial_debug_spi_device_match(const struct spi_device_entry *entry)
+{
+    return entry->handle
+        && entry->speed == info.speed
+        && entry->mode == info.mode
+        && entry->cs_high == info.cs_high
+        && entry->half_duplex == serial_debug_spi_half_duplex();
+}
+
+/**
+ * @brief select the device for the current speed, mode, cs polarity and
+ *        duplex, reusing a cached one if possible, the least recently used
+ *        one is removed when the cache is full
+ */
+static esp_err_t serial_debug_spi_select_device(void)
+{
+    struct spi_device_entry *entry = NULL;
+
+    for (int i = 0; i < SERIAL_DEBUG_SPI_CACHE_SIZE; i++) {
+        if (serial_debug_spi_device_match(&spi_devices[i])) {
+            entry = &spi_devices[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        entry = &spi_devices[0];
+        for (int i = 1; i < SERIAL_DEBUG_SPI_CACHE_SIZE && entry->handle; i++) {
+            if (!spi_devices[i].handle || spi_devices[i].used < entry->used) {
+                entry = &spi_devices[i];
+            }
+        }
+        if (entry->handle) {
+            if (entry->handle == spi) {
+                spi = NULL;
+            }
+            spi_bus_remove_device(entry->handle);
+            entry->handle = NULL;
+        }
+        spi_device_interface_config_t dev_conf = {
+            .clock_speed_hz = info.speed,
+            .mode = info.mode,
+            .spics_io_num = -1,
+            .input_delay_ns = 0,
+            .queue_size = SERIAL_DEBUG_SPI_QUEUE_SIZE,
+            .flags = serial_debug_spi_half_duplex() ? SPI_DEVICE_HALFDUPLEX : 0,
+            .pre_cb = info.cs_high ? serial_debug_spi_cs_high_pre : serial_debug_spi_cs_low_pre,
+            .post_cb = info.cs_high ? serial_debug_spi_cs_high_post : serial_debug_spi_cs_low_post,
+        };
+        esp_err_t ret = spi_bus_add_device(SERIAL_DEBUG_SPI_PORT, &dev_conf, &entry->handle);
+        if (ret != ESP_OK) {
+            spi = NULL;
+            return ret;
+        }
+        entry->speed = info.speed;
+        entry->mode = info.mode;
+        entry->cs_high = info.cs_high;
+        entry->half_duplex = serial_debug_spi_half_duplex();
+    }
+    entry->used = ++spi_device_clock;
+    spi = entry->handle;
+    gpio_set_level(info.cs_io, !info.cs_high);
+    spi_device_get_actual_freq(spi, &info.actual_khz);
+    return ESP_OK;
+}
+
+static void serial_debug_spi_remove_devices(void)
+{
+    for (int i = 0; i < SERIAL_DEBUG_SPI_CACHE_SIZE; i++) {
+        if (spi_devices[i].handle) {
+            ESP_ERROR_CHECK(spi_bus_remove_device(spi_devices[i].handle));
+            spi_devices[i].handle = NULL;
+        }
+    }
+    spi = NULL;
 }
 
 void serial_debug_spi_init(int cs_pin, int sclk_pin, int mosi_pin, int miso_pin, int mio2_pin, int mio3_pin)
@@ -105,29 +304,30 @@ void serial_debug_spi_init(int cs_pin, int sclk_pin, int mosi_pin, int miso_pin,
         .miso_io_num = info.miso_io,
         .data2_io_num = info.mio2_io,
         .data3_io_num = info.mio3_io,
-        .max_transfer_sz = 0,
+        .max_transfer_sz = SERIAL_DEBUG_SPI_MAX_TRANSFER_SIZE,
         .intr_flags = ESP_INTR_FLAG_SHARED|ESP_INTR_FLAG_LEVEL3,
     };
-    ESP_ERROR_CHECK(spi_bus_initialize(SERIAL_DEBUG_SPI_PORT, &bus_conf, SPI_DMA_DISABLED));
-    spi_device_interface_config_t dev_conf = {
-        .clock_speed_hz = info.speed,
-        .mode = 0,
-        .spics_io_num = info.cs_io,
-        .input_delay_ns = 0,
-        .queue_size = 10,
-        .pre_cb = NULL,
-        .post_cb = NULL,
-    };
-    ESP_ERROR_CHECK(spi_bus_add_device(SERIAL_DEBUG_SPI_PORT, &dev_conf, &spi));
+    ESP_ERROR_CHECK(spi_bus_initialize(SERIAL_DEBUG_SPI_PORT, &bus_conf, SPI_DMA_CH_AUTO));
+    gpio_set_level(info.cs_io, !info.cs_high);
+    gpio_set_direction(info.cs_io, GPIO_MODE_OUTPUT);
+    ESP_ERROR_CHECK(serial_debug_spi_select_device());
 
     serial_debug_spi_update_info();
 }
 
+/**
+ * @brief current spi device
+ *
+ * @return spi_device_handle_t device handle, NULL if spid is not running
+ */
+spi_device_handle_t serial_debug_spi_get_device(void)
+{
+    return spi;
+}
+
 void serial_debug_spi_deinit(void)
 {
-    if (spi != NULL) {
-        ESP_ERROR_CHECK(spi_bus_remove_device(spi));
-    }
+    serial_debug_spi_remove_devices();
     ESP_ERROR_CHECK(spi_bus_free(SERIAL_DEBUG_SPI_PORT));
     gpio_reset_pin(info.cs_io);
     gpio_reset_pin(info.sclk_io);
@@ -137,21 +337,37 @@ void serial_debug_spi_deinit(void)
     gpio_reset_pin(info.mio3_io);
 }
 
-esp_err_t serial_debug_spi_transmit(uint8_t *data, uint8_t *out, size_t length)
+/**
+ * @brief one transaction with the configured phases and line mode
+ *
+ * in full duplex mode `out` receives while `data` is sent, in half duplex
+ * mode `length` bytes are read after `data` is sent
+ */
+static esp_err_t serial_debug_spi_transfer(uint32_t cmd, uint64_t addr,
+                                           const uint8_t *data, size_t length, uint8_t *out, size_t out_length)
 {
     spi_transaction_ext_t t = {0};
 
-    t.base.length = length * 8;
-    
-    t.base.tx_buffer = data;
+    t.base.flags = info.flags | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_DUMMY;
+    t.base.cmd = cmd;
+    t.base.addr = addr;
+    t.command_bits = info.cmd_bits;
+    t.address_bits = info.addr_bits;
+    t.dummy_bits = info.dummy_bits;
 
+    t.base.length = length * 8;
+    t.base.tx_buffer = length ? data : NULL;
     if (out != NULL) {
         t.base.rx_buffer = out;
+        t.base.rxlength = out_length * 8;
     }
 
-    t.base.flags = info.flags;
+    return spi_device_transmit(spi, (spi_transaction_t *) &t);
+}
 
-    return spi_device_polling_transmit(spi, (spi_transaction_t *) &t);
+esp_err_t serial_debug_spi_transmit(uint8_t *data, uint8_t *out, size_t length)
+{
+    return serial_debug_spi_transfer(0, 0, data, length, out, out ? length : 0);
 }
 
 void serial_debug_spi_write_read(uint8_t *data)
@@ -163,14 +379,327 @@ void serial_debug_spi_write_read(uint8_t *data)
     }
     esp_err_t ret = serial_debug_spi_transmit(data, out, length);
     if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_ERRORS, 1);
         shellPrint(shellGetCurrent(), "spi write read failed");
         heap_caps_free(out);
         return;
     }
+    int64_t timestamp = esp_timer_get_time();
+    protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_SPI, PROTOCOL_CAPTURE_DIR_TX, 0, timestamp, data, length);
+    protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_SPI, PROTOCOL_CAPTURE_DIR_RX, 0, timestamp, out, length);
     ESP_LOG_BUFFER_HEX("spi read", out, length);
     heap_caps_free(out);
-    info.data_num_sent += length;
-    info.data_num_received += length;
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_TX, length);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_RX, length);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_FRAMES, 1);
+}
+
+static void serial_debug_spi_reselect_device(void)
+{
+    if (serial_debug_spi_select_device() != ESP_OK) {
+        ESP_LOGE(TAG, "spi add device failed");
+    }
+    serial_debug_spi_update_info();
+}
+
+/**
+ * @brief set spi clock, the clock is derived by an integer divider so the
+ *        actual one is printed with its error
+ *
+ * @param speed clock in Hz
+ */
+void serial_debug_spi_set_speed(int speed)
+{
+    if (speed <= 0) {
+        shellPrint(shellGetCurrent(), "speed param error\r\n");
+        return;
+    }
+    info.speed = speed;
+    serial_debug_spi_reselect_device();
+    int error = (int) (((int64_t) info.actual_khz * 1000 - speed) * 10000 / speed);
+    shellPrint(shellGetCurrent(), "requested %d Hz, actual %d kHz (%s%d.%02d%%)\r\n",
+               speed, info.actual_khz, error < 0 ? "-" : "+", abs(error) / 100, abs(error) % 100);
+}
+
+/**
+ * @brief set spi mode
+ *
+ * @param mode 0 - 3, cpol and cpha
+ */
+void serial_debug_spi_set_mode(int mode)
+{
+    if (mode < 0 || mode > 3) {
+        shellPrint(shellGetCurrent(), "mode param error\r\n");
+        return;
+    }
+    info.mode = mode;
+    serial_debug_spi_reselect_device();
+}
+
+/**
+ * @brief set cs polarity
+ *
+ * @param active_high 0 active low, 1 active high
+ */
+void serial_debug_spi_set_cs(int active_high)
+{
+    info.cs_high = active_high ? 1 : 0;
+    serial_debug_spi_reselect_device();
+}
+
+/**
+ * @brief set data lines
+ *
+ * dual and quad need mio2/mio3 routed as data2/data3, the device switches to
+ * half duplex since the data lines are bidirectional
+ *
+ * @param lines 1, 2 or 4
+ * @param multiline phases also using the data lines, bit0 address, bit1 command
+ */
+void serial_debug_spi_set_lines(int lines, int multiline)
+{
+    if (lines != 1 && lines != 2 && lines != 4) {
+        ESP_LOGE(TAG, "lines must be 1, 2 or 4");
+        return;
+    }
+    info.lines = lines;
+    info.multiline = lines > 1 ? multiline & (SERIAL_DEBUG_SPI_MULTILINE_ADDR | SERIAL_DEBUG_SPI_MULTILINE_CMD) : 0;
+    info.flags = lines == 2 ? SPI_TRANS_MODE_DIO : lines == 4 ? SPI_TRANS_MODE_QIO : 0;
+    if (info.multiline & SERIAL_DEBUG_SPI_MULTILINE_ADDR) {
+        info.flags |= SPI_TRANS_MULTILINE_ADDR;
+    }
+    if (info.multiline & SERIAL_DEBUG_SPI_MULTILINE_CMD) {
+        info.flags |= SPI_TRANS_MULTILINE_CMD;
+    }
+    serial_debug_spi_reselect_device();
+}
+
+/**
+ * @brief set command, address and dummy phase lengths
+ *
+ * @param cmd_bits command bits, 0 - 16
+ * @param addr_bits address bits, 0 - 64
+ * @param dummy_bits dummy clocks before the read phase
+ */
+void serial_debug_spi_set_phase(int cmd_bits, int addr_bits, int dummy_bits)
+{
+    if (cmd_bits < 0 || cmd_bits > 16 || addr_bits < 0 || addr_bits > 64 || dummy_bits < 0 || dummy_bits > 255) {
+        shellPrint(shellGetCurrent(), "phase param error\r\n");
+        return;
+    }
+    info.cmd_bits = cmd_bits;
+    info.addr_bits = addr_bits;
+    info.dummy_bits = dummy_bits;
+    serial_debug_spi_reselect_device();
+}
+
+static void serial_debug_spi_mode_event(lv_event_t *e)
+{
+    lv_obj_t *buttons = lv_event_get_target(e);
+    static const int lines[] = {1, 2, 4};
+    uint32_t selected = lv_buttonmatrix_get_selected_button(buttons);
+    if (selected < sizeof(lines) / sizeof(lines[0]) && lines[selected] != info.lines) {
+        serial_debug_spi_set_lines(lines[selected], info.multiline);
+    }
+}
+
+void serial_debug_spi_init_mode(lv_obj_t *parent)
+{
+    spi_mode_buttons = lv_buttonmatrix_create(parent);
+    lv_buttonmatrix_set_map(spi_mode_buttons, spi_mode_map);
+    lv_buttonmatrix_set_button_ctrl_all(spi_mode_buttons, LV_BUTTONMATRIX_CTRL_CHECKABLE);
+    lv_buttonmatrix_set_one_checked(spi_mode_buttons, true);
+    spi_mode_shown = 0;
+    lv_obj_set_size(spi_mode_buttons, LV_PCT(100), 48);
+    lv_obj_set_style_text_font(spi_mode_buttons, &lv_font_montserrat_16, LV_PART_ITEMS);
+    lv_obj_add_event_cb(spi_mode_buttons, serial_debug_spi_mode_event, LV_EVENT_VALUE_CHANGED, NULL);
+    serial_debug_spi_update_info();
+}
+
+/**
+ * @brief command read with the configured phases and lines
+ *
+ * @param cmd command
+ * @param addr address
+ * @param length bytes to read
+ */
+void serial_debug_spi_read(int cmd, int addr, int length)
+{
+    if (spi == NULL || length <= 0 || length > SERIAL_DEBUG_SPI_MAX_TRANSFER_SIZE) {
+        shellPrint(shellGetCurrent(), "param error\r\n");
+        return;
+    }
+    if (!serial_debug_spi_half_duplex()) {
+        shellPrint(shellGetCurrent(), "set phases or lines first\r\n");
+        return;
+    }
+    uint8_t *out = heap_caps_malloc(length, MALLOC_CAP_DMA);
+    if (out == NULL) {
+        shellPrint(shellGetCurrent(), "malloc failed\r\n");
+        return;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = serial_debug_spi_transfer(cmd, addr, NULL, 0, out, length);
+    int64_t elapsed = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_ERRORS, 1);
+        shellPrint(shellGetCurrent(), "spi read failed\r\n");
+    } else {
+        protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_SPI, PROTOCOL_CAPTURE_DIR_RX, 0, start, out, length);
+        ESP_LOG_BUFFER_HEX("spi read", out, length > 256 ? 256 : length);
+        shellPrint(shellGetCurrent(), "%d bytes in %lld us\r\n", length, elapsed);
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_RX, length);
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_FRAMES, 1);
+    }
+    heap_caps_free(out);
+}
+
+/**
+ * @brief command write with the configured phases and lines
+ *
+ * @param cmd command
+ * @param addr address
+ * @param data data, may be empty
+ */
+void serial_debug_spi_write(int cmd, int addr, uint8_t *data)
+{
+    int length = data ? shellGetArrayParamSize(data) : 0;
+    if (spi == NULL) {
+        shellPrint(shellGetCurrent(), "spid not running\r\n");
+        return;
+    }
+    if (!serial_debug_spi_half_duplex()) {
+        shellPrint(shellGetCurrent(), "set phases or lines first\r\n");
+        return;
+    }
+    esp_err_t ret = serial_debug_spi_transfer(cmd, addr, data, length, NULL, 0);
+    if (ret != ESP_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_ERRORS, 1);
+        shellPrint(shellGetCurrent(), "spi write failed\r\n");
+        return;
+    }
+    protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_SPI, PROTOCOL_CAPTURE_DIR_TX, 0,
+                           esp_timer_get_time(), data, length);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_TX, length);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_FRAMES, 1);
+}
+
+static const int bench_speeds[] = {
+    1000000, 5000000, 10000000, 20000000, 40000000,
+};
+
+struct spi_bench_slot {
+    spi_transaction_t trans;
+    uint8_t *tx;
+    uint8_t *rx;
+};
+
+/**
+ * @brief loopback benchmark, mosi must be wired to miso or to a target echoing
+ *        data in the same transaction
+ *
+ * transactions of the max transfer size are queued back to back from dma
+ * capable buffers, the next block is generated and the last one checked while
+ * the queued ones are on the bus
+ *
+ * @param max_speed max clock of the sweep
+ * @param kbytes data length of each clock in kbytes
+ */
+void serial_debug_spi_bench(int max_speed, int kbytes)
+{
+    struct spi_bench_slot slots[SERIAL_DEBUG_SPI_BENCH_DEPTH] = {0};
+    struct protocol_prbs generator, checker;
+    struct protocol_prbs_result result;
+    struct protocol_cpu_load load;
+    int percent[portNUM_PROCESSORS];
+    int speed = info.speed;
+
+    if (spi == NULL) {
+        shellPrint(shellGetCurrent(), "spid not running\r\n");
+        return;
+    }
+    if (serial_debug_spi_half_duplex()) {
+        shellPrint(shellGetCurrent(), "bench needs full duplex, run spid lines 1 and spid phase 0 0 0\r\n");
+        return;
+    }
+    for (int i = 0; i < SERIAL_DEBUG_SPI_BENCH_DEPTH; i++) {
+        slots[i].tx = heap_caps_malloc(SERIAL_DEBUG_SPI_BENCH_BLOCK, MALLOC_CAP_DMA);
+        slots[i].rx = heap_caps_malloc(SERIAL_DEBUG_SPI_BENCH_BLOCK, MALLOC_CAP_DMA);
+        if (!slots[i].tx || !slots[i].rx) {
+            shellPrint(shellGetCurrent(), "malloc failed\r\n");
+            goto exit;
+        }
+    }
+    if (max_speed <= 0) {
+        max_speed = bench_speeds[sizeof(bench_speeds) / sizeof(bench_speeds[0]) - 1];
+    }
+    if (kbytes <= 0) {
+        kbytes = SERIAL_DEBUG_SPI_BENCH_KBYTES;
+    }
+    size_t total = kbytes * 1024;
+    shellPrint(shellGetCurrent(), "%d byte transactions, %d queued\r\n",
+               SERIAL_DEBUG_SPI_BENCH_BLOCK, SERIAL_DEBUG_SPI_BENCH_DEPTH);
+    for (int i = 0; i < sizeof(bench_speeds) / sizeof(bench_speeds[0]) && bench_speeds[i] <= max_speed; i++) {
+        size_t sent = 0;
+        int queued = 0;
+        int index = 0;
+        esp_err_t ret = ESP_OK;
+
+        serial_debug_spi_set_speed(bench_speeds[i]);
+        protocol_prbs_init(&generator, PROTOCOL_PRBS_DEFAULT_SEED);
+        protocol_prbs_init(&checker, PROTOCOL_PRBS_DEFAULT_SEED);
+        protocol_prbs_result_init(&result);
+        protocol_cpu_load_start(&load);
+        int64_t start = esp_timer_get_time();
+        while (result.bytes < total) {
+            while (queued < SERIAL_DEBUG_SPI_BENCH_DEPTH && sent < total && ret == ESP_OK) {
+                struct spi_bench_slot *slot = &slots[index++ % SERIAL_DEBUG_SPI_BENCH_DEPTH];
+                size_t len = total - sent > SERIAL_DEBUG_SPI_BENCH_BLOCK ? SERIAL_DEBUG_SPI_BENCH_BLOCK : total - sent;
+                protocol_prbs_fill(&generator, slot->tx, len);
+                slot->trans.length = len * 8;
+                slot->trans.tx_buffer = slot->tx;
+                slot->trans.rx_buffer = slot->rx;
+                ret = spi_device_queue_trans(spi, &slot->trans, portMAX_DELAY);
+                if (ret == ESP_OK) {
+                    sent += len;
+                    queued++;
+                }
+            }
+            if (queued == 0) {
+                break;
+            }
+            spi_transaction_t *trans;
+            if (spi_device_get_trans_result(spi, &trans, portMAX_DELAY) != ESP_OK) {
+                ret = ESP_FAIL;
+                break;
+            }
+            queued--;
+            protocol_prbs_check(&checker, trans->rx_buffer, trans->length / 8, &result);
+        }
+        int64_t elapsed = esp_timer_get_time() - start;
+        protocol_cpu_load_get(&load, percent);
+        if (ret != ESP_OK) {
+            protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_ERRORS, 1);
+        }
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_TX, result.bytes);
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_RX, result.bytes);
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_FRAMES, index);
+
+        int rate = elapsed > 0 ? (int) (result.bytes * 1000000 / elapsed) : 0;
+        shellPrint(shellGetCurrent(), "%8d Hz: %d.%03d MB/s (%d%% of line rate), cpu %d%%/%d%%, "
+                   "bit errors %llu/%llu (%.2e), first mismatch %lld\r\n",
+                   bench_speeds[i], rate / 1000000, rate / 1000 % 1000,
+                   (int) ((int64_t) rate * 800 / bench_speeds[i]), percent[0], percent[1],
+                   result.bit_errors, result.bytes * 8,
+                   result.bytes ? (double) result.bit_errors / (result.bytes * 8) : 0.0,
+                   result.first_error);
+    }
+    serial_debug_spi_set_speed(speed);
+exit:
+    for (int i = 0; i < SERIAL_DEBUG_SPI_BENCH_DEPTH; i++) {
+        heap_caps_free(slots[i].tx);
+        heap_caps_free(slots[i].rx);
+    }
 }
 
 
@@ -178,6 +707,22 @@ static ShellCommand spi_group[] =
 {
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, write_read, serial_debug_spi_write_read,
         write and read data for spi device\r\nspid write_read [data], .data.cmd.signature="[q"),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, speed, serial_debug_spi_set_speed,
+        set spi clock\r\nspid speed [speed]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, mode, serial_debug_spi_set_mode,
+        set spi mode\r\nspid mode [0-3]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, cs, serial_debug_spi_set_cs,
+        set cs polarity\r\nspid cs [0 active low/1 active high]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, lines, serial_debug_spi_set_lines,
+        set data lines\r\nspid lines [1/2/4] [multiline: 0 data, 1 addr and data, 3 cmd, addr and data]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, phase, serial_debug_spi_set_phase,
+        set command, address and dummy bits\r\nspid phase [cmd bits] [addr bits] [dummy bits]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, read, serial_debug_spi_read,
+        command read\r\nspid read [cmd] [addr] [length]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, write, serial_debug_spi_write,
+        command write\r\nspid write [cmd] [addr] [data], .data.cmd.signature="ii[q"),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, bench, serial_debug_spi_bench,
+        loopback prbs benchmark, mosi wired to miso\r\nspid bench [max speed] [kbytes]),
     SHELL_CMD_GROUP_END()
 };
 SHELL_EXPORT_CMD_GROUP(
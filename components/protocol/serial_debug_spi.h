@@ -9,11 +9,14 @@
 #ifndef __SERIAL_DEBUG_SPI_H__
 #define __SERIAL_DEBUG_SPI_H__
 
+#include "driver/spi_master.h"
 #include "lvgl.h"
 
 void serial_debug_spi_init_info(lv_obj_t *label);
+void serial_debug_spi_init_mode(lv_obj_t *parent);
 void serial_debug_spi_deinit_info(void);
 void serial_debug_spi_init(int cs_pin, int sclk_pin, int mosi_pin, int miso_pin, int mio2_pin, int mio3_pin);
 void serial_debug_spi_deinit(void);
+spi_device_handle_t serial_debug_spi_get_device(void);
 
 #endif /* __SERIAL_DEBUG_SPI_H__ */ 
\ No newline at end of file
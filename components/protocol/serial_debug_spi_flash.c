@@ -0,0 +1,476 @@
+/**
+ * @file serial_debug_spi_flash.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief serial debug spi nor flash tool
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * reads stream through two dma buffers, one on the bus while the other is
+ * written to or compared with the file; programming reads the next sector
+ * from the file while the current one is erasing
+ */
+#include "driver/spi_master.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "stdio.h"
+#include "string.h"
+#include "protocol_spi_flash.h"
+#include "protocol_stats.h"
+#include "serial_debug_spi.h"
+#include "serial_debug_spi_flash.h"
+
+#define SERIAL_DEBUG_SPI_FLASH_CHUNK (CONFIG_PROTOCOL_SERIAL_DEBUG_SPI_MAX_TRANSFER_SIZE & ~3)
+#define SERIAL_DEBUG_SPI_FLASH_DEFAULT_PATH "/spiflash/flash.bin"
+
+static const char *TAG = "spi_flash";
+
+static struct protocol_spi_flash flash = {0};
+
+static struct {
+    const char *op;
+    uint32_t done;
+    uint32_t total;
+    int64_t start;
+} progress = {0};
+
+typedef int (*serial_debug_spi_flash_sink_t)(void *param, const uint8_t *data, size_t len);
+
+static void serial_debug_spi_flash_trans(spi_transaction_ext_t *t, const struct protocol_spi_flash_op *op,
+                                         uint8_t *rx, size_t rx_len)
+{
+    memset(t, 0, sizeof(*t));
+    t->base.flags = SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_ADDR;
+    t->base.cmd = op->cmd;
+    t->base.addr = op->addr;
+    t->command_bits = 8;
+    t->address_bits = op->addr_bytes * 8;
+    if (op->tx_len) {
+        t->base.length = op->tx_len * 8;
+        t->base.tx_buffer = op->tx;
+    } else if (rx_len) {
+        t->base.length = rx_len * 8;
+        t->base.rxlength = rx_len * 8;
+        t->base.rx_buffer = rx;
+    }
+}
+
+/**
+ * @brief one flash command as one spi transaction, dummy cycles are clocked
+ *        as extra rx bytes and dropped
+ */
+static int serial_debug_spi_flash_transfer(void *ctx, const struct protocol_spi_flash_op *op)
+{
+    spi_device_handle_t spi = serial_debug_spi_get_device();
+    size_t dummy = op->dummy_cycles / 8;
+    uint8_t *temp = NULL;
+    spi_transaction_ext_t t;
+
+    if (!spi) {
+        return -1;
+    }
+    if (dummy && op->rx_len) {
+        temp = heap_caps_malloc(op->rx_len + dummy, MALLOC_CAP_DMA);
+        if (!temp) {
+            return -1;
+        }
+        serial_debug_spi_flash_trans(&t, op, temp, op->rx_len + dummy);
+    } else {
+        serial_debug_spi_flash_trans(&t, op, op->rx, op->rx_len);
+    }
+    esp_err_t ret = spi_device_transmit(spi, (spi_transaction_t *) &t);
+    if (temp) {
+        memcpy(op->rx, temp + dummy, op->rx_len);
+        heap_caps_free(temp);
+    }
+    return ret == ESP_OK ? 0 : -1;
+}
+
+static uint32_t serial_debug_spi_flash_delay(void *ctx, uint32_t us)
+{
+    if (us >= 1000) {
+        vTaskDelay(1);
+        return portTICK_PERIOD_MS * 1000;
+    }
+    esp_rom_delay_us(us);
+    return us;
+}
+
+static const struct protocol_spi_flash_io flash_io = {
+    .transfer = serial_debug_spi_flash_transfer,
+    .delay = serial_debug_spi_flash_delay,
+    .max_transfer = SERIAL_DEBUG_SPI_FLASH_CHUNK,
+};
+
+/**
+ * @brief progress line for the spi tab
+ *
+ * @return int text length, 0 if no flash operation ran
+ */
+int serial_debug_spi_flash_info(char *text, size_t size)
+{
+    if (!progress.op || progress.total == 0) {
+        return 0;
+    }
+    int64_t elapsed = esp_timer_get_time() - progress.start;
+    return snprintf(text, size, "Flash %s: %lu%% %lu KB/s", progress.op,
+                    (unsigned long) ((uint64_t) progress.done * 100 / progress.total),
+                    (unsigned long) (elapsed > 0 ? (int64_t) progress.done * 1000 / 1024 * 1000 / elapsed : 0));
+}
+
+static void serial_debug_spi_flash_progress(const char *op, uint32_t done, uint32_t total)
+{
+    if (op) {
+        progress.op = op;
+        progress.total = total;
+        progress.start = esp_timer_get_time();
+    }
+    progress.done = done;
+    protocol_stats_invalidate(PROTOCOL_STATS_SOURCE_SPI);
+}
+
+static void serial_debug_spi_flash_report(const char *op, uint32_t bytes, int ret)
+{
+    int64_t elapsed = esp_timer_get_time() - progress.start;
+    int rate = elapsed > 0 ? (int) ((int64_t) bytes * 1000000 / elapsed) : 0;
+    shellPrint(shellGetCurrent(), "%s %lu bytes in %lld ms, %d.%03d MB/s%s\r\n",
+               op, (unsigned long) bytes, elapsed / 1000, rate / 1000000, rate / 1000 % 1000,
+               ret == PROTOCOL_SPI_FLASH_OK ? "" : ", failed");
+}
+
+static bool serial_debug_spi_flash_open(void)
+{
+    int ret = protocol_spi_flash_probe(&flash, &flash_io);
+    if (ret != PROTOCOL_SPI_FLASH_OK) {
+        shellPrint(shellGetCurrent(), "no flash found (%d)\r\n", ret);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief queue the next chunk of a stream into a buffer
+ *
+ * @return uint32_t queued length, 0 if nothing left or queueing failed
+ */
+static uint32_t serial_debug_spi_flash_queue(spi_transaction_ext_t *trans, uint8_t *buffer,
+                                             uint32_t addr, uint32_t remain)
+{
+    struct protocol_spi_flash_op op;
+    uint32_t len = remain > SERIAL_DEBUG_SPI_FLASH_CHUNK ? SERIAL_DEBUG_SPI_FLASH_CHUNK : remain;
+
+    if (len == 0) {
+        return 0;
+    }
+    protocol_spi_flash_read_op(&flash, addr, buffer, len, &op);
+    serial_debug_spi_flash_trans(trans, &op, buffer, len);
+    return spi_device_queue_trans(serial_debug_spi_get_device(), (spi_transaction_t *) trans,
+                                  portMAX_DELAY) == ESP_OK ? len : 0;
+}
+
+/**
+ * @brief stream a range through two dma buffers, the sink runs on one buffer
+ *        while the next transaction fills the other
+ */
+static int serial_debug_spi_flash_stream(uint32_t addr, uint32_t total,
+                                         serial_debug_spi_flash_sink_t sink, void *param)
+{
+    spi_device_handle_t spi = serial_debug_spi_get_device();
+    spi_transaction_ext_t trans[2];
+    uint8_t *buffers[2];
+    uint32_t queued = 0;
+    uint32_t done = 0;
+    int inflight = 0;
+    int ret = PROTOCOL_SPI_FLASH_OK;
+
+    buffers[0] = heap_caps_malloc(SERIAL_DEBUG_SPI_FLASH_CHUNK, MALLOC_CAP_DMA);
+    buffers[1] = heap_caps_malloc(SERIAL_DEBUG_SPI_FLASH_CHUNK, MALLOC_CAP_DMA);
+    if (!spi || !buffers[0] || !buffers[1]) {
+        ret = PROTOCOL_SPI_FLASH_ERR_IO;
+        goto exit;
+    }
+    for (int i = 0; i < 2; i++) {
+        uint32_t len = serial_debug_spi_flash_queue(&trans[i], buffers[i], addr + queued, total - queued);
+        queued += len;
+        inflight += len ? 1 : 0;
+    }
+    while (inflight > 0) {
+        spi_transaction_t *result;
+        if (spi_device_get_trans_result(spi, &result, portMAX_DELAY) != ESP_OK) {
+            ret = PROTOCOL_SPI_FLASH_ERR_IO;
+            break;
+        }
+        inflight--;
+        uint32_t len = result->length / 8;
+        if (ret == PROTOCOL_SPI_FLASH_OK && sink(param, result->rx_buffer, len) != 0) {
+            ret = PROTOCOL_SPI_FLASH_ERR_IO;
+        }
+        done += len;
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_RX, len);
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_FRAMES, 1);
+        serial_debug_spi_flash_progress(NULL, done, total);
+        if (ret == PROTOCOL_SPI_FLASH_OK && queued < total) {
+            /* the sink is done with this buffer, refill it while the other one is on the bus */
+            spi_transaction_ext_t *next = (spi_transaction_ext_t *) result;
+            len = serial_debug_spi_flash_queue(next, (uint8_t *) result->rx_buffer, addr + queued, total - queued);
+            if (len == 0) {
+                ret = PROTOCOL_SPI_FLASH_ERR_IO;
+            }
+            queued += len;
+            inflight += len ? 1 : 0;
+        }
+    }
+    if (ret == PROTOCOL_SPI_FLASH_OK && done < total) {
+        ret = PROTOCOL_SPI_FLASH_ERR_IO;
+    }
+exit:
+    if (ret != PROTOCOL_SPI_FLASH_OK) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_ERRORS, 1);
+    }
+    heap_caps_free(buffers[0]);
+    heap_caps_free(buffers[1]);
+    return ret;
+}
+
+static int serial_debug_spi_flash_write_sink(void *param, const uint8_t *data, size_t len)
+{
+    return fwrite(data, 1, len, (FILE *) param) == len ? 0 : -1;
+}
+
+struct spi_flash_verify {
+    FILE *file;
+    uint8_t *buffer;
+    uint32_t offset;
+    uint32_t mismatches;
+    int64_t first_mismatch;
+};
+
+static int serial_debug_spi_flash_verify_sink(void *param, const uint8_t *data, size_t len)
+{
+    struct spi_flash_verify *verify = param;
+    if (fread(verify->buffer, 1, len, verify->file) != len) {
+        return -1;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (verify->buffer[i] != data[i]) {
+            if (verify->mismatches++ == 0) {
+                verify->first_mismatch = verify->offset + i;
+            }
+        }
+    }
+    verify->offset += len;
+    return 0;
+}
+
+static long serial_debug_spi_flash_file_size(FILE *file)
+{
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    return size;
+}
+
+static int serial_debug_spi_flash_verify_file(FILE *file, uint32_t addr, uint32_t len)
+{
+    struct spi_flash_verify verify = {
+        .file = file,
+        .buffer = heap_caps_malloc(SERIAL_DEBUG_SPI_FLASH_CHUNK, MALLOC_CAP_DEFAULT),
+        .first_mismatch = -1,
+    };
+    if (!verify.buffer) {
+        return PROTOCOL_SPI_FLASH_ERR_IO;
+    }
+    serial_debug_spi_flash_progress("verify", 0, len);
+    int ret = serial_debug_spi_flash_stream(addr, len, serial_debug_spi_flash_verify_sink, &verify);
+    serial_debug_spi_flash_report("verify", len, ret);
+    shellPrint(shellGetCurrent(), "%lu mismatches, first at %lld\r\n",
+               (unsigned long) verify.mismatches, verify.first_mismatch);
+    heap_caps_free(verify.buffer);
+    return ret == PROTOCOL_SPI_FLASH_OK && verify.mismatches ? PROTOCOL_SPI_FLASH_ERR_IO : ret;
+}
+
+/**
+ * @brief identify the flash
+ */
+void serial_debug_spi_flash_probe(void)
+{
+    if (serial_debug_spi_flash_open()) {
+        shellPrint(shellGetCurrent(), "jedec id %06lx, %lu KB, %d byte address, erase 0x%02x, sfdp %s\r\n",
+                   (unsigned long) flash.jedec_id, (unsigned long) flash.size / 1024,
+                   flash.addr_bytes, flash.erase_cmd, flash.sfdp ? "yes" : "no");
+    }
+}
+
+/**
+ * @brief read the flash into a file
+ *
+ * @param path file path
+ * @param size bytes to read, 0 for the whole chip
+ */
+void serial_debug_spi_flash_read(const char *path, int size)
+{
+    if (!serial_debug_spi_flash_open()) {
+        return;
+    }
+    path = path ? path : SERIAL_DEBUG_SPI_FLASH_DEFAULT_PATH;
+    uint32_t total = size > 0 && size < flash.size ? size : flash.size;
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    serial_debug_spi_flash_progress("read", 0, total);
+    int ret = serial_debug_spi_flash_stream(0, total, serial_debug_spi_flash_write_sink, file);
+    fclose(file);
+    serial_debug_spi_flash_report("read", total, ret);
+}
+
+/**
+ * @brief compare the flash with a file
+ */
+void serial_debug_spi_flash_verify(const char *path, int addr)
+{
+    if (!serial_debug_spi_flash_open()) {
+        return;
+    }
+    path = path ? path : SERIAL_DEBUG_SPI_FLASH_DEFAULT_PATH;
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    long size = serial_debug_spi_flash_file_size(file);
+    if (addr < 0 || size <= 0 || addr + size > flash.size) {
+        shellPrint(shellGetCurrent(), "file does not fit\r\n");
+    } else {
+        serial_debug_spi_flash_verify_file(file, addr, size);
+    }
+    fclose(file);
+}
+
+/**
+ * @brief erase sectors
+ *
+ * @param addr start address, rounded down to a sector
+ * @param len bytes, rounded up to sectors
+ */
+void serial_debug_spi_flash_erase(int addr, int len)
+{
+    if (!serial_debug_spi_flash_open()) {
+        return;
+    }
+    if (addr < 0 || len <= 0 || addr + len > flash.size) {
+        shellPrint(shellGetCurrent(), "range error\r\n");
+        return;
+    }
+    uint32_t start = addr & ~(PROTOCOL_SPI_FLASH_SECTOR_SIZE - 1);
+    uint32_t end = addr + len;
+    int ret = PROTOCOL_SPI_FLASH_OK;
+    serial_debug_spi_flash_progress("erase", 0, end - start);
+    for (uint32_t sector = start; sector < end && ret == PROTOCOL_SPI_FLASH_OK;
+         sector += PROTOCOL_SPI_FLASH_SECTOR_SIZE) {
+        ret = protocol_spi_flash_erase_sector(&flash, sector);
+        serial_debug_spi_flash_progress(NULL, sector + PROTOCOL_SPI_FLASH_SECTOR_SIZE - start, end - start);
+    }
+    serial_debug_spi_flash_report("erase", end - start, ret);
+}
+
+/**
+ * @brief erase, program and verify a file, the next sector is read from the
+ *        file while the current one is erasing, blank pages are skipped
+ *
+ * @param path file path
+ * @param addr flash address, sector aligned
+ */
+void serial_debug_spi_flash_write(const char *path, int addr)
+{
+    uint8_t *sectors[2] = {0};
+    int ret = PROTOCOL_SPI_FLASH_OK;
+
+    if (!serial_debug_spi_flash_open()) {
+        return;
+    }
+    if (addr < 0 || (addr & (PROTOCOL_SPI_FLASH_SECTOR_SIZE - 1))) {
+        shellPrint(shellGetCurrent(), "address must be sector aligned\r\n");
+        return;
+    }
+    path = path ? path : SERIAL_DEBUG_SPI_FLASH_DEFAULT_PATH;
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return;
+    }
+    long size = serial_debug_spi_flash_file_size(file);
+    if (size <= 0 || addr + size > flash.size) {
+        shellPrint(shellGetCurrent(), "file does not fit\r\n");
+        goto exit;
+    }
+    sectors[0] = heap_caps_malloc(PROTOCOL_SPI_FLASH_SECTOR_SIZE, MALLOC_CAP_DMA);
+    sectors[1] = heap_caps_malloc(PROTOCOL_SPI_FLASH_SECTOR_SIZE, MALLOC_CAP_DMA);
+    if (!sectors[0] || !sectors[1]) {
+        ESP_LOGE(TAG, "malloc failed");
+        goto exit;
+    }
+
+    serial_debug_spi_flash_progress("write", 0, size);
+    size_t len = fread(sectors[0], 1, PROTOCOL_SPI_FLASH_SECTOR_SIZE, file);
+    for (uint32_t offset = 0; len > 0 && ret == PROTOCOL_SPI_FLASH_OK; offset += PROTOCOL_SPI_FLASH_SECTOR_SIZE) {
+        uint8_t *data = sectors[0];
+        ret = protocol_spi_flash_erase_start(&flash, addr + offset);
+        size_t next = fread(sectors[1], 1, PROTOCOL_SPI_FLASH_SECTOR_SIZE, file);
+        if (ret == PROTOCOL_SPI_FLASH_OK) {
+            ret = protocol_spi_flash_erase_wait(&flash);
+        }
+        for (size_t page = 0; page < len && ret == PROTOCOL_SPI_FLASH_OK; page += PROTOCOL_SPI_FLASH_PAGE_SIZE) {
+            size_t page_len = len - page > PROTOCOL_SPI_FLASH_PAGE_SIZE ? PROTOCOL_SPI_FLASH_PAGE_SIZE : len - page;
+            bool blank = true;
+            for (size_t i = 0; i < page_len && blank; i++) {
+                blank = data[page + i] == 0xFF;
+            }
+            if (!blank) {
+                ret = protocol_spi_flash_program(&flash, addr + offset + page, data + page, page_len);
+                protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_TX, page_len);
+            }
+        }
+        serial_debug_spi_flash_progress(NULL, offset + len, size);
+        sectors[0] = sectors[1];
+        sectors[1] = data;
+        len = next;
+    }
+    serial_debug_spi_flash_report("write", size, ret);
+    if (ret == PROTOCOL_SPI_FLASH_OK) {
+        fseek(file, 0, SEEK_SET);
+        serial_debug_spi_flash_verify_file(file, addr, size);
+    } else {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_SPI, PROTOCOL_STATS_ERRORS, 1);
+    }
+exit:
+    heap_caps_free(sectors[0]);
+    heap_caps_free(sectors[1]);
+    fclose(file);
+}
+
+static ShellCommand spi_flash_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, probe, serial_debug_spi_flash_probe,
+        read jedec id and sfdp\r\nspiflash probe),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, read, serial_debug_spi_flash_read,
+        read flash to file\r\nspiflash read [path] [size, 0 for all]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, write, serial_debug_spi_flash_write,
+        erase, program and verify from file\r\nspiflash write [path] [addr]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, verify, serial_debug_spi_flash_verify,
+        compare flash with file\r\nspiflash verify [path] [addr]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, erase, serial_debug_spi_flash_erase,
+        erase sectors\r\nspiflash erase [addr] [len]),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+spiflash, spi_flash_group, spi nor flash tool);
@@ -0,0 +1,16 @@
+/**
+ * @file serial_debug_spi_flash.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief serial debug spi nor flash tool
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __SERIAL_DEBUG_SPI_FLASH_H__
+#define __SERIAL_DEBUG_SPI_FLASH_H__
+
+#include <stddef.h>
+
+int serial_debug_spi_flash_info(char *text, size_t size);
+
+#endif /* __SERIAL_DEBUG_SPI_FLASH_H__ */
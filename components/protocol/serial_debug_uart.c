@@ -7,13 +7,20 @@
  * @copyright (c) 2024 Letter All rights reserved.
  */
 #include "driver/gpio.h"
+#include "esp_heap_caps.h"
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 #include "freertos/projdefs.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/stream_buffer.h"
+#include "hal/uart_ll.h"
 #include "hal/uart_types.h"
 #include "sdkconfig.h"
 #include "shell.h"
 #include "shell_cmd_group.h"
 #include "shell_ext.h"
+#include "stdio.h"
 #include "string.h"
 #include "core/lv_obj.h"
 #include "core/lv_obj_pos.h"
@@ -29,10 +36,17 @@
 #include "misc/lv_color.h"
 #include "misc/lv_palette.h"
 #include "misc/lv_types.h"
+#include "protocol_autobaud.h"
+#include "protocol_capture.h"
 #include "protocol_common.h"
+#include "protocol_decoder.h"
+#include "protocol_prbs.h"
+#include "protocol_ring.h"
+#include "protocol_stats.h"
+#include "serial_debug_uart_trigger.h"
+#include "usb_device.h"
 #include "stdlib/lv_sprintf.h"
 #include "widgets/label/lv_label.h"
-#include "cpost.h"
 
 #define SERIAL_DEBUG_UART_PORT CONFIG_PROTOCOL_SERIAL_DEBUG_UART_PORT
 
@@ -40,10 +54,48 @@
 
 #define SERIAL_DEBUG_UART_MODE_NORMAL 0
 #define SERIAL_DEBUG_UART_MODE_CONSOLE 1
+#define SERIAL_DEBUG_UART_MODE_CAPTURE 2
+#define SERIAL_DEBUG_UART_MODE_BRIDGE 3
+#define SERIAL_DEBUG_UART_MODE_BENCH 4
+
+#define SERIAL_DEBUG_UART_RX_BUF_SIZE CONFIG_PROTOCOL_SERIAL_DEBUG_UART_RX_BUF_SIZE
+#define SERIAL_DEBUG_UART_EVENT_QUEUE_SIZE 32
+#define SERIAL_DEBUG_UART_CAPTURE_SIZE (CONFIG_PROTOCOL_SERIAL_DEBUG_UART_CAPTURE_SIZE * 1024)
+#define SERIAL_DEBUG_UART_CAPTURE_CHUNK_SIZE 64
+#define SERIAL_DEBUG_UART_RX_FULL_THRESH 64
+#define SERIAL_DEBUG_UART_TX_BUF_SIZE 4096
+#define SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE 2048
+#define SERIAL_DEBUG_UART_RX_TIMEOUT_DEFAULT 10
+#define SERIAL_DEBUG_UART_RX_TIMEOUT_BRIDGE 2
+#define SERIAL_DEBUG_UART_RX_TIMEOUT_MODBUS 2
+#define SERIAL_DEBUG_UART_CONSOLE_BUF_SIZE 256
+#define SERIAL_DEBUG_UART_CONSOLE_BATCH_SIZE 512
+#define SERIAL_DEBUG_UART_CONSOLE_FLUSH_TIME 10000
+#define SERIAL_DEBUG_UART_FRAME_LOG_NUM 16
+#define SERIAL_DEBUG_UART_FRAME_LOG_SIZE 64
+#define SERIAL_DEBUG_UART_FRAME_LIST_MAX 32
+#define SERIAL_DEBUG_UART_AUTOBAUD_WINDOW 500
+#define SERIAL_DEBUG_UART_PLAY_STREAM_SIZE 16384
+#define SERIAL_DEBUG_UART_PLAY_READ_SIZE 4096
+#define SERIAL_DEBUG_UART_PLAY_RECORD_SIZE 1024
+#define SERIAL_DEBUG_UART_PLAY_SPIN_TIME 20000
+#define SERIAL_DEBUG_UART_PLAY_JITTER_LIMIT 100
+
+#define SERIAL_DEBUG_UART_BENCH_BLOCK 1024
+#define SERIAL_DEBUG_UART_BENCH_AHEAD 2048
+#define SERIAL_DEBUG_UART_BENCH_KBYTES 64
+
+#define SERIAL_DEBUG_UART_PLAY_FILTER_ALL 0
+#define SERIAL_DEBUG_UART_PLAY_FILTER_RX 1
+#define SERIAL_DEBUG_UART_PLAY_FILTER_TX 2
+#define SERIAL_DEBUG_UART_AUTOBAUD_MIN_EDGES 16
+#define SERIAL_DEBUG_UART_AUTOBAUD_PULSE_MAX 0xFFF
+#define SERIAL_DEBUG_UART_AUTOBAUD_EDGE_NUM 256
 
 static const char *TAG = "serial_debug_uart";
 
 static lv_obj_t *uart_info_label = NULL;
+static lv_obj_t *uart_frame_list = NULL;
 
 struct uart_info {
     bool run;
@@ -53,13 +105,35 @@ struct uart_info {
     int rx_io;
     int rts_io;
     int cts_io;
-    long data_num_sent;
-    long data_num_received;
+    int decoder_type;
+    long latency_avg;
+    long latency_max;
 };
 
 static struct uart_info info = {0};
 
-static void serial_debug_uart_update_info(void)
+static const char *uart_mode_name[] = {
+    [SERIAL_DEBUG_UART_MODE_NORMAL] = "Normal",
+    [SERIAL_DEBUG_UART_MODE_CONSOLE] = "Console",
+    [SERIAL_DEBUG_UART_MODE_CAPTURE] = "Capture",
+    [SERIAL_DEBUG_UART_MODE_BRIDGE] = "Bridge",
+    [SERIAL_DEBUG_UART_MODE_BENCH] = "Bench",
+};
+
+static QueueHandle_t uart_queue = NULL;
+
+static struct protocol_ring capture_ring = {0};
+
+static struct protocol_decoder decoder = {0};
+
+/**
+ * @brief decoded frames formatted by the uart task, shown by the stats publisher
+ */
+static char frame_logs[SERIAL_DEBUG_UART_FRAME_LOG_NUM][SERIAL_DEBUG_UART_FRAME_LOG_SIZE];
+static size_t frame_log_write = 0;
+static size_t frame_log_read = 0;
+
+static void serial_debug_uart_publish_info(const struct protocol_stats_snapshot *snapshot)
 {
     uint32_t baudrate;
     uart_word_length_t data_bits;
@@ -81,8 +155,13 @@ static void serial_debug_uart_update_info(void)
                               "Stop bits: %s\n"
                               "Flow control: %s\n"
                               "Mode: %s\n"
+                              "Decoder: %s\n"
                               "Data sent: %ld\n"
-                              "Data received: %ld",
+                              "Data received: %ld\n"
+                              "Overrun: %ld\n"
+                              "Throughput: %ld B/s\n"
+                              "Frames: %ld (%ld/s), errors: %ld\n"
+                              "Latency: %ld/%ld us",
                               (int) baudrate,
                               data_bits == UART_DATA_5_BITS ? "5"
                                     : (data_bits == UART_DATA_6_BITS) ? "6"
@@ -93,21 +172,369 @@ static void serial_debug_uart_update_info(void)
                               flow_ctrl == UART_HW_FLOWCTRL_DISABLE ? "None"
                                     : (flow_ctrl == UART_HW_FLOWCTRL_RTS ? "RTS"
                                     : (flow_ctrl == UART_HW_FLOWCTRL_CTS) ? "CTS" : "RTS/CTS"),
-                              info.uart_mode == SERIAL_DEBUG_UART_MODE_NORMAL ? "Normal" : "Console",
-                              info.data_num_sent,
-                              info.data_num_received);
+                              uart_mode_name[(int) info.uart_mode],
+                              protocol_decoder_name(info.decoder_type),
+                              (long) snapshot->total[PROTOCOL_STATS_TX],
+                              (long) snapshot->total[PROTOCOL_STATS_RX],
+                              (long) snapshot->total[PROTOCOL_STATS_OVERRUN],
+                              (long) snapshot->rate[PROTOCOL_STATS_RX],
+                              (long) snapshot->total[PROTOCOL_STATS_FRAMES],
+                              (long) snapshot->rate[PROTOCOL_STATS_FRAMES],
+                              (long) snapshot->total[PROTOCOL_STATS_ERRORS],
+                              info.latency_avg,
+                              info.latency_max);
     }
+    size_t write = __atomic_load_n(&frame_log_write, __ATOMIC_ACQUIRE);
+    if (write - frame_log_read > SERIAL_DEBUG_UART_FRAME_LOG_NUM) {
+        frame_log_read = write - SERIAL_DEBUG_UART_FRAME_LOG_NUM;
+    }
+    for (; frame_log_read != write; frame_log_read++) {
+        if (!uart_frame_list) {
+            continue;
+        }
+        lv_list_add_text(uart_frame_list, frame_logs[frame_log_read % SERIAL_DEBUG_UART_FRAME_LOG_NUM]);
+        if (lv_obj_get_child_count(uart_frame_list) > SERIAL_DEBUG_UART_FRAME_LIST_MAX) {
+            lv_obj_delete(lv_obj_get_child(uart_frame_list, 0));
+        }
+        lv_obj_scroll_to_y(uart_frame_list, LV_COORD_MAX, LV_ANIM_OFF);
+    }
+}
+
+static void serial_debug_uart_update_info(void)
+{
+    protocol_stats_invalidate(PROTOCOL_STATS_SOURCE_UART);
 }
 
 void serial_debug_uart_init_info(lv_obj_t *label)
 {
     uart_info_label = label;
-    serial_debug_uart_update_info();
+    protocol_stats_register(PROTOCOL_STATS_SOURCE_UART, serial_debug_uart_publish_info);
+}
+
+void serial_debug_uart_init_frames(lv_obj_t *list)
+{
+    uart_frame_list = list;
 }
 
 void serial_debug_uart_deinit_info(void)
 {
+    protocol_stats_register(PROTOCOL_STATS_SOURCE_UART, NULL);
     uart_info_label = NULL;
+    uart_frame_list = NULL;
+}
+
+static void serial_debug_uart_frame(void *param, const struct protocol_decoder_frame *frame)
+{
+    bool error = frame->flags & PROTOCOL_DECODER_FLAG_ERROR;
+    protocol_capture_write_flags(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, 0,
+                                 PROTOCOL_CAPTURE_FLAG_FRAME | PROTOCOL_CAPTURE_FLAG_DECODER(decoder.type)
+                                 | (error ? PROTOCOL_CAPTURE_FLAG_ERROR : 0),
+                                 frame->timestamp, frame->data, frame->len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_FRAMES, 1);
+    if (error) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_ERRORS, 1);
+    }
+
+    char *text = frame_logs[frame_log_write % SERIAL_DEBUG_UART_FRAME_LOG_NUM];
+    int pos = snprintf(text, SERIAL_DEBUG_UART_FRAME_LOG_SIZE, "%s%lld.%03lld ",
+                       error ? "! " : "", frame->timestamp / 1000000, frame->timestamp / 1000 % 1000);
+    for (size_t i = 0; i < frame->len && pos < SERIAL_DEBUG_UART_FRAME_LOG_SIZE - 4; i++) {
+        uint8_t byte = frame->data[i];
+        if (decoder.type == PROTOCOL_DECODER_LINE && byte >= 0x20 && byte < 0x7F) {
+            text[pos++] = byte;
+        } else {
+            pos += snprintf(text + pos, SERIAL_DEBUG_UART_FRAME_LOG_SIZE - pos, "%02x ", byte);
+        }
+    }
+    text[pos < SERIAL_DEBUG_UART_FRAME_LOG_SIZE ? pos : SERIAL_DEBUG_UART_FRAME_LOG_SIZE - 1] = 0;
+    __atomic_store_n(&frame_log_write, frame_log_write + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief run everything watching the rx stream on a received chunk
+ */
+static void serial_debug_uart_rx(const uint8_t *data, size_t len, int64_t timestamp)
+{
+    serial_debug_uart_trigger_feed(data, len, timestamp);
+    if (decoder.type != PROTOCOL_DECODER_NONE) {
+        protocol_decoder_feed(&decoder, data, len, timestamp, serial_debug_uart_frame, NULL);
+    }
+}
+
+static int serial_debug_uart_rx_timeout(void)
+{
+    if (info.uart_mode == SERIAL_DEBUG_UART_MODE_BRIDGE) {
+        return SERIAL_DEBUG_UART_RX_TIMEOUT_BRIDGE;
+    }
+    return info.decoder_type == PROTOCOL_DECODER_MODBUS
+           ? SERIAL_DEBUG_UART_RX_TIMEOUT_MODBUS : SERIAL_DEBUG_UART_RX_TIMEOUT_DEFAULT;
+}
+
+static int serial_debug_uart_capture_alloc(void)
+{
+    if (capture_ring.buffer) {
+        return 0;
+    }
+    size_t size = 1;
+    while ((size << 1) <= SERIAL_DEBUG_UART_CAPTURE_SIZE) {
+        size <<= 1;
+    }
+    size_t chunk_num = size / SERIAL_DEBUG_UART_CAPTURE_CHUNK_SIZE;
+    uint8_t *buffer = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (!buffer) {
+        buffer = heap_caps_malloc(size, MALLOC_CAP_DEFAULT);
+    }
+    struct protocol_ring_chunk *chunks = heap_caps_malloc(chunk_num * sizeof(struct protocol_ring_chunk),
+                                                          MALLOC_CAP_SPIRAM);
+    if (!chunks) {
+        chunks = heap_caps_malloc(chunk_num * sizeof(struct protocol_ring_chunk), MALLOC_CAP_DEFAULT);
+    }
+    if (!buffer || !chunks) {
+        ESP_LOGE(TAG, "capture buffer malloc failed");
+        heap_caps_free(buffer);
+        heap_caps_free(chunks);
+        return -1;
+    }
+    protocol_ring_init(&capture_ring, buffer, size, chunks, chunk_num);
+    protocol_capture_attach_ring(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, &capture_ring);
+    ESP_LOGI(TAG, "capture buffer: %d bytes, %d chunks", (int) size, (int) chunk_num);
+    return 0;
+}
+
+static void serial_debug_uart_capture_free(void)
+{
+    protocol_capture_detach_ring(&capture_ring);
+    heap_caps_free(capture_ring.buffer);
+    heap_caps_free(capture_ring.chunks);
+    memset(&capture_ring, 0, sizeof(capture_ring));
+}
+
+/**
+ * @brief drain the uart driver buffer into the capture ring without extra copy
+ *
+ * the capture writer is the only consumer of the ring, so the ring is only
+ * fed while it runs, otherwise data goes through `buffer`
+ */
+static void serial_debug_uart_capture_drain(uint8_t *buffer, int64_t timestamp)
+{
+    size_t buffered = 0;
+    bool ring = protocol_capture_running();
+    uart_get_buffered_data_len(SERIAL_DEBUG_UART_PORT, &buffered);
+    while (buffered > 0) {
+        size_t len = buffered;
+        uint8_t *area = buffer;
+        if (ring) {
+            area = protocol_ring_reserve(&capture_ring, &len);
+            if (area == NULL) {
+                uart_flush_input(SERIAL_DEBUG_UART_PORT);
+                protocol_ring_drop(&capture_ring, buffered);
+                protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_OVERRUN, 1);
+                break;
+            }
+        } else if (len > SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE) {
+            len = SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE;
+        }
+        int read = uart_read_bytes(SERIAL_DEBUG_UART_PORT, area, len, 0);
+        if (read <= 0) {
+            break;
+        }
+        serial_debug_uart_rx(area, read, timestamp);
+        if (ring && protocol_ring_commit(&capture_ring, read, timestamp) == 0) {
+            protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_OVERRUN, 1);
+        }
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_RX, read);
+        buffered -= read;
+    }
+}
+
+static void serial_debug_uart_capture(uint8_t *buffer)
+{
+    uart_event_t event;
+
+    if (xQueueReceive(uart_queue, &event, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return;
+    }
+    switch (event.type) {
+    case UART_DATA:
+        serial_debug_uart_capture_drain(buffer, esp_timer_get_time());
+        break;
+    case UART_FIFO_OVF:
+    case UART_BUFFER_FULL:
+        serial_debug_uart_capture_drain(buffer, esp_timer_get_time());
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_OVERRUN, 1);
+        uart_flush_input(SERIAL_DEBUG_UART_PORT);
+        xQueueReset(uart_queue);
+        break;
+    default:
+        break;
+    }
+}
+
+static void serial_debug_uart_bridge_rx(const uint8_t *data, size_t len)
+{
+    int written = uart_write_bytes(SERIAL_DEBUG_UART_PORT, data, len);
+    if (written > 0) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_TX, written);
+        protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_TX, 0,
+                               esp_timer_get_time(), data, written);
+    }
+}
+
+static void serial_debug_uart_bridge_line_coding(uint32_t baudrate, uint8_t data_bits,
+                                                 uint8_t parity, uint8_t stop_bits)
+{
+    if (baudrate > 0) {
+        uart_set_baudrate(SERIAL_DEBUG_UART_PORT, baudrate);
+    }
+    if (data_bits >= 5 && data_bits <= 8) {
+        uart_set_word_length(SERIAL_DEBUG_UART_PORT, UART_DATA_5_BITS + data_bits - 5);
+    }
+    uart_set_parity(SERIAL_DEBUG_UART_PORT,
+                    parity == 1 ? UART_PARITY_ODD : (parity == 2 ? UART_PARITY_EVEN : UART_PARITY_DISABLE));
+    uart_set_stop_bits(SERIAL_DEBUG_UART_PORT,
+                       stop_bits == 1 ? UART_STOP_BITS_1_5 : (stop_bits == 2 ? UART_STOP_BITS_2 : UART_STOP_BITS_1));
+    serial_debug_uart_update_info();
+}
+
+static const struct usb_device_cdc_bridge uart_bridge = {
+    .rx = serial_debug_uart_bridge_rx,
+    .line_coding = serial_debug_uart_bridge_line_coding,
+};
+
+/**
+ * @brief forward everything buffered by the uart driver to usb cdc in one write
+ *
+ * latency is measured from the rx event (raised after rx timeout or rx full
+ * threshold) to the cdc flush
+ */
+static void serial_debug_uart_bridge(uint8_t *buffer)
+{
+    uart_event_t event;
+
+    if (xQueueReceive(uart_queue, &event, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return;
+    }
+    int64_t timestamp = esp_timer_get_time();
+    if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_OVERRUN, 1);
+    }
+    size_t buffered = 0;
+    uart_get_buffered_data_len(SERIAL_DEBUG_UART_PORT, &buffered);
+    if (buffered == 0) {
+        return;
+    }
+    while (buffered > 0) {
+        int len = uart_read_bytes(SERIAL_DEBUG_UART_PORT, buffer,
+                                  buffered > SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE
+                                        ? SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE : buffered, 0);
+        if (len <= 0) {
+            break;
+        }
+        usb_device_cdc_write(buffer, len);
+        serial_debug_uart_rx(buffer, len, timestamp);
+        protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, 0,
+                               timestamp, buffer, len);
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_RX, len);
+        buffered -= len;
+    }
+    long latency = (long) (esp_timer_get_time() - timestamp);
+    info.latency_avg += (latency - info.latency_avg) / 16;
+    if (latency > info.latency_max) {
+        info.latency_max = latency;
+    }
+}
+
+/**
+ * @brief read the bytes of one rx event
+ *
+ * the driver raises an event after the rx timeout or the rx full threshold,
+ * reading only what the event reports keeps frames that are sent back to
+ * back in separate chunks, each with its own timestamp, so the decoders see
+ * the gap between them
+ */
+static void serial_debug_uart_normal(uint8_t *buffer)
+{
+    uart_event_t event;
+
+    if (xQueueReceive(uart_queue, &event, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return;
+    }
+    if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_OVERRUN, 1);
+        uart_flush_input(SERIAL_DEBUG_UART_PORT);
+        xQueueReset(uart_queue);
+        return;
+    }
+    if (event.type != UART_DATA) {
+        return;
+    }
+    size_t size = event.size;
+    while (size > 0) {
+        int len = uart_read_bytes(SERIAL_DEBUG_UART_PORT, buffer,
+                                  size > SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE
+                                        ? SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE : size, 0);
+        if (len <= 0) {
+            break;
+        }
+        int64_t timestamp = esp_timer_get_time();
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_RX, len);
+        serial_debug_uart_rx(buffer, len, timestamp);
+        protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, 0,
+                               timestamp, buffer, len);
+        if (decoder.type == PROTOCOL_DECODER_NONE) {
+            ESP_LOG_BUFFER_HEX("uart received", buffer, len);
+        }
+        size -= len;
+    }
+}
+
+static size_t console_batch = 0;
+static int64_t console_batch_time = 0;
+
+/**
+ * @brief forward rx to the console shell in batches
+ *
+ * bytes are collected until the batch is large enough or the first byte of
+ * the batch is older than the flush time, so a burst costs one shell write
+ */
+static void serial_debug_uart_console_rx(uint8_t *buffer)
+{
+    size_t batch = console_batch;
+    int64_t batch_time = console_batch_time;
+
+    int len = uart_read_bytes(SERIAL_DEBUG_UART_PORT, buffer + batch, 1,
+                              pdMS_TO_TICKS(SERIAL_DEBUG_UART_CONSOLE_FLUSH_TIME / 1000));
+    if (len > 0) {
+        size_t buffered = 0;
+        uart_get_buffered_data_len(SERIAL_DEBUG_UART_PORT, &buffered);
+        if (buffered > SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE - batch - 1) {
+            buffered = SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE - batch - 1;
+        }
+        if (buffered > 0) {
+            int more = uart_read_bytes(SERIAL_DEBUG_UART_PORT, buffer + batch + 1, buffered, 0);
+            len += more > 0 ? more : 0;
+        }
+        int64_t timestamp = esp_timer_get_time();
+        if (batch == 0) {
+            batch_time = timestamp;
+        }
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_RX, len);
+        serial_debug_uart_rx(buffer + batch, len, timestamp);
+        protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, 0,
+                               timestamp, buffer + batch, len);
+        batch += len;
+    }
+    if (batch > 0
+        && (batch >= SERIAL_DEBUG_UART_CONSOLE_BATCH_SIZE || len <= 0
+            || esp_timer_get_time() - batch_time >= SERIAL_DEBUG_UART_CONSOLE_FLUSH_TIME)) {
+        Shell *shell = info.active_shell;
+        if (shell) {
+            shell->write((char *) buffer, batch);
+        }
+        batch = 0;
+    }
+    console_batch = batch;
+    console_batch_time = batch_time;
 }
 
 static void serial_debug_uart_task(void *param)
@@ -122,29 +549,63 @@ static void serial_debug_uart_task(void *param)
     uart_set_pin(SERIAL_DEBUG_UART_PORT, 
                  info.tx_io, info.rx_io, info.rts_io, info.cts_io);
     uart_param_config(SERIAL_DEBUG_UART_PORT, &uart_config);
-    uart_driver_install(SERIAL_DEBUG_UART_PORT, 512, 512, 0, NULL, 0);
+    uart_driver_install(SERIAL_DEBUG_UART_PORT, SERIAL_DEBUG_UART_RX_BUF_SIZE, SERIAL_DEBUG_UART_TX_BUF_SIZE,
+                        SERIAL_DEBUG_UART_EVENT_QUEUE_SIZE, &uart_queue, 0);
+    uart_set_rx_full_threshold(SERIAL_DEBUG_UART_PORT, SERIAL_DEBUG_UART_RX_FULL_THRESH);
 
     serial_debug_uart_update_info();
 
-    uint8_t *data = (uint8_t *)heap_caps_malloc(128, MALLOC_CAP_DEFAULT);
+    char last_mode = info.uart_mode;
+    uint8_t *data = (uint8_t *)heap_caps_malloc(SERIAL_DEBUG_UART_BRIDGE_BUF_SIZE, MALLOC_CAP_DEFAULT);
     while (info.run) {
-        int len = uart_read_bytes(SERIAL_DEBUG_UART_PORT, data, 128, 
-                                  pdMS_TO_TICKS(info.uart_mode == SERIAL_DEBUG_UART_MODE_NORMAL ? 100 : 20));
-        if (len > 0) {
-            info.data_num_received += len;
-            if (info.uart_mode == SERIAL_DEBUG_UART_MODE_NORMAL) {
-                ESP_LOG_BUFFER_HEX("uart received", data, len);
-            } else {
-                if (info.active_shell) {
-                    info.active_shell->write((char *)data, len);
+        if (info.decoder_type != decoder.type) {
+            uint32_t baudrate = 0;
+            uart_get_baudrate(SERIAL_DEBUG_UART_PORT, &baudrate);
+            protocol_decoder_init(&decoder, info.decoder_type, baudrate);
+            uart_set_rx_timeout(SERIAL_DEBUG_UART_PORT, serial_debug_uart_rx_timeout());
+        }
+        protocol_decoder_poll(&decoder, esp_timer_get_time(), serial_debug_uart_frame, NULL);
+        if (info.uart_mode != last_mode) {
+            /* a batch belongs to the console session it was read in */
+            console_batch = 0;
+            if (last_mode == SERIAL_DEBUG_UART_MODE_BRIDGE) {
+                usb_device_cdc_set_bridge(NULL);
+                uart_set_rx_timeout(SERIAL_DEBUG_UART_PORT, serial_debug_uart_rx_timeout());
+            }
+            if (info.uart_mode == SERIAL_DEBUG_UART_MODE_CAPTURE) {
+                if (serial_debug_uart_capture_alloc() != 0) {
+                    info.uart_mode = SERIAL_DEBUG_UART_MODE_NORMAL;
                 }
+                xQueueReset(uart_queue);
+            } else if (info.uart_mode == SERIAL_DEBUG_UART_MODE_BRIDGE) {
+                info.latency_avg = 0;
+                info.latency_max = 0;
+                uart_set_rx_timeout(SERIAL_DEBUG_UART_PORT, serial_debug_uart_rx_timeout());
+                xQueueReset(uart_queue);
+                usb_device_cdc_set_bridge(&uart_bridge);
             }
-            serial_debug_uart_update_info();
+            last_mode = info.uart_mode;
+        }
+        if (info.uart_mode == SERIAL_DEBUG_UART_MODE_CAPTURE) {
+            serial_debug_uart_capture(data);
+        } else if (info.uart_mode == SERIAL_DEBUG_UART_MODE_BRIDGE) {
+            serial_debug_uart_bridge(data);
+        } else if (info.uart_mode == SERIAL_DEBUG_UART_MODE_BENCH) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+        } else if (info.uart_mode == SERIAL_DEBUG_UART_MODE_CONSOLE) {
+            serial_debug_uart_console_rx(data);
+        } else {
+            serial_debug_uart_normal(data);
         }
     };
     heap_caps_free(data);
+    if (last_mode == SERIAL_DEBUG_UART_MODE_BRIDGE) {
+        usb_device_cdc_set_bridge(NULL);
+    }
     
     uart_driver_delete(SERIAL_DEBUG_UART_PORT);
+    uart_queue = NULL;
+    serial_debug_uart_capture_free();
     gpio_reset_pin(info.tx_io);
     gpio_reset_pin(info.rx_io);
     gpio_reset_pin(info.rts_io);
@@ -183,6 +644,101 @@ static void serial_debug_uart_set_baudrate(int baudrate)
     serial_debug_uart_update_info();
 }
 
+static uint32_t autobaud_edges[SERIAL_DEBUG_UART_AUTOBAUD_EDGE_NUM];
+static volatile size_t autobaud_edge_num = 0;
+
+static void IRAM_ATTR serial_debug_uart_autobaud_isr(void *arg)
+{
+    size_t num = autobaud_edge_num;
+    if (num < SERIAL_DEBUG_UART_AUTOBAUD_EDGE_NUM) {
+        autobaud_edges[num] = (uint32_t) esp_timer_get_time();
+        autobaud_edge_num = num + 1;
+    }
+}
+
+/**
+ * @brief measure the bit width by timing rx edges with gpio interrupt
+ *
+ * used for low baudrates, where the bit width overflows the uart pulse counters
+ *
+ * @param window sampling window in ms
+ * @return uint32_t bit width in us, 0 if not enough edges
+ */
+static uint32_t serial_debug_uart_autobaud_edges(int window)
+{
+    autobaud_edge_num = 0;
+    gpio_install_isr_service(0);
+    gpio_set_intr_type(info.rx_io, GPIO_INTR_ANYEDGE);
+    gpio_isr_handler_add(info.rx_io, serial_debug_uart_autobaud_isr, NULL);
+    gpio_intr_enable(info.rx_io);
+    int64_t start = esp_timer_get_time();
+    while (autobaud_edge_num < SERIAL_DEBUG_UART_AUTOBAUD_EDGE_NUM
+           && esp_timer_get_time() - start < window * 1000) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    gpio_intr_disable(info.rx_io);
+    gpio_isr_handler_remove(info.rx_io);
+    gpio_set_intr_type(info.rx_io, GPIO_INTR_DISABLE);
+    if (autobaud_edge_num < SERIAL_DEBUG_UART_AUTOBAUD_MIN_EDGES) {
+        return 0;
+    }
+    return protocol_autobaud_min_pulse(autobaud_edges, autobaud_edge_num, 1000000);
+}
+
+/**
+ * @brief detect baudrate from rx traffic and reconfigure the port in place
+ *
+ * the uart autobaud counters record the shortest high and low pulse in source
+ * clock cycles, the shorter one is taken as one bit
+ *
+ * @param window sampling window in ms
+ */
+static void serial_debug_uart_autobaud(int window)
+{
+    if (!info.run) {
+        shellPrint(shellGetCurrent(), "uartd not running\r\n");
+        return;
+    }
+    if (window <= 0) {
+        window = SERIAL_DEBUG_UART_AUTOBAUD_WINDOW;
+    }
+    uint32_t sclk = 0;
+    uart_get_sclk_freq(UART_SCLK_DEFAULT, &sclk);
+    uart_dev_t *hw = UART_LL_GET_HW(SERIAL_DEBUG_UART_PORT);
+
+    uart_ll_set_autobaud_en(hw, false);
+    uart_ll_set_autobaud_en(hw, true);
+    vTaskDelay(pdMS_TO_TICKS(window));
+    uint32_t edges = uart_ll_get_rxd_edge_cnt(hw);
+    uint32_t low = uart_ll_get_low_pulse_cnt(hw);
+    uint32_t high = uart_ll_get_high_pulse_cnt(hw);
+    uart_ll_set_autobaud_en(hw, false);
+
+    if (edges < SERIAL_DEBUG_UART_AUTOBAUD_MIN_EDGES) {
+        shellPrint(shellGetCurrent(), "no enough rx traffic, %d edges\r\n", (int) edges);
+        return;
+    }
+    uint32_t pulse = low < high ? low : high;
+    uint32_t tick_hz = sclk;
+    if (pulse >= SERIAL_DEBUG_UART_AUTOBAUD_PULSE_MAX) {
+        pulse = serial_debug_uart_autobaud_edges(window);
+        tick_hz = 1000000;
+    } else {
+        pulse += 1;
+    }
+    uint32_t baudrate = protocol_autobaud_classify(pulse, tick_hz);
+    if (baudrate == 0) {
+        shellPrint(shellGetCurrent(), "baudrate detect failed\r\n");
+        return;
+    }
+    uint32_t measured = (uint32_t) (((uint64_t) tick_hz + pulse / 2) / pulse);
+    shellPrint(shellGetCurrent(), "measured: %d, baudrate: %d%s\r\n", (int) measured, (int) baudrate,
+               protocol_autobaud_snap(measured) ? "" : " (non standard)");
+    uart_set_baudrate(SERIAL_DEBUG_UART_PORT, baudrate);
+    uart_flush_input(SERIAL_DEBUG_UART_PORT);
+    serial_debug_uart_update_info();
+}
+
 static void serial_debug_uart_set_data_bits(int data_bits)
 {
     if (!info.run) {
@@ -245,7 +801,7 @@ static void serial_debug_uart_set_mode(int mode)
         shellPrint(shellGetCurrent(), "uartd not running\r\n");
         return;
     }
-    if (mode < SERIAL_DEBUG_UART_MODE_NORMAL || mode > SERIAL_DEBUG_UART_MODE_CONSOLE) {
+    if (mode < SERIAL_DEBUG_UART_MODE_NORMAL || mode > SERIAL_DEBUG_UART_MODE_BRIDGE) {
         shellPrint(shellGetCurrent(), "mode param error\r\n");
         return;
     }
@@ -253,6 +809,20 @@ static void serial_debug_uart_set_mode(int mode)
     serial_debug_uart_update_info();
 }
 
+static void serial_debug_uart_set_decoder(int type)
+{
+    if (!info.run) {
+        shellPrint(shellGetCurrent(), "uartd not running\r\n");
+        return;
+    }
+    if (type < PROTOCOL_DECODER_NONE || type >= PROTOCOL_DECODER_NUM) {
+        shellPrint(shellGetCurrent(), "decoder param error\r\n");
+        return;
+    }
+    info.decoder_type = type;
+    serial_debug_uart_update_info();
+}
+
 static void serial_debug_uart_send_data(char *data, int len)
 {
     if (!info.run) {
@@ -260,8 +830,9 @@ static void serial_debug_uart_send_data(char *data, int len)
         return;
     }
     uart_write_bytes(SERIAL_DEBUG_UART_PORT, data, len);
-    info.data_num_sent += len;
-    serial_debug_uart_update_info();
+    protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_TX, 0,
+                           esp_timer_get_time(), data, len);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_TX, len);
 }
 
 static void serial_debug_uart_send(char *data)
@@ -277,6 +848,339 @@ static void serial_debug_uart_send_string(char *str)
     ESP_LOGI("uart sent", "%s", str);
 }
 
+/**
+ * @brief playback state, the shell task reads the file ahead into `stream`
+ *        and the player task consumes it
+ */
+struct uart_player {
+    StreamBufferHandle_t stream;
+    SemaphoreHandle_t done;
+    bool raw;
+    bool eof;
+    bool finished;
+    int filter;
+    int gap;
+    long records;
+    long bytes;
+    long late;
+    long underrun;
+    int64_t jitter_min;
+    int64_t jitter_max;
+    int64_t jitter_sum;
+};
+
+static struct uart_player player = {0};
+
+/**
+ * @brief read exactly `len` bytes from the read-ahead stream
+ *
+ * @return size_t read length, less than `len` only at end of file
+ */
+static size_t serial_debug_uart_play_read(void *data, size_t len)
+{
+    size_t total = 0;
+    while (total < len) {
+        size_t read = xStreamBufferReceive(player.stream, (uint8_t *) data + total, len - total,
+                                           pdMS_TO_TICKS(10));
+        if (read == 0 && player.eof && xStreamBufferIsEmpty(player.stream)) {
+            break;
+        }
+        total += read;
+    }
+    return total;
+}
+
+/**
+ * @brief wait until `target`, sleep for the coarse part and spin for the rest
+ */
+static void serial_debug_uart_play_wait(int64_t target)
+{
+    int64_t remain = target - esp_timer_get_time();
+    if (remain > SERIAL_DEBUG_UART_PLAY_SPIN_TIME) {
+        vTaskDelay(pdMS_TO_TICKS((remain - SERIAL_DEBUG_UART_PLAY_SPIN_TIME) / 1000));
+    }
+    while (esp_timer_get_time() < target) {
+        ;
+    }
+}
+
+static void serial_debug_uart_play_task(void *param)
+{
+    uint8_t *data = param;
+    struct protocol_capture_record record;
+    int64_t first = 0, start = 0, last = 0;
+
+    while (info.run) {
+        if (player.raw) {
+            size_t len = serial_debug_uart_play_read(data, SERIAL_DEBUG_UART_PLAY_RECORD_SIZE);
+            if (len == 0) {
+                break;
+            }
+            uart_write_bytes(SERIAL_DEBUG_UART_PORT, data, len);
+            player.bytes += len;
+            continue;
+        }
+        if (serial_debug_uart_play_read(&record, sizeof(record)) != sizeof(record)
+            || record.length > SERIAL_DEBUG_UART_PLAY_RECORD_SIZE
+            || serial_debug_uart_play_read(data, record.length) != record.length) {
+            break;
+        }
+        if (record.source != PROTOCOL_CAPTURE_SOURCE_UART
+            || (player.filter == SERIAL_DEBUG_UART_PLAY_FILTER_RX && record.direction != PROTOCOL_CAPTURE_DIR_RX)
+            || (player.filter == SERIAL_DEBUG_UART_PLAY_FILTER_TX && record.direction != PROTOCOL_CAPTURE_DIR_TX)) {
+            continue;
+        }
+        int64_t target;
+        if (player.records == 0) {
+            first = record.timestamp;
+            start = esp_timer_get_time();
+            target = start;
+        } else if (player.gap > 0) {
+            target = last + player.gap;
+        } else if (player.gap < 0) {
+            target = esp_timer_get_time();
+        } else {
+            target = start + (record.timestamp - first);
+        }
+        int64_t now = esp_timer_get_time();
+        if (now > target) {
+            player.underrun++;
+        } else {
+            serial_debug_uart_play_wait(target);
+        }
+        now = esp_timer_get_time();
+        uart_write_bytes(SERIAL_DEBUG_UART_PORT, data, record.length);
+        last = now;
+
+        int64_t jitter = now - target;
+        if (player.records == 0 || jitter < player.jitter_min) {
+            player.jitter_min = jitter;
+        }
+        if (jitter > player.jitter_max) {
+            player.jitter_max = jitter;
+        }
+        if (jitter > SERIAL_DEBUG_UART_PLAY_JITTER_LIMIT) {
+            player.late++;
+        }
+        player.jitter_sum += jitter;
+        player.records++;
+        player.bytes += record.length;
+    }
+    uart_wait_tx_done(SERIAL_DEBUG_UART_PORT, pdMS_TO_TICKS(1000));
+    player.finished = true;
+    xSemaphoreGive(player.done);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief stream a file to uart
+ *
+ * capture files are replayed record by record with the recorded timing, other
+ * files are sent as raw bytes at line rate
+ *
+ * @param path file path
+ * @param filter record filter
+ * @param gap inter-record gap in us, 0 to use recorded timestamps, negative for no gap
+ */
+static void serial_debug_uart_play(char *path, int filter, int gap)
+{
+    struct protocol_capture_header header;
+
+    if (!info.run) {
+        shellPrint(shellGetCurrent(), "uartd not running\r\n");
+        return;
+    }
+    if (player.stream) {
+        shellPrint(shellGetCurrent(), "uartd is playing\r\n");
+        return;
+    }
+    if (!path) {
+        path = PROTOCOL_CAPTURE_DEFAULT_PATH;
+    }
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        shellPrint(shellGetCurrent(), "open %s failed\r\n", path);
+        return;
+    }
+    memset(&player, 0, sizeof(player));
+    player.filter = filter;
+    player.gap = gap;
+    player.raw = fread(&header, 1, sizeof(header), file) != sizeof(header)
+                 || header.magic != PROTOCOL_CAPTURE_MAGIC;
+    fseek(file, player.raw ? 0 : header.header_size, SEEK_SET);
+
+    uint8_t *buffer = heap_caps_malloc(SERIAL_DEBUG_UART_PLAY_READ_SIZE, MALLOC_CAP_DEFAULT);
+    uint8_t *record = heap_caps_malloc(SERIAL_DEBUG_UART_PLAY_RECORD_SIZE, MALLOC_CAP_INTERNAL);
+    player.stream = xStreamBufferCreate(SERIAL_DEBUG_UART_PLAY_STREAM_SIZE, 1);
+    player.done = xSemaphoreCreateBinary();
+    if (!buffer || !record || !player.stream || !player.done) {
+        shellPrint(shellGetCurrent(), "malloc failed\r\n");
+        goto exit;
+    }
+
+    /* fill the read-ahead buffer before the first record is due */
+    size_t len;
+    while ((len = fread(buffer, 1, SERIAL_DEBUG_UART_PLAY_READ_SIZE, file)) > 0
+           && xStreamBufferSpacesAvailable(player.stream) >= len) {
+        xStreamBufferSend(player.stream, buffer, len, 0);
+        len = 0;
+    }
+    xTaskCreatePinnedToCore(serial_debug_uart_play_task, "uart player", 4096, record, 6, NULL, 0);
+    size_t offset = 0;
+    while (len > 0 && !player.finished) {
+        offset += xStreamBufferSend(player.stream, buffer + offset, len - offset, pdMS_TO_TICKS(100));
+        if (offset == len) {
+            len = fread(buffer, 1, SERIAL_DEBUG_UART_PLAY_READ_SIZE, file);
+            offset = 0;
+        }
+    }
+    player.eof = true;
+    xSemaphoreTake(player.done, portMAX_DELAY);
+
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_TX, player.bytes);
+    if (player.raw) {
+        shellPrint(shellGetCurrent(), "raw: %ld bytes sent\r\n", player.bytes);
+    } else {
+        shellPrint(shellGetCurrent(), "records: %ld, bytes: %ld\r\n"
+                   "jitter: min %lld us, max %lld us, avg %lld us\r\n"
+                   "over %d us: %ld, underrun: %ld\r\n",
+                   player.records, player.bytes,
+                   player.jitter_min, player.jitter_max,
+                   player.records ? player.jitter_sum / player.records : 0,
+                   SERIAL_DEBUG_UART_PLAY_JITTER_LIMIT, player.late, player.underrun);
+    }
+exit:
+    fclose(file);
+    heap_caps_free(buffer);
+    heap_caps_free(record);
+    if (player.stream) {
+        vStreamBufferDelete(player.stream);
+        player.stream = NULL;
+    }
+    if (player.done) {
+        vSemaphoreDelete(player.done);
+        player.done = NULL;
+    }
+}
+
+static const uint32_t bench_baudrates[] = {
+    115200, 460800, 921600, 2000000, 3000000, 5000000,
+};
+
+/**
+ * @brief run prbs through tx and check it on rx at one baudrate
+ *
+ * tx is kept at most `SERIAL_DEBUG_UART_BENCH_AHEAD` bytes ahead of rx, so the
+ * driver buffers never overflow and rx is checked while tx is still running
+ */
+static void serial_debug_uart_bench_run(uint32_t baudrate, size_t total, uint8_t *tx, uint8_t *rx)
+{
+    struct protocol_prbs generator, checker;
+    struct protocol_prbs_result result;
+    struct protocol_cpu_load load;
+    int percent[portNUM_PROCESSORS];
+    size_t sent = 0;
+
+    uart_set_baudrate(SERIAL_DEBUG_UART_PORT, baudrate);
+    uart_get_baudrate(SERIAL_DEBUG_UART_PORT, &baudrate);
+    uart_flush_input(SERIAL_DEBUG_UART_PORT);
+    protocol_prbs_init(&generator, PROTOCOL_PRBS_DEFAULT_SEED);
+    protocol_prbs_init(&checker, PROTOCOL_PRBS_DEFAULT_SEED);
+    protocol_prbs_result_init(&result);
+
+    protocol_cpu_load_start(&load);
+    int64_t start = esp_timer_get_time();
+    while (result.bytes < total) {
+        while (sent < total && sent - result.bytes + SERIAL_DEBUG_UART_BENCH_BLOCK <= SERIAL_DEBUG_UART_BENCH_AHEAD) {
+            size_t len = total - sent > SERIAL_DEBUG_UART_BENCH_BLOCK ? SERIAL_DEBUG_UART_BENCH_BLOCK : total - sent;
+            protocol_prbs_fill(&generator, tx, len);
+            uart_write_bytes(SERIAL_DEBUG_UART_PORT, tx, len);
+            sent += len;
+        }
+        size_t want = sent - result.bytes > SERIAL_DEBUG_UART_BENCH_BLOCK
+                      ? SERIAL_DEBUG_UART_BENCH_BLOCK : sent - result.bytes;
+        int len = uart_read_bytes(SERIAL_DEBUG_UART_PORT, rx, want, pdMS_TO_TICKS(1000));
+        if (len <= 0) {
+            break;
+        }
+        protocol_prbs_check(&checker, rx, len, &result);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    protocol_cpu_load_get(&load, percent);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_TX, sent);
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_RX, result.bytes);
+
+    int rate = elapsed > 0 ? (int) (result.bytes * 1000000 / elapsed) : 0;
+    shellPrint(shellGetCurrent(), "%7d baud: %d.%03d MB/s, cpu %d%%/%d%%, lost %d, bit errors %llu/%llu (%.2e), "
+               "first mismatch %lld\r\n",
+               (int) baudrate, rate / 1000000, rate / 1000 % 1000, percent[0], percent[1],
+               (int) (total - result.bytes), result.bit_errors, result.bytes * 8,
+               result.bytes ? (double) result.bit_errors / (result.bytes * 8) : 0.0,
+               result.first_error);
+}
+
+/**
+ * @brief loopback benchmark, tx must be wired to rx or to a target echoing data
+ *
+ * @param max_baudrate max baudrate of the sweep
+ * @param kbytes data length of each baudrate in kbytes
+ */
+static void serial_debug_uart_bench(int max_baudrate, int kbytes)
+{
+    uint32_t baudrate;
+
+    if (!info.run) {
+        shellPrint(shellGetCurrent(), "uartd not running\r\n");
+        return;
+    }
+    if (info.uart_mode != SERIAL_DEBUG_UART_MODE_NORMAL) {
+        shellPrint(shellGetCurrent(), "uartd bench only runs in normal mode\r\n");
+        return;
+    }
+    if (max_baudrate <= 0) {
+        max_baudrate = bench_baudrates[sizeof(bench_baudrates) / sizeof(bench_baudrates[0]) - 1];
+    }
+    if (kbytes <= 0) {
+        kbytes = SERIAL_DEBUG_UART_BENCH_KBYTES;
+    }
+    uint8_t *tx = heap_caps_malloc(SERIAL_DEBUG_UART_BENCH_BLOCK, MALLOC_CAP_INTERNAL);
+    uint8_t *rx = heap_caps_malloc(SERIAL_DEBUG_UART_BENCH_BLOCK, MALLOC_CAP_INTERNAL);
+    if (!tx || !rx) {
+        shellPrint(shellGetCurrent(), "malloc failed\r\n");
+        heap_caps_free(tx);
+        heap_caps_free(rx);
+        return;
+    }
+    uart_get_baudrate(SERIAL_DEBUG_UART_PORT, &baudrate);
+    info.uart_mode = SERIAL_DEBUG_UART_MODE_BENCH;
+    serial_debug_uart_update_info();
+    /* wait for the uart task to leave its blocking read */
+    vTaskDelay(pdMS_TO_TICKS(200));
+    for (int i = 0; i < sizeof(bench_baudrates) / sizeof(bench_baudrates[0]); i++) {
+        if (bench_baudrates[i] > max_baudrate) {
+            break;
+        }
+        serial_debug_uart_bench_run(bench_baudrates[i], kbytes * 1024, tx, rx);
+    }
+    uart_wait_tx_done(SERIAL_DEBUG_UART_PORT, pdMS_TO_TICKS(1000));
+    uart_set_baudrate(SERIAL_DEBUG_UART_PORT, baudrate);
+    uart_flush_input(SERIAL_DEBUG_UART_PORT);
+    info.uart_mode = SERIAL_DEBUG_UART_MODE_NORMAL;
+    serial_debug_uart_update_info();
+    heap_caps_free(tx);
+    heap_caps_free(rx);
+}
+
+static void serial_debug_uart_bridge_start(void)
+{
+    if (!info.run) {
+        shellPrint(shellGetCurrent(), "uartd not running\r\n");
+        return;
+    }
+    serial_debug_uart_set_mode(SERIAL_DEBUG_UART_MODE_BRIDGE);
+    shellPrint(shellGetCurrent(), "usb cdc bridged to uart, run `uartd mode 0` on another shell to exit\r\n");
+}
+
 static void serial_debug_uart_console(void)
 {
     if (!info.run) {
@@ -286,16 +1190,23 @@ static void serial_debug_uart_console(void)
     info.uart_mode = SERIAL_DEBUG_UART_MODE_CONSOLE;
     serial_debug_uart_update_info();
     info.active_shell = shellGetCurrent();
-    char data;
-    while (info.run) {
-        if (info.active_shell->read(&data, 1) == 1) {
-            if (data == SERIAL_DEBUG_UART_CONSOLE_EXIT_KEY) {
-                break;
-            } else {
-                uart_write_bytes(SERIAL_DEBUG_UART_PORT, &data, 1);
-                info.data_num_sent++;
-                cpost(0, serial_debug_uart_update_info, .delay=50, .attrs.flag=CPOST_FLAG_CANCEL_CURRENT);
-            }
+    char data[SERIAL_DEBUG_UART_CONSOLE_BUF_SIZE];
+    bool quit = false;
+    while (info.run && !quit) {
+        int len = info.active_shell->read(data, sizeof(data));
+        if (len <= 0) {
+            continue;
+        }
+        char *key = memchr(data, SERIAL_DEBUG_UART_CONSOLE_EXIT_KEY, len);
+        if (key) {
+            len = key - data;
+            quit = true;
+        }
+        if (len > 0) {
+            uart_write_bytes(SERIAL_DEBUG_UART_PORT, data, len);
+            protocol_capture_write(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_TX, 0,
+                                   esp_timer_get_time(), data, len);
+            protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_TX, len);
         }
     }
     info.active_shell = NULL;
@@ -307,6 +1218,8 @@ static ShellCommand uart_group[] =
 {
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, baudrate, serial_debug_uart_set_baudrate, 
         set uart baudrate\r\nuartd baudrate [baudrate]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, autobaud, serial_debug_uart_autobaud,
+        detect uart baudrate from rx traffic\r\nuartd autobaud [window ms]),
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, databits, serial_debug_uart_set_data_bits,
         set uart data bits\r\nuartd databits [data bits]\r\n
         0 - 5 bits\r\n
@@ -333,13 +1246,33 @@ static ShellCommand uart_group[] =
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, mode, serial_debug_uart_set_mode,
         set uart mode\r\nuartd mode [mode]\r\n
         0 - Normal\r\n
-        1 - Console),
+        1 - Console\r\n
+        2 - Capture\r\n
+        3 - Bridge),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, decoder, serial_debug_uart_set_decoder,
+        set uart frame decoder\r\nuartd decoder [decoder]\r\n
+        0 - None\r\n
+        1 - Line\r\n
+        2 - SLIP\r\n
+        3 - COBS\r\n
+        4 - Modbus RTU),
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, send, serial_debug_uart_send,
         send data to uart\r\nuartd send [data], .data.cmd.signature="[q"),
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, sendstr, serial_debug_uart_send_string,
         send string to uart\r\nuartd send [str]),
     SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, console, serial_debug_uart_console,
         start uart console),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, bridge, serial_debug_uart_bridge_start,
+        bridge usb cdc to uart\r\nuartd bridge),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, bench, serial_debug_uart_bench,
+        loopback prbs benchmark, tx wired to rx\r\nuartd bench [max baudrate] [kbytes]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, play, serial_debug_uart_play,
+        play file to uart\r\nuartd play [path] [filter] [gap us]\r\n
+        filter:\r\n
+        0 - All uart records\r\n
+        1 - Rx records\r\n
+        2 - Tx records\r\n
+        gap: 0 - recorded timing, <0 - no gap),
     SHELL_CMD_GROUP_END()
 };
 SHELL_EXPORT_CMD_GROUP(
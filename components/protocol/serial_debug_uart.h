@@ -12,6 +12,7 @@
 #include "lvgl.h"
 
 void serial_debug_uart_init_info(lv_obj_t *label);
+void serial_debug_uart_init_frames(lv_obj_t *list);
 void serial_debug_uart_deinit_info(void);
 void serial_debug_uart_init(int tx_pin, int rx_pin, int rts_pin, int cts_pin);
 void serial_debug_uart_deinit(void);
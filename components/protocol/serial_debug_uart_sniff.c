@@ -0,0 +1,414 @@
+/**
+ * @file serial_debug_uart_sniff.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief serial debug multi channel uart sniffer
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ *
+ * each channel is an rmt rx channel, a receive ends once the line has been
+ * idle for a few bit times, the done interrupt re-arms it on the other buffer
+ * and the decode task decodes the finished one. bytes of all channels are held for a while
+ * in a merge buffer so that they come out in timestamp order
+ */
+#include "driver/rmt_rx.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "stdio.h"
+#include "string.h"
+#include "protocol_capture.h"
+#include "protocol_common.h"
+#include "protocol_stats.h"
+#include "protocol_uart_sniff.h"
+#include "serial_debug_uart_sniff.h"
+
+#define SERIAL_DEBUG_UART_SNIFF_CHANNEL_NUM 4
+#define SERIAL_DEBUG_UART_SNIFF_SYMBOLS 512
+#define SERIAL_DEBUG_UART_SNIFF_MEM_SYMBOLS 48
+#define SERIAL_DEBUG_UART_SNIFF_MERGE_SIZE 512
+#define SERIAL_DEBUG_UART_SNIFF_QUEUE_SIZE 16
+#define SERIAL_DEBUG_UART_SNIFF_IDLE_BITS 12
+#define SERIAL_DEBUG_UART_SNIFF_TICKS_PER_BIT 16
+#define SERIAL_DEBUG_UART_SNIFF_CLK_HZ 80000000
+#define SERIAL_DEBUG_UART_SNIFF_MAX_BAUDRATE 1000000
+#define SERIAL_DEBUG_UART_SNIFF_HOLD_MAX_US 200000
+#define SERIAL_DEBUG_UART_SNIFF_LINE_SIZE 16
+
+static const char *TAG = "serial_debug_uart_sniff";
+
+struct uart_sniff_event {
+    uint8_t channel;
+    uint8_t buffer;
+    uint16_t num;
+    int64_t armed;
+    int64_t end;
+};
+
+/**
+ * @brief one sniffed line, buffers[active] is armed and the pending bits mark
+ *        buffers still waiting for the decode task. when both are taken the
+ *        receive stays stopped until a buffer is released
+ */
+struct uart_sniff_channel {
+    rmt_channel_handle_t rmt;
+    uint32_t *buffers[2];
+    uint8_t active;
+    uint8_t pending;
+    bool stalled;
+    int64_t armed;
+    int io;
+    struct protocol_uart_sniff decoder;
+    uint32_t blocks;
+    uint32_t overflows;
+    uint32_t stalls;
+};
+
+struct uart_sniff_line {
+    int64_t timestamp;
+    uint8_t channel;
+    uint8_t flags;
+    uint8_t len;
+    uint8_t data[SERIAL_DEBUG_UART_SNIFF_LINE_SIZE];
+};
+
+static struct {
+    volatile bool run;
+    volatile int tasks;
+    int num;
+    uint32_t tick_hz;
+    int64_t idle_us;
+    int64_t hold_us;
+    rmt_receive_config_t receive;
+    QueueHandle_t queue;
+    struct uart_sniff_channel channels[SERIAL_DEBUG_UART_SNIFF_CHANNEL_NUM];
+    struct protocol_uart_sniff_merge merge;
+    struct protocol_uart_sniff_byte *entries;
+    struct uart_sniff_line line;
+    Shell *shell;
+} sniff = {0};
+
+static portMUX_TYPE sniff_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool IRAM_ATTR serial_debug_uart_sniff_done(rmt_channel_handle_t channel,
+                                                   const rmt_rx_done_event_data_t *edata, void *user_ctx)
+{
+    BaseType_t woken = pdFALSE;
+    struct uart_sniff_channel *sniff_channel = &sniff.channels[(uintptr_t) user_ctx];
+    struct uart_sniff_event event = {
+        .channel = (uint8_t) (uintptr_t) user_ctx,
+        .buffer = sniff_channel->active,
+        .num = edata->num_symbols,
+        .armed = sniff_channel->armed,
+        .end = esp_timer_get_time(),
+    };
+
+    /* re-arm right away, the line may already be busy again */
+    portENTER_CRITICAL_ISR(&sniff_lock);
+    sniff_channel->pending |= 1 << event.buffer;
+    if (sniff_channel->pending & (1 << (event.buffer ^ 1))) {
+        sniff_channel->stalled = true;
+    } else {
+        sniff_channel->active = event.buffer ^ 1;
+        sniff_channel->armed = event.end;
+        rmt_receive(channel, sniff_channel->buffers[sniff_channel->active],
+                    SERIAL_DEBUG_UART_SNIFF_SYMBOLS * sizeof(uint32_t), &sniff.receive);
+    }
+    portEXIT_CRITICAL_ISR(&sniff_lock);
+    xQueueSendFromISR(sniff.queue, &event, &woken);
+    return woken == pdTRUE;
+}
+
+static void serial_debug_uart_sniff_flush(void)
+{
+    struct uart_sniff_line *line = &sniff.line;
+    if (line->len == 0) {
+        return;
+    }
+    protocol_capture_write_flags(PROTOCOL_CAPTURE_SOURCE_UART, PROTOCOL_CAPTURE_DIR_RX, line->channel,
+                                 line->flags ? PROTOCOL_CAPTURE_FLAG_ERROR : 0,
+                                 line->timestamp, line->data, line->len);
+    if (sniff.shell) {
+        char text[16 + SERIAL_DEBUG_UART_SNIFF_LINE_SIZE * 3 + 4];
+        int pos = snprintf(text, sizeof(text), "%lld.%06lld %d%s:", line->timestamp / 1000000,
+                           line->timestamp % 1000000, line->channel, line->flags ? "!" : "");
+        for (int i = 0; i < line->len; i++) {
+            pos += snprintf(text + pos, sizeof(text) - pos, " %02x", line->data[i]);
+        }
+        shellPrint(sniff.shell, "%s\r\n", text);
+    }
+    line->len = 0;
+}
+
+/**
+ * @brief merged output, consecutive bytes of one channel are grouped into a
+ *        capture record and a printed line
+ */
+static void serial_debug_uart_sniff_output(void *param, const struct protocol_uart_sniff_byte *byte)
+{
+    struct uart_sniff_line *line = &sniff.line;
+    if (line->len && (line->channel != byte->channel || line->len == SERIAL_DEBUG_UART_SNIFF_LINE_SIZE)) {
+        serial_debug_uart_sniff_flush();
+    }
+    if (line->len == 0) {
+        line->timestamp = byte->timestamp;
+        line->channel = byte->channel;
+        line->flags = 0;
+    }
+    line->data[line->len++] = byte->data;
+    line->flags |= byte->flags;
+    protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_RX, 1);
+    if (byte->flags) {
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_ERRORS, 1);
+    }
+}
+
+static void serial_debug_uart_sniff_push(void *param, const struct protocol_uart_sniff_byte *byte)
+{
+    protocol_uart_sniff_merge_push(&sniff.merge, byte, serial_debug_uart_sniff_output, NULL);
+}
+
+/**
+ * @brief decode a finished block and release its buffer
+ *
+ * a block that ended on idle is timed back from the done interrupt. a full
+ * buffer was truncated, the driver drops the symbols past its end and still
+ * reports at the idle, so the end tells nothing about the start. such a
+ * block is anchored at the time it was armed, which is exact for back to
+ * back traffic, the usual cause of an overflow
+ */
+static void serial_debug_uart_sniff_block(const struct uart_sniff_event *event)
+{
+    struct uart_sniff_channel *channel = &sniff.channels[event->channel];
+    uint32_t *symbols = channel->buffers[event->buffer];
+
+    int64_t start;
+    channel->blocks++;
+    if (event->num >= SERIAL_DEBUG_UART_SNIFF_SYMBOLS) {
+        channel->overflows++;
+        protocol_stats_add(PROTOCOL_STATS_SOURCE_UART, PROTOCOL_STATS_OVERRUN, 1);
+        start = event->armed;
+    } else {
+        uint64_t ticks = 0;
+        for (size_t i = 0; i < event->num; i++) {
+            ticks += (symbols[i] & 0x7FFF) + ((symbols[i] >> 16) & 0x7FFF);
+        }
+        start = event->end - sniff.idle_us - (int64_t) (ticks * 1000000 / sniff.tick_hz);
+    }
+    protocol_uart_sniff_decode(&channel->decoder, symbols, event->num, start,
+                               serial_debug_uart_sniff_push, NULL);
+
+    bool rearm = false;
+    portENTER_CRITICAL(&sniff_lock);
+    channel->pending &= ~(1 << event->buffer);
+    if (channel->stalled) {
+        channel->stalled = false;
+        channel->active = event->buffer;
+        channel->armed = esp_timer_get_time();
+        channel->stalls++;
+        rearm = true;
+    }
+    portEXIT_CRITICAL(&sniff_lock);
+    if (rearm) {
+        rmt_receive(channel->rmt, symbols, SERIAL_DEBUG_UART_SNIFF_SYMBOLS * sizeof(uint32_t), &sniff.receive);
+    }
+}
+
+static void serial_debug_uart_sniff_task(void *param)
+{
+    struct uart_sniff_event event;
+
+    for (int i = 0; i < sniff.num; i++) {
+        sniff.channels[i].armed = esp_timer_get_time();
+        rmt_receive(sniff.channels[i].rmt, sniff.channels[i].buffers[0],
+                    SERIAL_DEBUG_UART_SNIFF_SYMBOLS * sizeof(uint32_t), &sniff.receive);
+    }
+    while (sniff.run) {
+        if (xQueueReceive(sniff.queue, &event, pdMS_TO_TICKS(10)) == pdTRUE) {
+            serial_debug_uart_sniff_block(&event);
+            while (xQueueReceive(sniff.queue, &event, 0) == pdTRUE) {
+                serial_debug_uart_sniff_block(&event);
+            }
+        }
+        if (protocol_uart_sniff_merge_pop(&sniff.merge, esp_timer_get_time() - sniff.hold_us,
+                                          serial_debug_uart_sniff_output, NULL)) {
+            serial_debug_uart_sniff_flush();
+        }
+    }
+    protocol_uart_sniff_merge_pop(&sniff.merge, INT64_MAX, serial_debug_uart_sniff_output, NULL);
+    serial_debug_uart_sniff_flush();
+    __atomic_fetch_sub(&sniff.tasks, 1, __ATOMIC_RELEASE);
+    vTaskDelete(NULL);
+}
+
+bool serial_debug_uart_sniff_running(void)
+{
+    return sniff.run;
+}
+
+static void serial_debug_uart_sniff_free(void)
+{
+    for (int i = 0; i < SERIAL_DEBUG_UART_SNIFF_CHANNEL_NUM; i++) {
+        struct uart_sniff_channel *channel = &sniff.channels[i];
+        if (channel->rmt) {
+            rmt_disable(channel->rmt);
+            rmt_del_channel(channel->rmt);
+            channel->rmt = NULL;
+        }
+        heap_caps_free(channel->buffers[0]);
+        heap_caps_free(channel->buffers[1]);
+        channel->buffers[0] = channel->buffers[1] = NULL;
+    }
+    heap_caps_free(sniff.entries);
+    sniff.entries = NULL;
+    if (sniff.queue) {
+        vQueueDelete(sniff.queue);
+        sniff.queue = NULL;
+    }
+    sniff.num = 0;
+}
+
+/**
+ * @brief start the sniffer
+ *
+ * the rmt resolution is an integer division of the 80 MHz source giving at
+ * least 16 ticks per bit, the pins are configured as plain inputs so the
+ * sniffer never drives the lines it listens to, a pin is not usable as an
+ * output of this board while it is sniffed
+ *
+ * @param baudrate baudrate of all channels, up to 1 Mbaud
+ * @param parity 0 none, 1 even, 2 odd
+ * @param pins header pins, 0 for unused
+ */
+static void serial_debug_uart_sniff_start(int baudrate, int parity, int pin0, int pin1, int pin2, int pin3)
+{
+    int pins[SERIAL_DEBUG_UART_SNIFF_CHANNEL_NUM] = {pin0, pin1, pin2, pin3};
+
+    if (sniff.run) {
+        shellPrint(shellGetCurrent(), "sniffer already running\r\n");
+        return;
+    }
+    if (baudrate <= 0 || baudrate > SERIAL_DEBUG_UART_SNIFF_MAX_BAUDRATE || parity < 0 || parity > 2) {
+        shellPrint(shellGetCurrent(), "param error\r\n");
+        return;
+    }
+    uint32_t div = SERIAL_DEBUG_UART_SNIFF_CLK_HZ / (baudrate * SERIAL_DEBUG_UART_SNIFF_TICKS_PER_BIT);
+    div = div < 1 ? 1 : div > 256 ? 256 : div;
+    sniff.tick_hz = SERIAL_DEBUG_UART_SNIFF_CLK_HZ / div;
+    uint32_t bit_ns = 1000000000 / baudrate;
+    sniff.receive.signal_range_min_ns = bit_ns / 4 < 3000 ? bit_ns / 4 : 3000;
+    sniff.receive.signal_range_max_ns = bit_ns * SERIAL_DEBUG_UART_SNIFF_IDLE_BITS;
+    sniff.idle_us = sniff.receive.signal_range_max_ns / 1000;
+    /* a block holds at most this much line time, bytes are held that long */
+    sniff.hold_us = (int64_t) SERIAL_DEBUG_UART_SNIFF_SYMBOLS * sniff.receive.signal_range_max_ns / 1000;
+    if (sniff.hold_us > SERIAL_DEBUG_UART_SNIFF_HOLD_MAX_US) {
+        sniff.hold_us = SERIAL_DEBUG_UART_SNIFF_HOLD_MAX_US;
+    }
+
+    sniff.queue = xQueueCreate(SERIAL_DEBUG_UART_SNIFF_QUEUE_SIZE, sizeof(struct uart_sniff_event));
+    sniff.entries = heap_caps_malloc(SERIAL_DEBUG_UART_SNIFF_MERGE_SIZE * sizeof(struct protocol_uart_sniff_byte),
+                                     MALLOC_CAP_DEFAULT);
+    if (!sniff.queue || !sniff.entries) {
+        goto error;
+    }
+    protocol_uart_sniff_merge_init(&sniff.merge, sniff.entries, SERIAL_DEBUG_UART_SNIFF_MERGE_SIZE);
+    sniff.line.len = 0;
+
+    for (int i = 0; i < SERIAL_DEBUG_UART_SNIFF_CHANNEL_NUM; i++) {
+        if (pins[i] <= 0) {
+            continue;
+        }
+        struct uart_sniff_channel *channel = &sniff.channels[sniff.num];
+        memset(channel, 0, sizeof(*channel));
+        channel->io = protocol_get_io(pins[i]);
+        channel->buffers[0] = heap_caps_malloc(SERIAL_DEBUG_UART_SNIFF_SYMBOLS * sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+        channel->buffers[1] = heap_caps_malloc(SERIAL_DEBUG_UART_SNIFF_SYMBOLS * sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+        sniff.num++;
+        if (!channel->buffers[0] || !channel->buffers[1]) {
+            goto error;
+        }
+        rmt_rx_channel_config_t config = {
+            .gpio_num = channel->io,
+            .clk_src = RMT_CLK_SRC_DEFAULT,
+            .resolution_hz = sniff.tick_hz,
+            .mem_block_symbols = SERIAL_DEBUG_UART_SNIFF_MEM_SYMBOLS,
+        };
+        rmt_rx_event_callbacks_t callbacks = {
+            .on_recv_done = serial_debug_uart_sniff_done,
+        };
+        if (rmt_new_rx_channel(&config, &channel->rmt) != ESP_OK
+            || rmt_rx_register_event_callbacks(channel->rmt, &callbacks, (void *) (uintptr_t) (sniff.num - 1)) != ESP_OK
+            || rmt_enable(channel->rmt) != ESP_OK) {
+            goto error;
+        }
+        protocol_uart_sniff_init(&channel->decoder, i, sniff.tick_hz, baudrate, parity);
+        ESP_LOGI(TAG, "channel %d on io %d", i, channel->io);
+    }
+    if (sniff.num == 0) {
+        shellPrint(shellGetCurrent(), "no pin given\r\n");
+        goto error;
+    }
+    shellPrint(shellGetCurrent(), "%d channels, %lu ticks per bit, bytes held %lld ms for ordering\r\n",
+               sniff.num, (unsigned long) (sniff.tick_hz / baudrate), sniff.hold_us / 1000);
+    sniff.shell = shellGetCurrent();
+    sniff.run = true;
+    sniff.tasks = 1;
+    if (xTaskCreatePinnedToCore(serial_debug_uart_sniff_task, "uartSniff", 4096, NULL, 5, NULL, 1) != pdPASS) {
+        sniff.run = false;
+        sniff.tasks = 0;
+        sniff.shell = NULL;
+        goto error;
+    }
+    return;
+
+error:
+    ESP_LOGE(TAG, "sniffer start failed");
+    serial_debug_uart_sniff_free();
+}
+
+void serial_debug_uart_sniff_stop(void)
+{
+    if (!sniff.run) {
+        return;
+    }
+    sniff.run = false;
+    while (__atomic_load_n(&sniff.tasks, __ATOMIC_ACQUIRE) > 0) {
+        vTaskDelay(1);
+    }
+    serial_debug_uart_sniff_free();
+    sniff.shell = NULL;
+}
+
+static void serial_debug_uart_sniff_stat(void)
+{
+    for (int i = 0; i < sniff.num; i++) {
+        struct uart_sniff_channel *channel = &sniff.channels[i];
+        shellPrint(shellGetCurrent(), "channel %d io %d: %lu bytes, %lu errors, %lu blocks, %lu overflows, %lu stalls\r\n",
+                   channel->decoder.channel, channel->io,
+                   (unsigned long) channel->decoder.bytes, (unsigned long) channel->decoder.errors,
+                   (unsigned long) channel->blocks, (unsigned long) channel->overflows,
+                   (unsigned long) channel->stalls);
+    }
+    shellPrint(shellGetCurrent(), "merge: %u pending, %lu released out of order\r\n",
+               (unsigned) sniff.merge.count, (unsigned long) sniff.merge.forced);
+}
+
+static ShellCommand uart_sniff_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, start, serial_debug_uart_sniff_start,
+        start sniffer\r\nuartsniff start [baudrate] [parity: 0 none/1 even/2 odd] [pin0] [pin1] [pin2] [pin3]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stop, serial_debug_uart_sniff_stop,
+        stop sniffer\r\nuartsniff stop),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, stat, serial_debug_uart_sniff_stat,
+        show channel statistics\r\nuartsniff stat),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+uartsniff, uart_sniff_group, multi channel uart sniffer);
@@ -0,0 +1,17 @@
+/**
+ * @file serial_debug_uart_sniff.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief serial debug multi channel uart sniffer
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __SERIAL_DEBUG_UART_SNIFF_H__
+#define __SERIAL_DEBUG_UART_SNIFF_H__
+
+#include <stdbool.h>
+
+bool serial_debug_uart_sniff_running(void);
+void serial_debug_uart_sniff_stop(void);
+
+#endif /* __SERIAL_DEBUG_UART_SNIFF_H__ */
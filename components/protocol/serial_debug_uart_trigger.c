@@ -0,0 +1,305 @@
+/**
+ * @file serial_debug_uart_trigger.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief serial debug uart trigger
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "shell.h"
+#include "shell_cmd_group.h"
+#include "shell_ext.h"
+#include "string.h"
+#include "cpost.h"
+#include "misc/lv_palette.h"
+#include "protocol_capture.h"
+#include "protocol_common.h"
+#include "protocol_matcher.h"
+#include "serial_debug_uart_trigger.h"
+
+#define SERIAL_DEBUG_UART_TRIGGER_MAX_NUM 16
+#define SERIAL_DEBUG_UART_TRIGGER_MAX_LEN 32
+#define SERIAL_DEBUG_UART_TRIGGER_BENCH_SIZE 16384
+
+#define SERIAL_DEBUG_UART_TRIGGER_ACTION_LOG 0
+#define SERIAL_DEBUG_UART_TRIGGER_ACTION_CAPTURE_START 1
+#define SERIAL_DEBUG_UART_TRIGGER_ACTION_CAPTURE_STOP 2
+#define SERIAL_DEBUG_UART_TRIGGER_ACTION_GPIO 3
+
+static const char *TAG = "serial_debug_uart_trigger";
+
+struct uart_trigger {
+    uint8_t data[SERIAL_DEBUG_UART_TRIGGER_MAX_LEN];
+    uint8_t len;
+    uint8_t action;
+    long hits;
+    int64_t last_hit;
+};
+
+static const char *trigger_action_name[] = {
+    [SERIAL_DEBUG_UART_TRIGGER_ACTION_LOG] = "Log",
+    [SERIAL_DEBUG_UART_TRIGGER_ACTION_CAPTURE_START] = "Capture start",
+    [SERIAL_DEBUG_UART_TRIGGER_ACTION_CAPTURE_STOP] = "Capture stop",
+    [SERIAL_DEBUG_UART_TRIGGER_ACTION_GPIO] = "GPIO toggle",
+};
+
+static struct uart_trigger triggers[SERIAL_DEBUG_UART_TRIGGER_MAX_NUM];
+static int trigger_num = 0;
+static int trigger_gpio_io = -1;
+static int trigger_gpio_pin = 0;
+static int trigger_gpio_level = 0;
+
+static struct protocol_matcher matcher = {0};
+static SemaphoreHandle_t trigger_mutex = NULL;
+
+static void serial_debug_uart_trigger_capture_start(void *param)
+{
+    protocol_capture_start(NULL);
+}
+
+static void serial_debug_uart_trigger_capture_stop(void *param)
+{
+    protocol_capture_stop();
+}
+
+/**
+ * @brief matcher hit, runs inside `serial_debug_uart_trigger_feed` with
+ *        `trigger_mutex` held, so the trigger table can not change under it
+ */
+static void serial_debug_uart_trigger_hit(void *param, uint32_t mask, size_t offset)
+{
+    int64_t timestamp = *(int64_t *) param;
+
+    for (int i = 0; mask && i < trigger_num; i++, mask >>= 1) {
+        if (!(mask & 1)) {
+            continue;
+        }
+        triggers[i].hits++;
+        triggers[i].last_hit = timestamp;
+        switch (triggers[i].action) {
+        case SERIAL_DEBUG_UART_TRIGGER_ACTION_LOG:
+            ESP_LOGI(TAG, "trigger %d hit at %lld us", i, timestamp);
+            break;
+        case SERIAL_DEBUG_UART_TRIGGER_ACTION_CAPTURE_START:
+            if (!protocol_capture_running()) {
+                cpost(0, serial_debug_uart_trigger_capture_start, NULL);
+            }
+            break;
+        case SERIAL_DEBUG_UART_TRIGGER_ACTION_CAPTURE_STOP:
+            if (protocol_capture_running()) {
+                cpost(0, serial_debug_uart_trigger_capture_stop, NULL);
+            }
+            break;
+        case SERIAL_DEBUG_UART_TRIGGER_ACTION_GPIO:
+            if (trigger_gpio_io >= 0) {
+                trigger_gpio_level = !trigger_gpio_level;
+                gpio_set_level(trigger_gpio_io, trigger_gpio_level);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief run triggers on a received chunk, called from the uart task
+ *
+ * @param data data
+ * @param len data length
+ * @param timestamp chunk timestamp
+ */
+void serial_debug_uart_trigger_feed(const uint8_t *data, size_t len, int64_t timestamp)
+{
+    if (!trigger_mutex || !matcher.table) {
+        return;
+    }
+    xSemaphoreTake(trigger_mutex, portMAX_DELAY);
+    protocol_matcher_feed(&matcher, data, len, serial_debug_uart_trigger_hit, &timestamp);
+    xSemaphoreGive(trigger_mutex);
+}
+
+/**
+ * @brief compile the trigger list and swap it in, the automaton is built
+ *        outside the lock so the uart task is only blocked by the swap
+ *
+ * @param num trigger number, published together with the automaton
+ */
+static int serial_debug_uart_trigger_compile(int num)
+{
+    struct protocol_matcher_pattern patterns[SERIAL_DEBUG_UART_TRIGGER_MAX_NUM];
+    struct protocol_matcher compiled = {0};
+
+    if (!trigger_mutex) {
+        trigger_mutex = xSemaphoreCreateMutex();
+    }
+    for (int i = 0; i < num; i++) {
+        patterns[i].data = triggers[i].data;
+        patterns[i].len = triggers[i].len;
+    }
+    if (num > 0 && protocol_matcher_compile(&compiled, patterns, num) != 0) {
+        return -1;
+    }
+    xSemaphoreTake(trigger_mutex, portMAX_DELAY);
+    struct protocol_matcher old = matcher;
+    matcher = compiled;
+    trigger_num = num;
+    xSemaphoreGive(trigger_mutex);
+    protocol_matcher_free(&old);
+    return 0;
+}
+
+static void serial_debug_uart_trigger_add_data(int action, const uint8_t *data, int len)
+{
+    if (trigger_num >= SERIAL_DEBUG_UART_TRIGGER_MAX_NUM) {
+        shellPrint(shellGetCurrent(), "too many triggers\r\n");
+        return;
+    }
+    if (action < SERIAL_DEBUG_UART_TRIGGER_ACTION_LOG || action > SERIAL_DEBUG_UART_TRIGGER_ACTION_GPIO) {
+        shellPrint(shellGetCurrent(), "action param error\r\n");
+        return;
+    }
+    if (len <= 0 || len > SERIAL_DEBUG_UART_TRIGGER_MAX_LEN) {
+        shellPrint(shellGetCurrent(), "pattern length should be 1 ~ %d\r\n", SERIAL_DEBUG_UART_TRIGGER_MAX_LEN);
+        return;
+    }
+    /* the slot past trigger_num is not seen by the uart task until the swap */
+    struct uart_trigger *trigger = &triggers[trigger_num];
+    memset(trigger, 0, sizeof(struct uart_trigger));
+    memcpy(trigger->data, data, len);
+    trigger->len = len;
+    trigger->action = action;
+    if (serial_debug_uart_trigger_compile(trigger_num + 1) != 0) {
+        shellPrint(shellGetCurrent(), "trigger compile failed\r\n");
+    }
+}
+
+static void serial_debug_uart_trigger_add(uint8_t action, uint8_t *data)
+{
+    serial_debug_uart_trigger_add_data(action, data, shellGetArrayParamSize(data));
+}
+
+static void serial_debug_uart_trigger_add_string(int action, char *str)
+{
+    serial_debug_uart_trigger_add_data(action, (const uint8_t *) str, str ? strlen(str) : 0);
+}
+
+static void serial_debug_uart_trigger_clear(void)
+{
+    serial_debug_uart_trigger_compile(0);
+}
+
+static void serial_debug_uart_trigger_list(void)
+{
+    if (trigger_mutex) {
+        xSemaphoreTake(trigger_mutex, portMAX_DELAY);
+    }
+    for (int i = 0; i < trigger_num; i++) {
+        shellPrint(shellGetCurrent(), "%d: %s, hits: %ld, last: %lld us, pattern:",
+                   i, trigger_action_name[triggers[i].action], triggers[i].hits, triggers[i].last_hit);
+        for (int j = 0; j < triggers[i].len; j++) {
+            shellPrint(shellGetCurrent(), " %02x", triggers[i].data[j]);
+        }
+        shellPrint(shellGetCurrent(), "\r\n");
+    }
+    if (matcher.table) {
+        shellPrint(shellGetCurrent(), "states: %d, byte classes: %d\r\n", matcher.state_num, matcher.class_num);
+    }
+    if (trigger_mutex) {
+        xSemaphoreGive(trigger_mutex);
+    }
+}
+
+static void serial_debug_uart_trigger_set_gpio(int pin)
+{
+    int io = protocol_get_io(pin);
+    if (io < 0) {
+        shellPrint(shellGetCurrent(), "pin param error\r\n");
+        return;
+    }
+    if (trigger_gpio_io >= 0) {
+        gpio_reset_pin(trigger_gpio_io);
+        protocol_set_pin(trigger_gpio_pin, NULL, lv_palette_main(LV_PALETTE_GREY));
+    }
+    trigger_gpio_io = io;
+    trigger_gpio_pin = pin;
+    protocol_set_pin(pin, "TRIG", lv_palette_main(LV_PALETTE_ORANGE));
+    gpio_set_direction(trigger_gpio_io, GPIO_MODE_OUTPUT);
+    trigger_gpio_level = 0;
+    gpio_set_level(trigger_gpio_io, trigger_gpio_level);
+}
+
+/**
+ * @brief measure per byte cost of the matcher with random patterns on random data
+ *
+ * @param max_patterns max pattern number, doubled from 1
+ */
+static void serial_debug_uart_trigger_bench(int max_patterns)
+{
+    struct protocol_matcher bench;
+    struct protocol_matcher_pattern patterns[PROTOCOL_MATCHER_MAX_PATTERNS];
+
+    if (max_patterns <= 0 || max_patterns > PROTOCOL_MATCHER_MAX_PATTERNS) {
+        max_patterns = PROTOCOL_MATCHER_MAX_PATTERNS;
+    }
+    uint8_t *data = heap_caps_malloc(SERIAL_DEBUG_UART_TRIGGER_BENCH_SIZE, MALLOC_CAP_INTERNAL);
+    uint8_t *pattern_data = heap_caps_malloc(max_patterns * 8, MALLOC_CAP_INTERNAL);
+    if (!data || !pattern_data) {
+        shellPrint(shellGetCurrent(), "malloc failed\r\n");
+        heap_caps_free(data);
+        heap_caps_free(pattern_data);
+        return;
+    }
+    esp_fill_random(data, SERIAL_DEBUG_UART_TRIGGER_BENCH_SIZE);
+    esp_fill_random(pattern_data, max_patterns * 8);
+    for (int i = 0; i < max_patterns; i++) {
+        patterns[i].data = pattern_data + i * 8;
+        patterns[i].len = 8;
+    }
+    for (int num = 1; num <= max_patterns; num <<= 1) {
+        if (protocol_matcher_compile(&bench, patterns, num) != 0) {
+            shellPrint(shellGetCurrent(), "%d patterns: compile failed\r\n", num);
+            break;
+        }
+        int64_t start = esp_timer_get_time();
+        protocol_matcher_feed(&bench, data, SERIAL_DEBUG_UART_TRIGGER_BENCH_SIZE, NULL, NULL);
+        int64_t cost = esp_timer_get_time() - start;
+        shellPrint(shellGetCurrent(), "%d patterns: %d states, %d ns/byte\r\n", num, bench.state_num,
+                   (int) (cost * 1000 / SERIAL_DEBUG_UART_TRIGGER_BENCH_SIZE));
+        protocol_matcher_free(&bench);
+    }
+    heap_caps_free(data);
+    heap_caps_free(pattern_data);
+}
+
+static ShellCommand trigger_group[] =
+{
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, add, serial_debug_uart_trigger_add,
+        add uart trigger\r\ntrigger add [action] [data]\r\n
+        action:\r\n
+        0 - Log timestamp\r\n
+        1 - Capture start\r\n
+        2 - Capture stop\r\n
+        3 - GPIO toggle, .data.cmd.signature="q[q"),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, addstr, serial_debug_uart_trigger_add_string,
+        add uart trigger with string pattern\r\ntrigger addstr [action] [str]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, clear, serial_debug_uart_trigger_clear,
+        clear uart triggers\r\ntrigger clear),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, list, serial_debug_uart_trigger_list,
+        list uart triggers\r\ntrigger list),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, gpio, serial_debug_uart_trigger_set_gpio,
+        set pin toggled by gpio action\r\ntrigger gpio [pin]),
+    SHELL_CMD_GROUP_ITEM(SHELL_TYPE_CMD_FUNC, bench, serial_debug_uart_trigger_bench,
+        trigger matcher benchmark\r\ntrigger bench [max patterns]),
+    SHELL_CMD_GROUP_END()
+};
+SHELL_EXPORT_CMD_GROUP(
+SHELL_CMD_PERMISSION(0)|SHELL_CMD_TYPE(SHELL_TYPE_CMD_MAIN)|SHELL_CMD_DISABLE_RETURN,
+trigger, trigger_group, uart trigger tool);
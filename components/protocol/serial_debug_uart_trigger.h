@@ -0,0 +1,17 @@
+/**
+ * @file serial_debug_uart_trigger.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief serial debug uart trigger
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __SERIAL_DEBUG_UART_TRIGGER_H__
+#define __SERIAL_DEBUG_UART_TRIGGER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+void serial_debug_uart_trigger_feed(const uint8_t *data, size_t len, int64_t timestamp);
+
+#endif /* __SERIAL_DEBUG_UART_TRIGGER_H__ */
@@ -44,7 +44,20 @@ signed short userShellWrite(char *data, unsigned short len)
  */
 signed short userShellRead(char *data, unsigned short len)
 {
-    return uart_read_bytes(SHELL_UART, (uint8_t *)data, len, portMAX_DELAY);
+    int ret = uart_read_bytes(SHELL_UART, (uint8_t *)data, 1, portMAX_DELAY);
+    if (ret <= 0 || len <= 1) {
+        return ret;
+    }
+    size_t buffered = 0;
+    uart_get_buffered_data_len(SHELL_UART, &buffered);
+    if (buffered > len - 1) {
+        buffered = len - 1;
+    }
+    if (buffered > 0) {
+        int more = uart_read_bytes(SHELL_UART, (uint8_t *)data + 1, buffered, 0);
+        ret += more > 0 ? more : 0;
+    }
+    return ret;
 }
 
 
@@ -62,7 +75,7 @@ RtAppErr userShellInit(void)
         .flow_ctrl = UART_HW_FLOWCTRL_DISABLE
     };
     uart_param_config(SHELL_UART, &uartConfig);
-    uart_driver_install(SHELL_UART, 256 * 2, 0, 0, NULL, 0);
+    uart_driver_install(SHELL_UART, 256 * 8, 0, 0, NULL, 0);
     shell.write = userShellWrite;
     shell.read = userShellRead;
     shellInit(&shell, shellBuffer, 512);
@@ -24,9 +24,12 @@
 #include "rtam.h"
 #include "shell.h"
 #include "storage.h"
+#include "usb_device.h"
 
 #define USB_DEVICE_USER_TINYUSB
 
+#define USB_DEVICE_CDC_WRITE_TIMEOUT pdMS_TO_TICKS(100)
+
 static const char *TAG = "usb_device";
 
 static Shell cdc_shell = {0};
@@ -38,6 +41,7 @@ struct {
     size_t read;
     size_t write;
 } cdc_ringbuf;
+static const struct usb_device_cdc_bridge *cdc_bridge = NULL;
 #elif defined(CONFIG_ESP_CONSOLE_USB_CDC)
 int cdc_handle = -1;
 #endif
@@ -75,7 +79,7 @@ static signed short cdc_shell_read(char *data, unsigned short len)
     size_t read = len > remain ? remain : len;
     for (size_t i = 0; i < read; i++) {
         data[i] = cdc_ringbuf.buffer[cdc_ringbuf.read++];
-        if (cdc_ringbuf.read > CONFIG_TINYUSB_CDC_RX_BUFSIZE) {
+        if (cdc_ringbuf.read >= CONFIG_TINYUSB_CDC_RX_BUFSIZE) {
             cdc_ringbuf.read = 0;
         }
     }
@@ -125,9 +129,14 @@ void tinyusb_cdc_rx_callback(int itf, cdcacm_event_t *event)
     if (ret != ESP_OK || rx_size <= 0) {
         return;
     }
+    const struct usb_device_cdc_bridge *bridge = cdc_bridge;
+    if (bridge && bridge->rx) {
+        bridge->rx(buf, rx_size);
+        return;
+    }
     for (size_t i = 0; i < rx_size; i++) {
         cdc_ringbuf.buffer[cdc_ringbuf.write++] = buf[i];
-        if (cdc_ringbuf.write > CONFIG_TINYUSB_CDC_RX_BUFSIZE) {
+        if (cdc_ringbuf.write >= CONFIG_TINYUSB_CDC_RX_BUFSIZE) {
             cdc_ringbuf.write = 0;
         }
     }
@@ -142,8 +151,58 @@ void tinyusb_cdc_line_state_changed_callback(int itf, cdcacm_event_t *event)
     int rts = event->line_state_changed_data.rts;
     ESP_LOGI(TAG, "Line state changed on channel %d: DTR:%d, RTS:%d", itf, dtr, rts);
 }
+
+void tinyusb_cdc_line_coding_changed_callback(int itf, cdcacm_event_t *event)
+{
+    const cdc_line_coding_t *coding = event->line_coding_changed_data.p_line_coding;
+    ESP_LOGI(TAG, "Line coding changed on channel %d: %d %d%c%d", itf,
+             (int) coding->bit_rate, coding->data_bits,
+             "NOEMS"[coding->parity < 5 ? coding->parity : 0], coding->stop_bits);
+    const struct usb_device_cdc_bridge *bridge = cdc_bridge;
+    if (bridge && bridge->line_coding) {
+        bridge->line_coding(coding->bit_rate, coding->data_bits, coding->parity, coding->stop_bits);
+    }
+}
 #endif
 
+/**
+ * @brief attach a bridge to the cdc port, received data bypasses the cdc shell
+ *
+ * @param bridge bridge, NULL to give the port back to the cdc shell
+ */
+void usb_device_cdc_set_bridge(const struct usb_device_cdc_bridge *bridge)
+{
+#if defined(USB_DEVICE_USER_TINYUSB)
+    cdc_bridge = bridge;
+#endif
+}
+
+/**
+ * @brief write data to the cdc port in bulk
+ *
+ * @param data data
+ * @param len data length
+ * @return size_t written length
+ */
+size_t usb_device_cdc_write(const uint8_t *data, size_t len)
+{
+#if defined(USB_DEVICE_USER_TINYUSB)
+    size_t written = 0;
+    while (written < len) {
+        size_t queued = tinyusb_cdcacm_write_queue(TINYUSB_CDC_ACM_0, data + written, len - written);
+        written += queued;
+        if (tinyusb_cdcacm_write_flush(TINYUSB_CDC_ACM_0,
+                                       written < len ? USB_DEVICE_CDC_WRITE_TIMEOUT : 0) == ESP_ERR_TIMEOUT
+            && queued == 0) {
+            break;
+        }
+    }
+    return written;
+#else
+    return 0;
+#endif
+}
+
 RtAppErr usb_device_init(void)
 {
 #if defined(USB_DEVICE_USER_TINYUSB)
@@ -156,7 +215,7 @@ RtAppErr usb_device_init(void)
         .callback_rx = tinyusb_cdc_rx_callback,
         .callback_rx_wanted_char = NULL,
         .callback_line_state_changed = tinyusb_cdc_line_state_changed_callback,
-        .callback_line_coding_changed = NULL
+        .callback_line_coding_changed = tinyusb_cdc_line_coding_changed_callback
     };
     ESP_ERROR_CHECK(tusb_cdc_acm_init(&acm_cfg));
 
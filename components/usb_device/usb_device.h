@@ -0,0 +1,30 @@
+/**
+ * @file usb_device.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief usb device
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __USB_DEVICE_H__
+#define __USB_DEVICE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief cdc bridge, takes over the cdc port from the cdc shell while attached
+ *
+ * line coding uses cdc encoding:
+ * parity: 0 - none, 1 - odd, 2 - even, 3 - mark, 4 - space
+ * stop bits: 0 - 1, 1 - 1.5, 2 - 2
+ */
+struct usb_device_cdc_bridge {
+    void (*rx)(const uint8_t *data, size_t len);
+    void (*line_coding)(uint32_t baudrate, uint8_t data_bits, uint8_t parity, uint8_t stop_bits);
+};
+
+void usb_device_cdc_set_bridge(const struct usb_device_cdc_bridge *bridge);
+size_t usb_device_cdc_write(const uint8_t *data, size_t len);
+
+#endif /* __USB_DEVICE_H__ */
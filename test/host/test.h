@@ -0,0 +1,44 @@
+/**
+ * @file test.h
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief minimal host test helpers
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#ifndef __TEST_H__
+#define __TEST_H__
+
+#include <stdio.h>
+
+static int test_failures = 0;
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define TEST_CHECK_EQ(actual, expected) \
+    do { \
+        long long test_actual = (long long) (actual); \
+        long long test_expected = (long long) (expected); \
+        if (test_actual != test_expected) { \
+            printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, \
+                   test_actual, test_expected); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define TEST_RUN(test) \
+    do { \
+        int test_before = test_failures; \
+        test(); \
+        printf("%s %s\n", test_failures == test_before ? "pass" : "FAIL", #test); \
+    } while (0)
+
+#define TEST_RESULT() (test_failures ? 1 : 0)
+
+#endif /* __TEST_H__ */
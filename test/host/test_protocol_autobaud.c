@@ -0,0 +1,70 @@
+/**
+ * @file test_protocol_autobaud.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the autobaud estimation
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "protocol_autobaud.h"
+#include "test.h"
+
+#define TICK_HZ 80000000
+
+/**
+ * @brief edges of 0x55 framed 8N1 at a baudrate, every bit toggles
+ */
+static size_t edges_of_0x55(uint32_t *edges, size_t num, uint32_t baudrate, uint32_t start)
+{
+    double bit = (double) TICK_HZ / baudrate;
+    for (size_t i = 0; i < num; i++) {
+        edges[i] = start + (uint32_t) (i * bit + 0.5);
+    }
+    return num;
+}
+
+static void test_standard_rates(void)
+{
+    static const uint32_t rates[] = {9600, 115200, 921600, 2000000};
+    uint32_t edges[10];
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        size_t num = edges_of_0x55(edges, 10, rates[i], 1000);
+        uint32_t pulse = protocol_autobaud_min_pulse(edges, num, TICK_HZ);
+        TEST_CHECK_EQ(protocol_autobaud_classify(pulse, TICK_HZ), rates[i]);
+    }
+}
+
+static void test_wrap_and_glitch(void)
+{
+    uint32_t edges[10];
+    size_t num = edges_of_0x55(edges, 10, 115200, UINT32_MAX - 2000);
+    /* a glitch shorter than a bit at the max baudrate is ignored */
+    edges[5] = edges[4] + 3;
+    uint32_t pulse = protocol_autobaud_min_pulse(edges, num, TICK_HZ);
+    TEST_CHECK_EQ(protocol_autobaud_classify(pulse, TICK_HZ), 115200);
+}
+
+static void test_snap(void)
+{
+    TEST_CHECK_EQ(protocol_autobaud_snap(117000), 115200);
+    TEST_CHECK_EQ(protocol_autobaud_snap(74000), 74880);
+    /* between 38400 and 57600, too far from both */
+    TEST_CHECK_EQ(protocol_autobaud_snap(48000), 0);
+    TEST_CHECK_EQ(protocol_autobaud_classify(TICK_HZ / 50000, TICK_HZ), 50000);
+    TEST_CHECK_EQ(protocol_autobaud_classify(0, TICK_HZ), 0);
+}
+
+static void test_not_enough_edges(void)
+{
+    uint32_t edges[1] = {100};
+    TEST_CHECK_EQ(protocol_autobaud_min_pulse(edges, 1, TICK_HZ), 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_standard_rates);
+    TEST_RUN(test_wrap_and_glitch);
+    TEST_RUN(test_snap);
+    TEST_RUN(test_not_enough_edges);
+    return TEST_RESULT();
+}
@@ -0,0 +1,153 @@
+/**
+ * @file test_protocol_decoder.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the uart frame decoders
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_decoder.h"
+#include "test.h"
+
+struct frames {
+    uint8_t data[4][PROTOCOL_DECODER_FRAME_SIZE];
+    size_t len[4];
+    uint8_t flags[4];
+    int64_t timestamp[4];
+    size_t num;
+};
+
+static void record(void *param, const struct protocol_decoder_frame *frame)
+{
+    struct frames *frames = param;
+    if (frames->num < 4) {
+        memcpy(frames->data[frames->num], frame->data, frame->len);
+        frames->len[frames->num] = frame->len;
+        frames->flags[frames->num] = frame->flags;
+        frames->timestamp[frames->num] = frame->timestamp;
+    }
+    frames->num++;
+}
+
+static void feed_text(struct protocol_decoder *decoder, const char *text, struct frames *frames)
+{
+    protocol_decoder_feed(decoder, (const uint8_t *) text, strlen(text), 0, record, frames);
+}
+
+static void test_line(void)
+{
+    struct protocol_decoder decoder;
+    struct frames frames = {0};
+
+    protocol_decoder_init(&decoder, PROTOCOL_DECODER_LINE, 115200);
+    feed_text(&decoder, "ab", &frames);
+    feed_text(&decoder, "c\r\n\r\n\nd\n", &frames);
+    /* blank lines give no frame */
+    TEST_CHECK_EQ(frames.num, 2);
+    TEST_CHECK_EQ(frames.len[0], 3);
+    TEST_CHECK(memcmp(frames.data[0], "abc", 3) == 0);
+    TEST_CHECK_EQ(frames.len[1], 1);
+}
+
+static void test_line_overflow(void)
+{
+    struct protocol_decoder decoder;
+    struct frames frames = {0};
+    char text[PROTOCOL_DECODER_FRAME_SIZE + 11];
+
+    memset(text, 'x', sizeof(text) - 2);
+    text[sizeof(text) - 2] = '\n';
+    text[sizeof(text) - 1] = 0;
+    protocol_decoder_init(&decoder, PROTOCOL_DECODER_LINE, 115200);
+    feed_text(&decoder, text, &frames);
+    TEST_CHECK_EQ(frames.num, 1);
+    TEST_CHECK_EQ(frames.len[0], PROTOCOL_DECODER_FRAME_SIZE);
+    TEST_CHECK_EQ(frames.flags[0], PROTOCOL_DECODER_FLAG_OVERFLOW);
+}
+
+static void test_slip(void)
+{
+    static const uint8_t stream[] = {0xC0, 0x01, 0xDB, 0xDC, 0xDB, 0xDD, 0x02, 0xC0, 0x03, 0xDB, 0x00, 0x04, 0xC0};
+    struct protocol_decoder decoder;
+    struct frames frames = {0};
+
+    protocol_decoder_init(&decoder, PROTOCOL_DECODER_SLIP, 115200);
+    protocol_decoder_feed(&decoder, stream, sizeof(stream), 0, record, &frames);
+    TEST_CHECK_EQ(frames.num, 3);
+    TEST_CHECK_EQ(frames.len[0], 4);
+    TEST_CHECK(memcmp(frames.data[0], "\x01\xC0\xDB\x02", 4) == 0);
+    /* a bad escape ends the frame with an error, the rest is a new frame */
+    TEST_CHECK_EQ(frames.flags[1], PROTOCOL_DECODER_FLAG_ERROR);
+    TEST_CHECK_EQ(frames.len[2], 1);
+    TEST_CHECK_EQ(frames.data[2][0], 0x04);
+}
+
+static void test_cobs(void)
+{
+    /* 11 22 00 33 encodes to 03 11 22 02 33 */
+    static const uint8_t stream[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00, 0x05, 0x11, 0x00};
+    struct protocol_decoder decoder;
+    struct frames frames = {0};
+
+    protocol_decoder_init(&decoder, PROTOCOL_DECODER_COBS, 115200);
+    protocol_decoder_feed(&decoder, stream, 3, 0, record, &frames);
+    protocol_decoder_feed(&decoder, stream + 3, sizeof(stream) - 3, 0, record, &frames);
+    TEST_CHECK_EQ(frames.num, 2);
+    TEST_CHECK_EQ(frames.len[0], 4);
+    TEST_CHECK(memcmp(frames.data[0], "\x11\x22\x00\x33", 4) == 0);
+    TEST_CHECK_EQ(frames.flags[0], 0);
+    /* the code points past the end of the frame */
+    TEST_CHECK_EQ(frames.flags[1], PROTOCOL_DECODER_FLAG_ERROR);
+}
+
+static void test_modbus(void)
+{
+    uint8_t frame[8] = {0x01, 0x03, 0x00, 0x00, 0x00, 0x01};
+    uint16_t crc = protocol_decoder_crc16(frame, 6);
+    struct protocol_decoder decoder;
+    struct frames frames = {0};
+    int64_t time = 1000000;
+
+    frame[6] = crc & 0xFF;
+    frame[7] = crc >> 8;
+    TEST_CHECK_EQ(crc, 0x0A84);
+    protocol_decoder_init(&decoder, PROTOCOL_DECODER_MODBUS, 115200);
+    /* two frames back to back in separate reads, 4 ms apart */
+    protocol_decoder_feed(&decoder, frame, 8, time, record, &frames);
+    protocol_decoder_feed(&decoder, frame, 8, time + 4000, record, &frames);
+    TEST_CHECK_EQ(frames.num, 1);
+    protocol_decoder_poll(&decoder, time + 5000, record, &frames);
+    TEST_CHECK_EQ(frames.num, 1);
+    protocol_decoder_poll(&decoder, time + 4000 + 1750, record, &frames);
+    TEST_CHECK_EQ(frames.num, 2);
+    TEST_CHECK_EQ(frames.len[0], 8);
+    TEST_CHECK_EQ(frames.flags[0], 0);
+    TEST_CHECK_EQ(frames.flags[1], 0);
+    /* the timestamp is the first char, 8 chars of 95 us before the read */
+    TEST_CHECK_EQ(frames.timestamp[0], time - 8 * 95);
+}
+
+static void test_modbus_crc_error(void)
+{
+    static const uint8_t frame[] = {0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00};
+    struct protocol_decoder decoder;
+    struct frames frames = {0};
+
+    protocol_decoder_init(&decoder, PROTOCOL_DECODER_MODBUS, 9600);
+    protocol_decoder_feed(&decoder, frame, sizeof(frame), 0, record, &frames);
+    protocol_decoder_poll(&decoder, 100000, record, &frames);
+    TEST_CHECK_EQ(frames.num, 1);
+    TEST_CHECK_EQ(frames.flags[0], PROTOCOL_DECODER_FLAG_ERROR);
+}
+
+int main(void)
+{
+    TEST_RUN(test_line);
+    TEST_RUN(test_line_overflow);
+    TEST_RUN(test_slip);
+    TEST_RUN(test_cobs);
+    TEST_RUN(test_modbus);
+    TEST_RUN(test_modbus_crc_error);
+    return TEST_RESULT();
+}
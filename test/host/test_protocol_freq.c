@@ -0,0 +1,114 @@
+/**
+ * @file test_protocol_freq.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the frequency counter math
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <math.h>
+#include <string.h>
+#include "protocol_freq.h"
+#include "test.h"
+
+static int near(double actual, double expected)
+{
+    return fabs(actual - expected) < 1e-9 * (fabs(expected) + 1);
+}
+
+static void test_stats(void)
+{
+    struct protocol_freq_stats stats;
+    const double values[] = {2, 4, 4, 4, 5, 5, 7, 9};
+
+    protocol_freq_stats_reset(&stats);
+    TEST_CHECK(protocol_freq_stats_stddev(&stats) == 0);
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        protocol_freq_stats_add(&stats, values[i]);
+    }
+    TEST_CHECK_EQ(stats.count, 8);
+    TEST_CHECK(stats.min == 2);
+    TEST_CHECK(stats.max == 9);
+    TEST_CHECK(near(stats.mean, 5));
+    TEST_CHECK(near(protocol_freq_stats_stddev(&stats), sqrt(32.0 / 7)));
+}
+
+static void test_gate(void)
+{
+    TEST_CHECK(near(protocol_freq_gate(1000, 1000000), 1000));
+    TEST_CHECK(near(protocol_freq_gate(3, 100000), 30));
+    TEST_CHECK(protocol_freq_gate(1000, 0) == 0);
+}
+
+static void test_capture(void)
+{
+    struct protocol_freq_capture capture;
+    struct protocol_freq_result result;
+    uint32_t period = 0;
+    uint32_t ticks = UINT32_MAX - 1500;
+
+    protocol_freq_capture_init(&capture, 1000000);
+    TEST_CHECK(!protocol_freq_capture_result(&capture, &result));
+
+    /* a falling edge before the first rising edge is not a high time */
+    TEST_CHECK(!protocol_freq_capture_edge(&capture, false, ticks - 100, &period));
+    TEST_CHECK(!protocol_freq_capture_edge(&capture, true, ticks, &period));
+    for (int i = 0; i < 4; i++) {
+        TEST_CHECK(!protocol_freq_capture_edge(&capture, false, ticks + 250, &period));
+        ticks += 1000;
+        TEST_CHECK(protocol_freq_capture_edge(&capture, true, ticks, &period));
+        TEST_CHECK_EQ(period, 1000);
+    }
+    TEST_CHECK(protocol_freq_capture_result(&capture, &result));
+    TEST_CHECK(near(result.freq, 1000));
+    TEST_CHECK(near(result.period, 0.001));
+    TEST_CHECK(near(result.width, 0.00025));
+    TEST_CHECK(near(result.duty, 0.25));
+    TEST_CHECK(!protocol_freq_capture_result(&capture, &result));
+
+    /* after lost edges the next rising edge only syncs */
+    protocol_freq_capture_lost(&capture);
+    TEST_CHECK(!protocol_freq_capture_edge(&capture, false, ticks + 100, &period));
+    TEST_CHECK(!protocol_freq_capture_edge(&capture, true, ticks + 3000, &period));
+    TEST_CHECK(!protocol_freq_capture_edge(&capture, false, ticks + 3500, &period));
+    TEST_CHECK(protocol_freq_capture_edge(&capture, true, ticks + 5000, &period));
+    TEST_CHECK_EQ(period, 2000);
+}
+
+static void test_select(void)
+{
+    uint32_t crossover = protocol_freq_crossover(80000000, 1000000);
+
+    TEST_CHECK_EQ(crossover, 8944);
+    TEST_CHECK_EQ(protocol_freq_crossover(80000000, 0), 0);
+    TEST_CHECK_EQ(protocol_freq_select(PROTOCOL_FREQ_MODE_GATE, 8000, crossover), PROTOCOL_FREQ_MODE_GATE);
+    TEST_CHECK_EQ(protocol_freq_select(PROTOCOL_FREQ_MODE_GATE, 5000, crossover), PROTOCOL_FREQ_MODE_CAPTURE);
+    TEST_CHECK_EQ(protocol_freq_select(PROTOCOL_FREQ_MODE_GATE, 0, crossover), PROTOCOL_FREQ_MODE_GATE);
+    TEST_CHECK_EQ(protocol_freq_select(PROTOCOL_FREQ_MODE_CAPTURE, 10000, crossover),
+                  PROTOCOL_FREQ_MODE_CAPTURE);
+    TEST_CHECK_EQ(protocol_freq_select(PROTOCOL_FREQ_MODE_CAPTURE, 12000, crossover), PROTOCOL_FREQ_MODE_GATE);
+}
+
+static void test_format(void)
+{
+    char buf[32];
+
+    protocol_freq_format(buf, sizeof(buf), 12345.678, 1);
+    TEST_CHECK(strcmp(buf, "12.346 kHz") == 0);
+    protocol_freq_format(buf, sizeof(buf), 1500000, 1000);
+    TEST_CHECK(strcmp(buf, "1.500 MHz") == 0);
+    protocol_freq_format(buf, sizeof(buf), 50, 0.01);
+    TEST_CHECK(strcmp(buf, "50.00 Hz") == 0);
+    TEST_CHECK_EQ(protocol_freq_format(buf, sizeof(buf), 999, 0), 6);
+    TEST_CHECK(strcmp(buf, "999 Hz") == 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_stats);
+    TEST_RUN(test_gate);
+    TEST_RUN(test_capture);
+    TEST_RUN(test_select);
+    TEST_RUN(test_format);
+    return TEST_RESULT();
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_protocol_i2c_script.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the i2c script compiler
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_i2c_script.h"
+#include "test.h"
+
+static struct protocol_i2c_script script;
+
+static int compile(const char *text)
+{
+    return protocol_i2c_script_compile(&script, text, strlen(text));
+}
+
+static void test_write_read(void)
+{
+    TEST_CHECK_EQ(compile("w 0x40 0xfe; r 0x40 2\nd 10\nr 0x41 1 # id"), 0);
+    /* start, write addr + reg, repeated start, read addr, read, stop, delay, start, read addr, read, stop */
+    TEST_CHECK_EQ(script.op_num, 11);
+    TEST_CHECK_EQ(script.ops[0].type, PROTOCOL_I2C_OP_START);
+    TEST_CHECK_EQ(script.ops[1].type, PROTOCOL_I2C_OP_WRITE);
+    TEST_CHECK_EQ(script.ops[1].len, 2);
+    TEST_CHECK_EQ(script.data[0], 0x80);
+    TEST_CHECK_EQ(script.data[1], 0xFE);
+    TEST_CHECK_EQ(script.ops[2].type, PROTOCOL_I2C_OP_START);
+    TEST_CHECK_EQ(script.data[2], 0x81);
+    TEST_CHECK_EQ(script.ops[4].type, PROTOCOL_I2C_OP_READ);
+    TEST_CHECK_EQ(script.ops[4].len, 2);
+    TEST_CHECK_EQ(script.ops[5].type, PROTOCOL_I2C_OP_STOP);
+    TEST_CHECK_EQ(script.ops[6].type, PROTOCOL_I2C_OP_DELAY);
+    TEST_CHECK_EQ(script.ops[6].time, 10);
+    TEST_CHECK_EQ(script.ops[9].offset, 2);
+    TEST_CHECK_EQ(script.read_len, 3);
+    TEST_CHECK_EQ(script.ops[10].type, PROTOCOL_I2C_OP_STOP);
+}
+
+static void test_segments(void)
+{
+    TEST_CHECK_EQ(compile("w 0x40 1; d 5; poll 0x40 0x00 0x80 0x80 50; r 0x40 1"), 0);
+    TEST_CHECK_EQ(protocol_i2c_script_segment_end(&script, 0), 3);
+    /* delay and poll run on their own */
+    TEST_CHECK_EQ(protocol_i2c_script_segment_end(&script, 3), 3);
+    TEST_CHECK_EQ(script.ops[4].type, PROTOCOL_I2C_OP_POLL);
+    TEST_CHECK_EQ(script.ops[4].width, 1);
+    TEST_CHECK_EQ(script.ops[4].time, 50);
+    TEST_CHECK_EQ(protocol_i2c_script_segment_end(&script, 5), script.op_num);
+}
+
+static void test_full_write(void)
+{
+    char text[PROTOCOL_I2C_SCRIPT_DATA_SIZE] = "w 0x40";
+    for (int i = 0; i < 32; i++) {
+        strcat(text, " 0x12");
+    }
+    TEST_CHECK_EQ(compile(text), 0);
+    TEST_CHECK_EQ(script.ops[1].len, 33);
+}
+
+static void test_errors(void)
+{
+    char text[400] = "p\n";
+
+    TEST_CHECK_EQ(compile("w 0x40 1\nw 0x80 1"), -1);
+    TEST_CHECK_EQ(script.error_line, 2);
+    TEST_CHECK_EQ(compile("r 0x40 0"), -1);
+    TEST_CHECK_EQ(compile("x 1"), -1);
+    TEST_CHECK_EQ(compile("w 0x40 0x100"), -1);
+    /* read lengths adding up past the result buffer must not wrap */
+    TEST_CHECK_EQ(compile("r 0x40 1; r 0x40 4294967295"), -1);
+    TEST_CHECK_EQ(compile("r 0x40 1; r 0x40 256"), -1);
+    TEST_CHECK_EQ(compile("r 0x40 1; r 0x40 255"), 0);
+    TEST_CHECK_EQ(script.read_len, PROTOCOL_I2C_SCRIPT_READ_SIZE);
+    TEST_CHECK_EQ(compile("r 0x40 4294967296"), -1);
+    TEST_CHECK_EQ(compile("w 0x40 4294967552"), -1);
+    TEST_CHECK_EQ(compile("d 60001"), -1);
+    TEST_CHECK_EQ(compile("poll 0x40 0 1 1 60001"), -1);
+    TEST_CHECK_EQ(compile("d 60000; poll 0x40 0 1 1 60000"), 0);
+    /* a statement longer than the line is refused, not cut */
+    memset(text + 2, '1', 300);
+    strcpy(text + 302, "\nw 0x40 1");
+    TEST_CHECK_EQ(compile(text), -1);
+    TEST_CHECK_EQ(script.error_line, 2);
+}
+
+static void test_long_comment(void)
+{
+    char text[400] = "w 0x40 1 #";
+    memset(text + 10, 'c', 300);
+    strcpy(text + 310, "\nr 0x40 2");
+    TEST_CHECK_EQ(compile(text), 0);
+    TEST_CHECK_EQ(script.read_len, 2);
+}
+
+int main(void)
+{
+    TEST_RUN(test_write_read);
+    TEST_RUN(test_segments);
+    TEST_RUN(test_full_write);
+    TEST_RUN(test_errors);
+    TEST_RUN(test_long_comment);
+    return TEST_RESULT();
+}
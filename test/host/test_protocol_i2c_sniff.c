@@ -0,0 +1,178 @@
+/**
+ * @file test_protocol_i2c_sniff.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the i2c edge stream decoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_i2c_sniff.h"
+#include "test.h"
+
+#define TICK_HZ 80000000
+#define HALF_BIT 100 /* ticks, 400 kHz */
+
+/**
+ * @brief bus waveform, an edge entry for every change of the lines
+ */
+struct bus {
+    uint32_t edges[1024];
+    size_t num;
+    uint32_t ticks;
+    uint8_t sda;
+    uint8_t scl;
+    uint32_t gap;
+};
+
+struct frames {
+    struct protocol_i2c_sniff_frame frame[4];
+    uint8_t data[4][PROTOCOL_I2C_SNIFF_DATA_SIZE];
+    size_t num;
+};
+
+static void bus_set(struct bus *bus, uint8_t sda, uint8_t scl)
+{
+    bus->ticks += HALF_BIT;
+    if (sda == bus->sda && scl == bus->scl) {
+        return;
+    }
+    bus->sda = sda;
+    bus->scl = scl;
+    bus->edges[bus->num++] = PROTOCOL_I2C_SNIFF_EDGE(bus->ticks, (sda ? PROTOCOL_I2C_SNIFF_SDA : 0)
+                                                     | (scl ? PROTOCOL_I2C_SNIFF_SCL : 0) | bus->gap);
+    bus->gap = 0;
+}
+
+static void bus_init(struct bus *bus, uint32_t ticks)
+{
+    memset(bus, 0, sizeof(*bus));
+    bus->ticks = ticks;
+    bus->sda = 1;
+    bus->scl = 1;
+}
+
+static void bus_start(struct bus *bus)
+{
+    bus_set(bus, 1, 0);
+    bus_set(bus, 1, 1);
+    bus_set(bus, 0, 1);
+    bus_set(bus, 0, 0);
+}
+
+static void bus_stop(struct bus *bus)
+{
+    bus_set(bus, 0, 0);
+    bus_set(bus, 0, 1);
+    bus_set(bus, 1, 1);
+}
+
+static void bus_bit(struct bus *bus, uint8_t bit)
+{
+    bus_set(bus, bit, 0);
+    bus_set(bus, bit, 1);
+    bus_set(bus, bit, 0);
+}
+
+static void bus_byte(struct bus *bus, uint8_t byte, uint8_t nack)
+{
+    for (int i = 7; i >= 0; i--) {
+        bus_bit(bus, (byte >> i) & 1);
+    }
+    bus_bit(bus, nack);
+}
+
+static void record(void *param, const struct protocol_i2c_sniff_frame *frame)
+{
+    struct frames *frames = param;
+    if (frames->num < 4) {
+        frames->frame[frames->num] = *frame;
+        memcpy(frames->data[frames->num], frame->data, frame->len);
+    }
+    frames->num++;
+}
+
+static void test_register_read(void)
+{
+    static struct bus bus;
+    struct protocol_i2c_sniff sniff;
+    struct frames frames = {0};
+
+    bus_init(&bus, 0);
+    bus_start(&bus);
+    bus_byte(&bus, 0x40 << 1, 0);
+    bus_byte(&bus, 0xFE, 0);
+    bus_start(&bus);
+    bus_byte(&bus, (0x40 << 1) | 1, 0);
+    bus_byte(&bus, 0x12, 0);
+    bus_byte(&bus, 0x34, 1);
+    bus_stop(&bus);
+
+    protocol_i2c_sniff_init(&sniff, TICK_HZ);
+    /* fed in two parts, the decoder keeps its state */
+    protocol_i2c_sniff_feed(&sniff, bus.edges, 10, record, &frames);
+    protocol_i2c_sniff_feed(&sniff, bus.edges + 10, bus.num - 10, record, &frames);
+    TEST_CHECK_EQ(frames.num, 2);
+    TEST_CHECK_EQ(frames.frame[0].addr, 0x40);
+    TEST_CHECK_EQ(frames.frame[0].read, 0);
+    TEST_CHECK_EQ(frames.frame[0].flags, 0);
+    TEST_CHECK_EQ(frames.frame[0].len, 1);
+    TEST_CHECK_EQ(frames.data[0][0], 0xFE);
+    TEST_CHECK_EQ(frames.frame[1].read, 1);
+    TEST_CHECK_EQ(frames.frame[1].flags, 0);
+    TEST_CHECK_EQ(frames.frame[1].len, 2);
+    TEST_CHECK_EQ(frames.data[1][0], 0x12);
+    TEST_CHECK_EQ(frames.data[1][1], 0x34);
+    /* the master nacks the last byte of a read */
+    TEST_CHECK_EQ(frames.frame[1].data_nack, 0x2);
+    TEST_CHECK(frames.frame[1].timestamp > frames.frame[0].timestamp);
+}
+
+static void test_address_nack_and_wrap(void)
+{
+    static struct bus bus;
+    struct protocol_i2c_sniff sniff;
+    struct frames frames = {0};
+
+    /* tick counter wraps inside the transfer */
+    bus_init(&bus, (1UL << (32 - PROTOCOL_I2C_SNIFF_TIME_SHIFT)) - 10 * HALF_BIT);
+    bus_start(&bus);
+    bus_byte(&bus, 0x51 << 1, 1);
+    bus_stop(&bus);
+
+    protocol_i2c_sniff_init(&sniff, TICK_HZ);
+    protocol_i2c_sniff_feed(&sniff, bus.edges, bus.num, record, &frames);
+    TEST_CHECK_EQ(frames.num, 1);
+    TEST_CHECK_EQ(frames.frame[0].addr, 0x51);
+    TEST_CHECK_EQ(frames.frame[0].flags, PROTOCOL_I2C_SNIFF_FLAG_NACK);
+    /* start to stop: scl low, 9 bits of 3 steps, 3 steps of the stop */
+    TEST_CHECK_EQ(frames.frame[0].duration, 31 * HALF_BIT / (TICK_HZ / 1000000));
+}
+
+static void test_gap(void)
+{
+    static struct bus bus;
+    struct protocol_i2c_sniff sniff;
+    struct frames frames = {0};
+
+    bus_init(&bus, 0);
+    bus_start(&bus);
+    bus_byte(&bus, 0x40 << 1, 0);
+    bus_bit(&bus, 1);
+    bus.gap = PROTOCOL_I2C_SNIFF_GAP;
+    bus_bit(&bus, 0);
+    bus_stop(&bus);
+
+    protocol_i2c_sniff_init(&sniff, TICK_HZ);
+    protocol_i2c_sniff_feed(&sniff, bus.edges, bus.num, record, &frames);
+    TEST_CHECK_EQ(frames.num, 1);
+    TEST_CHECK_EQ(frames.frame[0].flags, PROTOCOL_I2C_SNIFF_FLAG_ERROR);
+}
+
+int main(void)
+{
+    TEST_RUN(test_register_read);
+    TEST_RUN(test_address_nack_and_wrap);
+    TEST_RUN(test_gap);
+    return TEST_RESULT();
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test_protocol_matcher.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the multi pattern matcher
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_matcher.h"
+#include "test.h"
+
+#define PATTERN(text) {(const uint8_t *) (text), sizeof(text) - 1}
+
+struct hits {
+    uint32_t masks[16];
+    size_t offsets[16];
+    size_t num;
+};
+
+static void record(void *param, uint32_t mask, size_t offset)
+{
+    struct hits *hits = param;
+    if (hits->num < 16) {
+        hits->masks[hits->num] = mask;
+        hits->offsets[hits->num] = offset;
+    }
+    hits->num++;
+}
+
+static void test_overlapping(void)
+{
+    static const struct protocol_matcher_pattern patterns[] = {
+        PATTERN("he"), PATTERN("she"), PATTERN("his"), PATTERN("hers"),
+    };
+    struct protocol_matcher matcher;
+    struct hits hits = {0};
+    const char *text = "ushers";
+
+    TEST_CHECK_EQ(protocol_matcher_compile(&matcher, patterns, 4), 0);
+    TEST_CHECK_EQ(protocol_matcher_feed(&matcher, (const uint8_t *) text, strlen(text), record, &hits), 2);
+    TEST_CHECK_EQ(hits.num, 2);
+    /* "she" and "he" end on the same byte */
+    TEST_CHECK_EQ(hits.masks[0], 0x3);
+    TEST_CHECK_EQ(hits.offsets[0], 3);
+    TEST_CHECK_EQ(hits.masks[1], 0x8);
+    TEST_CHECK_EQ(hits.offsets[1], 5);
+    protocol_matcher_free(&matcher);
+}
+
+static void test_across_chunks(void)
+{
+    static const uint8_t frame[] = {0xAA, 0x55, 0x01};
+    const struct protocol_matcher_pattern patterns[] = {{frame, sizeof(frame)}};
+    struct protocol_matcher matcher;
+    struct hits hits = {0};
+    static const uint8_t first[] = {0x00, 0xAA};
+    static const uint8_t second[] = {0x55, 0x01, 0xAA, 0x55};
+
+    TEST_CHECK_EQ(protocol_matcher_compile(&matcher, patterns, 1), 0);
+    TEST_CHECK_EQ(protocol_matcher_feed(&matcher, first, sizeof(first), record, &hits), 0);
+    TEST_CHECK_EQ(protocol_matcher_feed(&matcher, second, sizeof(second), record, &hits), 1);
+    TEST_CHECK_EQ(hits.offsets[0], 1);
+    /* a reset drops the partial match */
+    protocol_matcher_reset(&matcher);
+    TEST_CHECK_EQ(protocol_matcher_feed(&matcher, &frame[2], 1, NULL, NULL), 0);
+    protocol_matcher_free(&matcher);
+}
+
+static void test_invalid(void)
+{
+    static const struct protocol_matcher_pattern empty[] = {{(const uint8_t *) "", 0}};
+    static uint8_t long_data[PROTOCOL_MATCHER_MAX_STATES];
+    const struct protocol_matcher_pattern too_long[] = {{long_data, sizeof(long_data)}};
+    struct protocol_matcher matcher;
+
+    TEST_CHECK_EQ(protocol_matcher_compile(&matcher, empty, 0), -1);
+    TEST_CHECK_EQ(protocol_matcher_compile(&matcher, empty, 1), -1);
+    TEST_CHECK_EQ(protocol_matcher_compile(&matcher, too_long, 1), -1);
+    /* a matcher that failed to compile matches nothing */
+    TEST_CHECK_EQ(protocol_matcher_feed(&matcher, long_data, 4, NULL, NULL), 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_overlapping);
+    TEST_RUN(test_across_chunks);
+    TEST_RUN(test_invalid);
+    return TEST_RESULT();
+}
@@ -0,0 +1,77 @@
+/**
+ * @file test_protocol_prbs.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the prbs generator and checker
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_prbs.h"
+#include "test.h"
+
+/**
+ * @brief reference prbs31, one bit per step
+ */
+static uint8_t reference_byte(uint32_t *state)
+{
+    uint8_t byte = 0;
+    for (int i = 0; i < 8; i++) {
+        uint32_t bit = ((*state >> 30) ^ (*state >> 27)) & 1;
+        *state = ((*state << 1) | bit) & 0x7FFFFFFF;
+        byte = (byte << 1) | bit;
+    }
+    return byte;
+}
+
+static void test_matches_reference(void)
+{
+    struct protocol_prbs prbs;
+    uint8_t data[1024];
+    uint32_t state = PROTOCOL_PRBS_DEFAULT_SEED;
+    int mismatch = 0;
+
+    protocol_prbs_init(&prbs, PROTOCOL_PRBS_DEFAULT_SEED);
+    protocol_prbs_fill(&prbs, data, sizeof(data));
+    for (size_t i = 0; i < sizeof(data); i++) {
+        mismatch |= data[i] != reference_byte(&state);
+    }
+    TEST_CHECK_EQ(mismatch, 0);
+}
+
+static void test_check_in_chunks(void)
+{
+    struct protocol_prbs tx;
+    struct protocol_prbs rx;
+    struct protocol_prbs_result result;
+    uint8_t data[300];
+
+    protocol_prbs_init(&tx, 0x1234);
+    protocol_prbs_init(&rx, 0x1234);
+    protocol_prbs_result_init(&result);
+    protocol_prbs_fill(&tx, data, sizeof(data));
+    data[200] ^= 0x81;
+    protocol_prbs_check(&rx, data, 100, &result);
+    protocol_prbs_check(&rx, data + 100, 200, &result);
+    TEST_CHECK_EQ(result.bytes, 300);
+    TEST_CHECK_EQ(result.bit_errors, 2);
+    TEST_CHECK_EQ(result.first_error, 200);
+}
+
+static void test_zero_seed(void)
+{
+    struct protocol_prbs prbs;
+    uint8_t data[16];
+    protocol_prbs_init(&prbs, 0x80000000);
+    TEST_CHECK_EQ(prbs.state, PROTOCOL_PRBS_DEFAULT_SEED);
+    protocol_prbs_fill(&prbs, data, sizeof(data));
+    TEST_CHECK(prbs.state != 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_matches_reference);
+    TEST_RUN(test_check_in_chunks);
+    TEST_RUN(test_zero_seed);
+    return TEST_RESULT();
+}
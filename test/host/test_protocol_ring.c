@@ -0,0 +1,225 @@
+/**
+ * @file test_protocol_ring.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the capture ring with a fake byte source
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_ring.h"
+#include "test.h"
+
+/**
+ * @brief fake uart, every byte is its stream position, every chunk is
+ *        stamped with the position of its first byte
+ */
+struct source {
+    uint32_t seed;
+    size_t pos;
+};
+
+static uint32_t source_random(struct source *source)
+{
+    source->seed = source->seed * 1103515245 + 12345;
+    return source->seed >> 16;
+}
+
+static size_t source_fill(struct source *source, uint8_t *data, size_t len, int64_t *timestamp)
+{
+    *timestamp = source->pos;
+    for (size_t i = 0; i < len; i++) {
+        data[i] = (source->pos + i) & 0xFF;
+    }
+    source->pos += len;
+    return len;
+}
+
+static void test_init(void)
+{
+    struct protocol_ring ring;
+    uint8_t buffer[16];
+    struct protocol_ring_chunk chunks[4];
+
+    TEST_CHECK_EQ(protocol_ring_init(&ring, buffer, 12, chunks, 4), -1);
+    TEST_CHECK_EQ(protocol_ring_init(&ring, buffer, 16, chunks, 3), -1);
+    TEST_CHECK_EQ(protocol_ring_init(&ring, buffer, 16, chunks, 0), -1);
+    TEST_CHECK_EQ(protocol_ring_init(&ring, buffer, 16, chunks, 4), 0);
+    TEST_CHECK_EQ(protocol_ring_used(&ring), 0);
+    TEST_CHECK_EQ(protocol_ring_free(&ring), 16);
+}
+
+static void test_wraparound(void)
+{
+    struct protocol_ring ring;
+    uint8_t buffer[16];
+    struct protocol_ring_chunk chunks[4];
+    struct source source = {0};
+    uint8_t data[16];
+    uint8_t back[16];
+    const uint8_t *area;
+    int64_t timestamp;
+
+    protocol_ring_init(&ring, buffer, 16, chunks, 4);
+    source_fill(&source, data, 10, &timestamp);
+    TEST_CHECK_EQ(protocol_ring_write(&ring, data, 10, timestamp), 10);
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, sizeof(back), &timestamp), 10);
+
+    /* the second chunk runs over the end of the buffer */
+    source_fill(&source, data, 12, &timestamp);
+    TEST_CHECK_EQ(protocol_ring_write(&ring, data, 12, timestamp), 12);
+    TEST_CHECK_EQ(protocol_ring_peek(&ring, &area, &timestamp), 6);
+    TEST_CHECK_EQ(timestamp, 10);
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, sizeof(back), &timestamp), 12);
+    TEST_CHECK_EQ(timestamp, 10);
+    TEST_CHECK(memcmp(back, data, 12) == 0);
+    TEST_CHECK_EQ(protocol_ring_used(&ring), 0);
+
+    /* reserve hands out the contiguous part only */
+    size_t len = 0;
+    uint8_t *dest = protocol_ring_reserve(&ring, &len);
+    TEST_CHECK(dest == buffer + 6);
+    TEST_CHECK_EQ(len, 10);
+    len = 4;
+    protocol_ring_reserve(&ring, &len);
+    TEST_CHECK_EQ(len, 4);
+}
+
+static void test_chunk_timestamps(void)
+{
+    struct protocol_ring ring;
+    uint8_t buffer[64];
+    struct protocol_ring_chunk chunks[8];
+    uint8_t back[64];
+    int64_t timestamp;
+
+    protocol_ring_init(&ring, buffer, 64, chunks, 8);
+    protocol_ring_write(&ring, (const uint8_t *) "abc", 3, 100);
+    protocol_ring_write(&ring, (const uint8_t *) "defg", 4, 200);
+    protocol_ring_write(&ring, (const uint8_t *) "h", 1, 300);
+
+    /* a read never crosses a chunk, so each keeps its own timestamp */
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, sizeof(back), &timestamp), 3);
+    TEST_CHECK_EQ(timestamp, 100);
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, 2, &timestamp), 2);
+    TEST_CHECK_EQ(timestamp, 200);
+    TEST_CHECK(memcmp(back, "de", 2) == 0);
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, sizeof(back), &timestamp), 2);
+    TEST_CHECK_EQ(timestamp, 200);
+    TEST_CHECK(memcmp(back, "fg", 2) == 0);
+
+    /* consume releases whole chunks in one go */
+    protocol_ring_write(&ring, (const uint8_t *) "ij", 2, 400);
+    protocol_ring_consume(&ring, 3);
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, sizeof(back), &timestamp), 0);
+    TEST_CHECK_EQ(protocol_ring_used(&ring), 0);
+}
+
+static void test_overrun(void)
+{
+    struct protocol_ring ring;
+    uint8_t buffer[16];
+    struct protocol_ring_chunk chunks[4];
+    uint8_t data[20] = {0};
+
+    protocol_ring_init(&ring, buffer, 16, chunks, 4);
+    TEST_CHECK_EQ(protocol_ring_write(&ring, data, 20, 0), 16);
+    TEST_CHECK_EQ(ring.overrun, 4);
+    TEST_CHECK_EQ(protocol_ring_write(&ring, data, 5, 0), 0);
+    TEST_CHECK_EQ(ring.overrun, 9);
+    size_t len = 0;
+    TEST_CHECK(protocol_ring_reserve(&ring, &len) == NULL);
+    TEST_CHECK_EQ(len, 0);
+    protocol_ring_drop(&ring, 7);
+    TEST_CHECK_EQ(ring.overrun, 16);
+    protocol_ring_reset(&ring);
+    TEST_CHECK_EQ(ring.overrun, 0);
+}
+
+static void test_chunk_exhaustion(void)
+{
+    struct protocol_ring ring;
+    uint8_t buffer[64];
+    struct protocol_ring_chunk chunks[4];
+    uint8_t back[8];
+    int64_t timestamp;
+
+    protocol_ring_init(&ring, buffer, 64, chunks, 4);
+    for (int i = 0; i < 4; i++) {
+        TEST_CHECK_EQ(protocol_ring_write(&ring, (const uint8_t *) "x", 1, i), 1);
+    }
+    /* bytes are free but no chunk slot is, the whole write is an overrun */
+    TEST_CHECK_EQ(protocol_ring_write(&ring, (const uint8_t *) "yy", 2, 4), 0);
+    TEST_CHECK_EQ(ring.overrun, 2);
+    size_t len = 3;
+    TEST_CHECK(protocol_ring_reserve(&ring, &len) != NULL);
+    TEST_CHECK_EQ(protocol_ring_commit(&ring, len, 5), 0);
+    TEST_CHECK_EQ(ring.overrun, 5);
+    TEST_CHECK_EQ(protocol_ring_used(&ring), 4);
+
+    TEST_CHECK_EQ(protocol_ring_read(&ring, back, sizeof(back), &timestamp), 1);
+    TEST_CHECK_EQ(timestamp, 0);
+    TEST_CHECK_EQ(protocol_ring_write(&ring, (const uint8_t *) "z", 1, 6), 1);
+}
+
+static void test_stream(void)
+{
+    struct protocol_ring ring;
+    uint8_t buffer[256];
+    struct protocol_ring_chunk chunks[16];
+    struct source source = {.seed = 1};
+    size_t consumed = 0;
+    int64_t chunk = -1;
+    size_t offset = 0;
+    int mismatch = 0;
+
+    protocol_ring_init(&ring, buffer, 256, chunks, 16);
+    for (int round = 0; round < 20000; round++) {
+        /* the producer fills in place like the uart driver does */
+        size_t len = source_random(&source) % 48 + 1;
+        uint8_t *dest = protocol_ring_reserve(&ring, &len);
+        int64_t timestamp;
+        if (dest) {
+            source_fill(&source, dest, len, &timestamp);
+            protocol_ring_commit(&ring, len, timestamp);
+        } else {
+            uint8_t scratch[48];
+            len = source_random(&source) % 48 + 1;
+            source_fill(&source, scratch, len, &timestamp);
+            protocol_ring_drop(&ring, len);
+        }
+
+        /* the consumer is slower and reads in small pieces */
+        for (uint32_t reads = source_random(&source) % 3; reads > 0; reads--) {
+            uint8_t back[32];
+            size_t size = protocol_ring_read(&ring, back, source_random(&source) % 32 + 1, &timestamp);
+            if (size == 0) {
+                break;
+            }
+            if (timestamp != chunk) {
+                mismatch |= timestamp < chunk;
+                chunk = timestamp;
+                offset = 0;
+            }
+            for (size_t i = 0; i < size; i++) {
+                mismatch |= back[i] != ((size_t) chunk + offset + i) % 256;
+            }
+            offset += size;
+            consumed += size;
+        }
+    }
+    TEST_CHECK_EQ(consumed + protocol_ring_used(&ring) + ring.overrun, source.pos);
+    TEST_CHECK(ring.overrun > 0);
+    TEST_CHECK_EQ(mismatch, 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_init);
+    TEST_RUN(test_wraparound);
+    TEST_RUN(test_chunk_timestamps);
+    TEST_RUN(test_overrun);
+    TEST_RUN(test_chunk_exhaustion);
+    TEST_RUN(test_stream);
+    return TEST_RESULT();
+}
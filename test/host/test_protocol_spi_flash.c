@@ -0,0 +1,219 @@
+/**
+ * @file test_protocol_spi_flash.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the spi flash command set against the simulated device
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "protocol_spi_flash.h"
+#include "test.h"
+
+#define SMALL_SIZE      (1024 * 1024)
+#define LARGE_SIZE      (32 * 1024 * 1024)
+
+/**
+ * @brief bus between the driver and the simulated device, records the ops
+ */
+struct test_bus {
+    struct protocol_spi_flash_sim sim;
+    bool no_sfdp;
+    size_t max_rx;
+    uint8_t last_cmd;
+    uint32_t delays;
+    uint32_t tick_us;
+};
+
+static int test_bus_transfer(void *ctx, const struct protocol_spi_flash_op *op)
+{
+    struct test_bus *bus = ctx;
+    if (op->cmd != PROTOCOL_SPI_FLASH_CMD_RDSR) {
+        bus->last_cmd = op->cmd;
+    }
+    if (op->rx_len > bus->max_rx && op->cmd != PROTOCOL_SPI_FLASH_CMD_SFDP) {
+        bus->max_rx = op->rx_len;
+    }
+    if (op->cmd == PROTOCOL_SPI_FLASH_CMD_SFDP && bus->no_sfdp) {
+        memset(op->rx, 0xFF, op->rx_len);
+        return 0;
+    }
+    return protocol_spi_flash_sim_transfer(&bus->sim, op);
+}
+
+static uint32_t test_bus_delay(void *ctx, uint32_t us)
+{
+    struct test_bus *bus = ctx;
+    bus->delays++;
+    return bus->tick_us ? bus->tick_us : us;
+}
+
+static int test_probe(struct protocol_spi_flash *flash, struct test_bus *bus, uint8_t *memory,
+                      uint32_t size, uint32_t jedec_id)
+{
+    struct protocol_spi_flash_io io = {
+        .transfer = test_bus_transfer,
+        .delay = test_bus_delay,
+        .ctx = bus,
+        .max_transfer = 4096,
+    };
+    protocol_spi_flash_sim_init(&bus->sim, memory, size, jedec_id);
+    return protocol_spi_flash_probe(flash, &io);
+}
+
+static void test_probe_sfdp(void)
+{
+    struct protocol_spi_flash flash;
+    struct test_bus bus = {0};
+    uint8_t *memory = malloc(SMALL_SIZE);
+
+    TEST_CHECK_EQ(test_probe(&flash, &bus, memory, SMALL_SIZE, 0xEF4014), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(flash.jedec_id, 0xEF4014);
+    TEST_CHECK(flash.sfdp);
+    TEST_CHECK_EQ(flash.size, SMALL_SIZE);
+    TEST_CHECK_EQ(flash.addr_bytes, 3);
+    TEST_CHECK_EQ(flash.erase_cmd, PROTOCOL_SPI_FLASH_CMD_SE);
+    free(memory);
+}
+
+static void test_probe_jedec_fallback(void)
+{
+    struct protocol_spi_flash flash;
+    struct test_bus bus = {.no_sfdp = true};
+    uint8_t *memory = malloc(SMALL_SIZE);
+
+    TEST_CHECK_EQ(test_probe(&flash, &bus, memory, SMALL_SIZE, 0xEF4014), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK(!flash.sfdp);
+    TEST_CHECK_EQ(flash.size, SMALL_SIZE);
+    TEST_CHECK_EQ(flash.addr_bytes, 3);
+
+    /* no device answers all ones, an unknown capacity byte is refused */
+    TEST_CHECK_EQ(test_probe(&flash, &bus, memory, SMALL_SIZE, 0xFFFFFF), PROTOCOL_SPI_FLASH_ERR_NOT_FOUND);
+    TEST_CHECK_EQ(test_probe(&flash, &bus, memory, SMALL_SIZE, 0xEF4030), PROTOCOL_SPI_FLASH_ERR_NOT_FOUND);
+    free(memory);
+}
+
+static void test_program_read_erase(void)
+{
+    struct protocol_spi_flash flash;
+    struct test_bus bus = {0};
+    uint8_t *memory = malloc(SMALL_SIZE);
+    uint8_t data[600];
+    uint8_t back[sizeof(data)];
+
+    test_probe(&flash, &bus, memory, SMALL_SIZE, 0xEF4014);
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = i * 7 + 3;
+    }
+    /* crosses two page boundaries, a single page program would wrap */
+    TEST_CHECK_EQ(protocol_spi_flash_program(&flash, 0x1F0, data, sizeof(data)), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.last_cmd, PROTOCOL_SPI_FLASH_CMD_PP);
+    TEST_CHECK(bus.delays > 0);
+    TEST_CHECK_EQ(protocol_spi_flash_read(&flash, 0x1F0, back, sizeof(back)), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.last_cmd, PROTOCOL_SPI_FLASH_CMD_READ);
+    TEST_CHECK(memcmp(data, back, sizeof(data)) == 0);
+    TEST_CHECK_EQ(memory[0x1EF], 0xFF);
+    TEST_CHECK_EQ(memory[0x1F0 + sizeof(data)], 0xFF);
+
+    /* nor programming only clears bits */
+    uint8_t value = 0x0F;
+    memory[0x2000] = 0xF0;
+    protocol_spi_flash_program(&flash, 0x2000, &value, 1);
+    TEST_CHECK_EQ(memory[0x2000], 0x00);
+
+    TEST_CHECK_EQ(protocol_spi_flash_erase_sector(&flash, 0x234), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.last_cmd, PROTOCOL_SPI_FLASH_CMD_SE);
+    protocol_spi_flash_read(&flash, 0x1F0, back, sizeof(back));
+    for (size_t i = 0; i < sizeof(back); i++) {
+        TEST_CHECK_EQ(back[i], 0xFF);
+    }
+    TEST_CHECK_EQ(memory[0x2000], 0x00);
+    free(memory);
+}
+
+static void test_read_chunks(void)
+{
+    struct protocol_spi_flash flash;
+    struct test_bus bus = {0};
+    uint8_t *memory = malloc(SMALL_SIZE);
+    uint8_t *back = malloc(10000);
+
+    test_probe(&flash, &bus, memory, SMALL_SIZE, 0xEF4014);
+    for (size_t i = 0; i < 10000; i++) {
+        memory[0x8000 + i] = i ^ (i >> 8);
+    }
+    bus.max_rx = 0;
+    TEST_CHECK_EQ(protocol_spi_flash_read(&flash, 0x8000, back, 10000), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.max_rx, 4096);
+    TEST_CHECK(memcmp(back, &memory[0x8000], 10000) == 0);
+    free(back);
+    free(memory);
+}
+
+static void test_four_byte_address(void)
+{
+    struct protocol_spi_flash flash;
+    struct test_bus bus = {0};
+    uint8_t *memory = malloc(LARGE_SIZE);
+    uint8_t data[4] = {0x12, 0x34, 0x56, 0x78};
+    uint8_t back[4];
+    uint32_t addr = LARGE_SIZE - 0x1000;
+
+    TEST_CHECK_EQ(test_probe(&flash, &bus, memory, LARGE_SIZE, 0xEF4019), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(flash.size, LARGE_SIZE);
+    TEST_CHECK_EQ(flash.addr_bytes, 4);
+    TEST_CHECK_EQ(protocol_spi_flash_program(&flash, addr, data, sizeof(data)), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.last_cmd, PROTOCOL_SPI_FLASH_CMD_PP4);
+    TEST_CHECK_EQ(memory[addr + 3], 0x78);
+    /* the same offset below 16 MB is untouched */
+    TEST_CHECK_EQ(memory[addr & 0xFFFFFF], 0xFF);
+    TEST_CHECK_EQ(protocol_spi_flash_read(&flash, addr, back, sizeof(back)), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.last_cmd, PROTOCOL_SPI_FLASH_CMD_READ4);
+    TEST_CHECK(memcmp(data, back, sizeof(data)) == 0);
+    TEST_CHECK_EQ(protocol_spi_flash_erase_sector(&flash, addr), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(bus.last_cmd, PROTOCOL_SPI_FLASH_CMD_SE4);
+    TEST_CHECK_EQ(memory[addr], 0xFF);
+    free(memory);
+}
+
+static void test_range_and_timeout(void)
+{
+    struct protocol_spi_flash flash;
+    struct test_bus bus = {0};
+    uint8_t *memory = malloc(SMALL_SIZE);
+    uint8_t data[16] = {0};
+
+    test_probe(&flash, &bus, memory, SMALL_SIZE, 0xEF4014);
+    TEST_CHECK_EQ(protocol_spi_flash_read(&flash, SMALL_SIZE - 8, data, sizeof(data)),
+                  PROTOCOL_SPI_FLASH_ERR_RANGE);
+    TEST_CHECK_EQ(protocol_spi_flash_read(&flash, SMALL_SIZE - 16, data, sizeof(data)), PROTOCOL_SPI_FLASH_OK);
+    TEST_CHECK_EQ(protocol_spi_flash_program(&flash, 0xFFFFFFF0, data, sizeof(data)),
+                  PROTOCOL_SPI_FLASH_ERR_RANGE);
+    TEST_CHECK_EQ(protocol_spi_flash_erase_start(&flash, SMALL_SIZE), PROTOCOL_SPI_FLASH_ERR_RANGE);
+
+    /* a device that never leaves wip times out instead of hanging */
+    bus.sim.busy_polls = UINT32_MAX;
+    bus.delays = 0;
+    TEST_CHECK_EQ(protocol_spi_flash_erase_sector(&flash, 0), PROTOCOL_SPI_FLASH_ERR_TIMEOUT);
+    TEST_CHECK_EQ(bus.delays, 5000);
+
+    /* a delay rounded up to a 10 ms tick still times out after 5 s */
+    bus.sim.busy = 0;
+    bus.tick_us = 10000;
+    bus.delays = 0;
+    TEST_CHECK_EQ(protocol_spi_flash_erase_sector(&flash, 0), PROTOCOL_SPI_FLASH_ERR_TIMEOUT);
+    TEST_CHECK_EQ(bus.delays, 500);
+    free(memory);
+}
+
+int main(void)
+{
+    TEST_RUN(test_probe_sfdp);
+    TEST_RUN(test_probe_jedec_fallback);
+    TEST_RUN(test_program_read_erase);
+    TEST_RUN(test_read_chunks);
+    TEST_RUN(test_four_byte_address);
+    TEST_RUN(test_range_and_timeout);
+    return TEST_RESULT();
+}
@@ -0,0 +1,227 @@
+/**
+ * @file test_protocol_uart_sniff.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the rmt uart decoder and the channel merge buffer
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "protocol_uart_sniff.h"
+#include "test.h"
+
+#define TICK_HZ     10000000
+#define BAUDRATE    115200
+
+/**
+ * @brief line waveform, level runs packed two per symbol like the rmt does
+ */
+struct line {
+    uint32_t symbols[256];
+    size_t num;
+    bool half;
+    uint8_t level;
+    uint64_t bits;      /* bit times since the first edge, 8 bit fraction */
+    uint64_t edge;      /* ticks of the last edge */
+};
+
+static void line_half(struct line *line, uint8_t level, uint32_t ticks)
+{
+    while (ticks > 0) {
+        uint32_t part = ticks > 0x7FFF ? 0x7FFF : ticks;
+        if (line->half) {
+            line->symbols[line->num - 1] |= PROTOCOL_UART_SNIFF_SYMBOL(0, 0, part, level);
+        } else {
+            line->symbols[line->num++] = PROTOCOL_UART_SNIFF_SYMBOL(part, level, 0, 0);
+        }
+        line->half = !line->half;
+        ticks -= part;
+    }
+}
+
+static void line_init(struct line *line)
+{
+    memset(line, 0, sizeof(*line));
+}
+
+/**
+ * @brief drive the line for a number of bit times, edges land on the tick
+ *        nearest to the exact bit time
+ */
+static void line_bits(struct line *line, uint8_t level, uint32_t bits)
+{
+    if (level != line->level && (line->bits || line->num)) {
+        uint64_t edge = (line->bits * TICK_HZ / BAUDRATE + 128) >> 8;
+        line_half(line, line->level, edge - line->edge);
+        line->edge = edge;
+    }
+    line->level = level;
+    line->bits += (uint64_t) bits << 8;
+}
+
+static void line_frame(struct line *line, uint8_t data, uint8_t parity, uint8_t stop)
+{
+    line_bits(line, 0, 1);
+    for (int i = 0; i < 8; i++) {
+        line_bits(line, (data >> i) & 1, 1);
+    }
+    if (parity != PROTOCOL_UART_SNIFF_PARITY_NONE) {
+        uint8_t odd = __builtin_popcount(data) & 1;
+        line_bits(line, parity == PROTOCOL_UART_SNIFF_PARITY_ODD ? !odd : odd, 1);
+    }
+    line_bits(line, stop, 1);
+}
+
+/**
+ * @brief end the block, the line goes idle high and the rmt ends with a
+ *        zero duration
+ */
+static size_t line_finish(struct line *line)
+{
+    line_bits(line, 1, 0);
+    line_bits(line, 0, 0);
+    if (!line->half) {
+        line->symbols[line->num++] = 0;
+    }
+    return line->num;
+}
+
+struct bytes {
+    struct protocol_uart_sniff_byte byte[16];
+    size_t num;
+};
+
+static void bytes_cb(void *param, const struct protocol_uart_sniff_byte *byte)
+{
+    struct bytes *bytes = param;
+    if (bytes->num < 16) {
+        bytes->byte[bytes->num++] = *byte;
+    }
+}
+
+static void test_decode_bytes(void)
+{
+    struct protocol_uart_sniff sniff;
+    struct line line;
+    struct bytes bytes = {0};
+    const uint8_t data[] = {0x55, 0x00, 0xFF, 0xA5, 0x01};
+
+    line_init(&line);
+    for (size_t i = 0; i < sizeof(data); i++) {
+        line_frame(&line, data[i], PROTOCOL_UART_SNIFF_PARITY_NONE, 1);
+        line_bits(&line, 1, i);
+    }
+    protocol_uart_sniff_init(&sniff, 2, TICK_HZ, BAUDRATE, PROTOCOL_UART_SNIFF_PARITY_NONE);
+    TEST_CHECK_EQ(protocol_uart_sniff_decode(&sniff, line.symbols, line_finish(&line), 1000, bytes_cb, &bytes),
+                  sizeof(data));
+    TEST_CHECK_EQ(bytes.num, sizeof(data));
+    for (size_t i = 0; i < bytes.num; i++) {
+        TEST_CHECK_EQ(bytes.byte[i].data, data[i]);
+        TEST_CHECK_EQ(bytes.byte[i].flags, 0);
+        TEST_CHECK_EQ(bytes.byte[i].channel, 2);
+    }
+    TEST_CHECK_EQ(bytes.byte[0].timestamp, 1000);
+    /* the second frame starts after 10 bit times, 86.8 us */
+    TEST_CHECK_EQ(bytes.byte[1].timestamp, 1000 + 10 * 1000000 / BAUDRATE);
+    TEST_CHECK_EQ(sniff.bytes, sizeof(data));
+    TEST_CHECK_EQ(sniff.errors, 0);
+}
+
+static void test_decode_parity(void)
+{
+    struct protocol_uart_sniff sniff;
+    struct line line;
+    struct bytes bytes = {0};
+
+    line_init(&line);
+    line_frame(&line, 0x31, PROTOCOL_UART_SNIFF_PARITY_EVEN, 1);
+    line_frame(&line, 0x31, PROTOCOL_UART_SNIFF_PARITY_ODD, 1);
+    protocol_uart_sniff_init(&sniff, 0, TICK_HZ, BAUDRATE, PROTOCOL_UART_SNIFF_PARITY_EVEN);
+    protocol_uart_sniff_decode(&sniff, line.symbols, line_finish(&line), 0, bytes_cb, &bytes);
+    TEST_CHECK_EQ(bytes.num, 2);
+    TEST_CHECK_EQ(bytes.byte[0].data, 0x31);
+    TEST_CHECK_EQ(bytes.byte[0].flags, 0);
+    TEST_CHECK_EQ(bytes.byte[1].data, 0x31);
+    TEST_CHECK_EQ(bytes.byte[1].flags, PROTOCOL_UART_SNIFF_FLAG_PARITY);
+    TEST_CHECK_EQ(sniff.errors, 1);
+}
+
+static void test_decode_framing_and_break(void)
+{
+    struct protocol_uart_sniff sniff;
+    struct line line;
+    struct bytes bytes = {0};
+
+    line_init(&line);
+    line_frame(&line, 0x7E, PROTOCOL_UART_SNIFF_PARITY_NONE, 0);
+    line_bits(&line, 1, 2);
+    line_frame(&line, 0x00, PROTOCOL_UART_SNIFF_PARITY_NONE, 0);
+    line_bits(&line, 1, 2);
+    protocol_uart_sniff_init(&sniff, 0, TICK_HZ, BAUDRATE, PROTOCOL_UART_SNIFF_PARITY_NONE);
+    protocol_uart_sniff_decode(&sniff, line.symbols, line_finish(&line), 0, bytes_cb, &bytes);
+    TEST_CHECK_EQ(bytes.num, 2);
+    TEST_CHECK_EQ(bytes.byte[0].data, 0x7E);
+    TEST_CHECK_EQ(bytes.byte[0].flags, PROTOCOL_UART_SNIFF_FLAG_FRAMING);
+    TEST_CHECK_EQ(bytes.byte[1].data, 0x00);
+    TEST_CHECK_EQ(bytes.byte[1].flags, PROTOCOL_UART_SNIFF_FLAG_FRAMING | PROTOCOL_UART_SNIFF_FLAG_BREAK);
+}
+
+static void test_decode_glitch(void)
+{
+    struct protocol_uart_sniff sniff;
+    struct line line;
+    struct bytes bytes = {0};
+    uint32_t bit = TICK_HZ / BAUDRATE;
+
+    /* a low pulse shorter than half a bit is not a start bit */
+    line.num = 0;
+    line.symbols[line.num++] = PROTOCOL_UART_SNIFF_SYMBOL(bit / 4, 0, bit * 3, 1);
+    line.symbols[line.num++] = PROTOCOL_UART_SNIFF_SYMBOL(bit, 0, bit * 8, 1);
+    line.symbols[line.num++] = PROTOCOL_UART_SNIFF_SYMBOL(bit * 2, 1, 0, 1);
+    protocol_uart_sniff_init(&sniff, 0, TICK_HZ, BAUDRATE, PROTOCOL_UART_SNIFF_PARITY_NONE);
+    TEST_CHECK_EQ(protocol_uart_sniff_decode(&sniff, line.symbols, line.num, 0, bytes_cb, &bytes), 1);
+    TEST_CHECK_EQ(bytes.byte[0].data, 0xFF);
+    TEST_CHECK_EQ(bytes.byte[0].flags, 0);
+}
+
+static void test_merge_order(void)
+{
+    struct protocol_uart_sniff_merge merge;
+    struct protocol_uart_sniff_byte entries[4];
+    struct bytes bytes = {0};
+    const int64_t times[] = {10, 30, 20, 40, 25};
+
+    protocol_uart_sniff_merge_init(&merge, entries, 4);
+    for (size_t i = 0; i < 4; i++) {
+        struct protocol_uart_sniff_byte byte = {.timestamp = times[i], .data = i};
+        protocol_uart_sniff_merge_push(&merge, &byte, bytes_cb, &bytes);
+    }
+    TEST_CHECK_EQ(bytes.num, 0);
+    TEST_CHECK_EQ(protocol_uart_sniff_merge_pop(&merge, 30, bytes_cb, &bytes), 2);
+    TEST_CHECK_EQ(bytes.byte[0].timestamp, 10);
+    TEST_CHECK_EQ(bytes.byte[1].timestamp, 20);
+    TEST_CHECK_EQ(merge.count, 2);
+
+    /* full buffer releases the oldest entry early */
+    struct protocol_uart_sniff_byte byte = {.timestamp = times[4]};
+    protocol_uart_sniff_merge_push(&merge, &byte, bytes_cb, &bytes);
+    protocol_uart_sniff_merge_push(&merge, &byte, bytes_cb, &bytes);
+    protocol_uart_sniff_merge_push(&merge, &byte, bytes_cb, &bytes);
+    TEST_CHECK_EQ(merge.forced, 1);
+    TEST_CHECK_EQ(bytes.byte[2].timestamp, 25);
+    TEST_CHECK_EQ(protocol_uart_sniff_merge_pop(&merge, INT64_MAX, bytes_cb, &bytes), 4);
+    TEST_CHECK_EQ(bytes.num, 7);
+    for (size_t i = 1; i < bytes.num; i++) {
+        TEST_CHECK(bytes.byte[i].timestamp >= bytes.byte[i - 1].timestamp);
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_decode_bytes);
+    TEST_RUN(test_decode_parity);
+    TEST_RUN(test_decode_framing_and_break);
+    TEST_RUN(test_decode_glitch);
+    TEST_RUN(test_merge_order);
+    return TEST_RESULT();
+}
@@ -0,0 +1,97 @@
+/**
+ * @file test_pwm_phase.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the pwm phase and complementary pair layout
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "pwm_phase.h"
+#include "test.h"
+
+#define HIGH    10
+#define LOW     90
+
+static void test_dead_ticks(void)
+{
+    /* 1 us of a 1 kHz 14 bit period is 16.4 ticks */
+    TEST_CHECK_EQ(pwm_phase_dead_ticks(1000, 14, 1000000), 16);
+    TEST_CHECK_EQ(pwm_phase_dead_ticks(0, 14, 1000000), 0);
+    /* 100 ns of 1 MHz at 6 bits is 6.4 ticks */
+    TEST_CHECK_EQ(pwm_phase_dead_ticks(100, 6, 1000000000ULL), 6);
+}
+
+static void test_layout_phase(void)
+{
+    const uint32_t duty[] = {5000, 2500, 10000};
+    const uint32_t phase[] = {0, 7500, 12500};
+    struct pwm_phase_output out[3];
+
+    pwm_phase_layout(duty, phase, 3, 10, false, 0, out);
+    TEST_CHECK_EQ(out[0].hpoint, 0);
+    TEST_CHECK_EQ(out[0].duty, 512);
+    TEST_CHECK_EQ(out[1].hpoint, 768);
+    TEST_CHECK_EQ(out[1].duty, 256);
+    /* phase wraps at a full period */
+    TEST_CHECK_EQ(out[2].hpoint, 256);
+    TEST_CHECK_EQ(out[2].duty, 1024);
+}
+
+static void test_layout_complementary(void)
+{
+    const uint32_t duty[] = {5000, 1234};
+    const uint32_t phase[] = {9000, 4321};
+    struct pwm_phase_output out[2];
+
+    pwm_phase_layout(duty, phase, 2, 10, true, 10, out);
+    TEST_CHECK_EQ(out[0].hpoint, 922);
+    TEST_CHECK_EQ(out[0].duty, 512);
+    /* channel 1 fills the rest of the period less a dead time each side */
+    TEST_CHECK_EQ(out[1].hpoint, (922 + 512 + 10) & 1023);
+    TEST_CHECK_EQ(out[1].duty, 1024 - 512 - 20);
+
+    /* no room left for the inverse output */
+    const uint32_t full[] = {9900, 0};
+    pwm_phase_layout(full, phase, 2, 10, true, 10, out);
+    TEST_CHECK_EQ(out[1].duty, 0);
+}
+
+static void test_wave(void)
+{
+    struct pwm_phase_point points[PWM_PHASE_WAVE_POINTS];
+    struct pwm_phase_output output = {.hpoint = 0, .duty = 512};
+
+    TEST_CHECK_EQ(pwm_phase_wave(&output, 10, 100, HIGH, LOW, points), 6);
+    TEST_CHECK_EQ(points[0].y, LOW);
+    TEST_CHECK_EQ(points[1].x, 0);
+    TEST_CHECK_EQ(points[2].y, HIGH);
+    TEST_CHECK_EQ(points[3].x, 50);
+    TEST_CHECK_EQ(points[4].y, LOW);
+    TEST_CHECK_EQ(points[5].x, 100);
+
+    /* a pulse running over the end of the period starts high */
+    output = (struct pwm_phase_output) {.hpoint = 768, .duty = 512};
+    TEST_CHECK_EQ(pwm_phase_wave(&output, 10, 100, HIGH, LOW, points), 6);
+    TEST_CHECK_EQ(points[0].y, HIGH);
+    TEST_CHECK_EQ(points[1].x, 25);
+    TEST_CHECK_EQ(points[2].y, LOW);
+    TEST_CHECK_EQ(points[3].x, 75);
+    TEST_CHECK_EQ(points[4].y, HIGH);
+
+    output = (struct pwm_phase_output) {.hpoint = 100, .duty = 1024};
+    TEST_CHECK_EQ(pwm_phase_wave(&output, 10, 100, HIGH, LOW, points), 2);
+    TEST_CHECK_EQ(points[0].y, HIGH);
+    TEST_CHECK_EQ(points[1].y, HIGH);
+    output.duty = 0;
+    TEST_CHECK_EQ(pwm_phase_wave(&output, 10, 100, HIGH, LOW, points), 2);
+    TEST_CHECK_EQ(points[1].y, LOW);
+}
+
+int main(void)
+{
+    TEST_RUN(test_dead_ticks);
+    TEST_RUN(test_layout_phase);
+    TEST_RUN(test_layout_complementary);
+    TEST_RUN(test_wave);
+    return TEST_RESULT();
+}
@@ -0,0 +1,95 @@
+/**
+ * @file test_pwm_program.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the pwm sequencer program compiler
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "pwm_program.h"
+#include "test.h"
+
+static struct pwm_program program;
+
+static int compile(const char *text)
+{
+    return pwm_program_compile(&program, text, strlen(text));
+}
+
+static void test_statements(void)
+{
+    TEST_CHECK_EQ(compile("f 1 1000\n"
+                          "d 1 2 2500 # quarter\n"
+                          "fade 0 3 10000 200; w 50\n"), 0);
+    TEST_CHECK_EQ(program.step_num, 4);
+    TEST_CHECK_EQ(program.steps[0].type, PWM_STEP_FREQ);
+    TEST_CHECK_EQ(program.steps[0].group, 1);
+    TEST_CHECK_EQ(program.steps[0].value, 1000);
+    TEST_CHECK_EQ(program.steps[1].type, PWM_STEP_DUTY);
+    TEST_CHECK_EQ(program.steps[1].index, 2);
+    TEST_CHECK_EQ(program.steps[1].value, 2500);
+    TEST_CHECK_EQ(program.steps[2].type, PWM_STEP_FADE);
+    TEST_CHECK_EQ(program.steps[2].group, 0);
+    TEST_CHECK_EQ(program.steps[2].value, 10000);
+    TEST_CHECK_EQ(program.steps[2].time, 200);
+    TEST_CHECK_EQ(program.steps[3].type, PWM_STEP_WAIT);
+    TEST_CHECK_EQ(program.steps[3].time, 50000);
+    TEST_CHECK_EQ(pwm_program_duration(&program), 50000);
+}
+
+static void test_sweep(void)
+{
+    TEST_CHECK_EQ(compile("sweep 0 100 10000 3 10 log"), 0);
+    TEST_CHECK_EQ(program.step_num, 6);
+    TEST_CHECK_EQ(program.steps[0].value, 100);
+    TEST_CHECK_EQ(program.steps[2].value, 1000);
+    TEST_CHECK_EQ(program.steps[4].value, 10000);
+    TEST_CHECK_EQ(program.steps[5].type, PWM_STEP_WAIT);
+    TEST_CHECK_EQ(pwm_program_duration(&program), 30000);
+
+    TEST_CHECK_EQ(compile("sweep 0 1000 100 4 1"), 0);
+    TEST_CHECK_EQ(program.steps[0].value, 1000);
+    TEST_CHECK_EQ(program.steps[2].value, 700);
+    TEST_CHECK_EQ(program.steps[6].value, 100);
+}
+
+static void test_ramp(void)
+{
+    TEST_CHECK_EQ(compile("ramp 1 3 10000 0 5 2"), 0);
+    TEST_CHECK_EQ(program.step_num, 10);
+    for (int i = 0; i < 5; i++) {
+        TEST_CHECK_EQ(program.steps[i * 2].type, PWM_STEP_DUTY);
+        TEST_CHECK_EQ(program.steps[i * 2].index, 3);
+        TEST_CHECK_EQ(program.steps[i * 2].value, 10000 - i * 2500);
+    }
+    TEST_CHECK_EQ(pwm_program_duration(&program), 10000);
+}
+
+static void test_errors(void)
+{
+    TEST_CHECK_EQ(compile("f 0 1000\nf 0 0\n"), -1);
+    TEST_CHECK_EQ(program.error_line, 2);
+    TEST_CHECK_EQ(compile("w 10\n\n# x\nd 0 1\n"), -1);
+    TEST_CHECK_EQ(program.error_line, 4);
+    TEST_CHECK_EQ(compile("w 4294968"), -1);
+    TEST_CHECK_EQ(compile("f 0 1000 log"), -1);
+    TEST_CHECK_EQ(compile("sweep 0 100 1000 1 10"), -1);
+    TEST_CHECK_EQ(compile("sweep 0 0 1000 3 10"), -1);
+    TEST_CHECK_EQ(compile("d 0 1 0x"), -1);
+    TEST_CHECK_EQ(compile("x"), -1);
+
+    /* every point of a sweep takes two steps, a full program is an error */
+    TEST_CHECK_EQ(compile("sweep 0 100 1000 256 1"), 0);
+    TEST_CHECK_EQ(program.step_num, PWM_PROGRAM_MAX_STEPS);
+    TEST_CHECK_EQ(compile("sweep 0 100 1000 256 1; w 1"), -1);
+}
+
+int main(void)
+{
+    TEST_RUN(test_statements);
+    TEST_RUN(test_sweep);
+    TEST_RUN(test_ramp);
+    TEST_RUN(test_errors);
+    return TEST_RESULT();
+}
@@ -0,0 +1,188 @@
+/**
+ * @file test_pwm_pulse.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the rmt pulse train encoder
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include <string.h>
+#include "pwm_pulse.h"
+#include "test.h"
+
+#define TICK_HZ 1000000
+
+static uint32_t duration0(uint32_t symbol)
+{
+    return symbol & PWM_PULSE_DURATION_MAX;
+}
+
+static uint32_t duration1(uint32_t symbol)
+{
+    return (symbol >> 16) & PWM_PULSE_DURATION_MAX;
+}
+
+static void test_level_split(void)
+{
+    struct pwm_pulse_buffer buffer;
+    uint32_t symbols[4];
+
+    pwm_pulse_init(&buffer, symbols, 4);
+    TEST_CHECK_EQ(pwm_pulse_level(&buffer, true, 70000), 0);
+    TEST_CHECK_EQ(buffer.num, 2);
+    TEST_CHECK(buffer.half);
+    TEST_CHECK_EQ(symbols[0], PWM_PULSE_SYMBOL(23333, 1, 23333, 1));
+    TEST_CHECK_EQ(duration0(symbols[1]), 23334);
+    TEST_CHECK_EQ(pwm_pulse_ticks(&buffer), 70000);
+    TEST_CHECK_EQ(pwm_pulse_level(&buffer, false, 0), 0);
+    TEST_CHECK_EQ(buffer.num, 2);
+
+    /* does not fit in the 5 halves left, the buffer is unchanged */
+    TEST_CHECK_EQ(pwm_pulse_level(&buffer, false, PWM_PULSE_DURATION_MAX * 6), -1);
+    TEST_CHECK_EQ(buffer.num, 2);
+    TEST_CHECK(buffer.half);
+}
+
+static void test_period_rollback(void)
+{
+    struct pwm_pulse_buffer buffer;
+    uint32_t symbols[1];
+
+    pwm_pulse_init(&buffer, symbols, 1);
+    TEST_CHECK_EQ(pwm_pulse_period(&buffer, 100, 30), 0);
+    TEST_CHECK_EQ(symbols[0], PWM_PULSE_SYMBOL(30, 1, 70, 0));
+    TEST_CHECK_EQ(pwm_pulse_period(&buffer, 100, 30), -1);
+    TEST_CHECK_EQ(buffer.num, 1);
+    TEST_CHECK(!buffer.half);
+
+    /* the high half of a failed period is taken out of a pending symbol */
+    pwm_pulse_init(&buffer, symbols, 1);
+    pwm_pulse_level(&buffer, false, 10);
+    TEST_CHECK_EQ(pwm_pulse_period(&buffer, 100, 30), -1);
+    TEST_CHECK_EQ(buffer.num, 1);
+    TEST_CHECK(buffer.half);
+    TEST_CHECK_EQ(symbols[0], PWM_PULSE_SYMBOL(10, 0, 0, 0));
+}
+
+static void test_finish(void)
+{
+    struct pwm_pulse_buffer buffer;
+    uint32_t symbols[2];
+
+    pwm_pulse_init(&buffer, symbols, 2);
+    pwm_pulse_level(&buffer, true, 11);
+    pwm_pulse_finish(&buffer);
+    TEST_CHECK(!buffer.half);
+    TEST_CHECK_EQ(symbols[0], PWM_PULSE_SYMBOL(6, 1, 5, 1));
+
+    /* a one tick level is stretched, the rmt needs both halves set */
+    pwm_pulse_level(&buffer, false, 1);
+    pwm_pulse_finish(&buffer);
+    TEST_CHECK_EQ(symbols[1], PWM_PULSE_SYMBOL(1, 0, 1, 0));
+}
+
+static void test_stepper(void)
+{
+    struct pwm_pulse_buffer accel;
+    struct pwm_pulse_buffer decel;
+    struct pwm_pulse_ramp ramp;
+    uint32_t accel_symbols[64];
+    uint32_t decel_symbols[64];
+
+    pwm_pulse_init(&accel, accel_symbols, 64);
+    pwm_pulse_init(&decel, decel_symbols, 64);
+    /* v^2 / 2a = 50 steps to reach 1000 steps/s */
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 1000, 1000, 10000, 10, &ramp), 0);
+    TEST_CHECK_EQ(ramp.ramp_steps, 50);
+    TEST_CHECK_EQ(ramp.cruise_steps, 900);
+    TEST_CHECK_EQ(ramp.cruise_period, 1000);
+    TEST_CHECK_EQ(accel.num, 50);
+    TEST_CHECK_EQ(accel_symbols[0], PWM_PULSE_SYMBOL(10, 1, 14142 - 10, 0));
+    TEST_CHECK_EQ(pwm_pulse_ticks(&accel), pwm_pulse_ticks(&decel));
+    TEST_CHECK_EQ(decel_symbols[49], accel_symbols[0]);
+    for (size_t i = 1; i < accel.num; i++) {
+        TEST_CHECK(duration1(accel_symbols[i]) <= duration1(accel_symbols[i - 1]));
+        TEST_CHECK(duration0(accel_symbols[i]) + duration1(accel_symbols[i]) >= ramp.cruise_period);
+    }
+
+    /* a triangle move cruises its odd step at the peak speed */
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 21, 1000, 10000, 10, &ramp), 0);
+    TEST_CHECK_EQ(ramp.ramp_steps, 10);
+    TEST_CHECK_EQ(ramp.cruise_steps, 1);
+    TEST_CHECK(ramp.cruise_period > 1000);
+    TEST_CHECK_EQ(ramp.cruise_period, duration0(accel_symbols[9]) + duration1(accel_symbols[9]));
+}
+
+static void test_stepper_errors(void)
+{
+    struct pwm_pulse_buffer accel;
+    struct pwm_pulse_buffer decel;
+    struct pwm_pulse_ramp ramp;
+    uint32_t accel_symbols[64];
+    uint32_t decel_symbols[64];
+
+    pwm_pulse_init(&accel, accel_symbols, 64);
+    pwm_pulse_init(&decel, decel_symbols, 64);
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 0, 1000, 10000, 10, &ramp), -1);
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 100, 0, 10000, 10, &ramp), -1);
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 100, 1000, 0, 10, &ramp), -1);
+    /* the pulse must fit in the cruise period */
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 100, 1000, 10000, 1000, &ramp), -1);
+    /* a ramp of 50 million steps is refused before anything is allocated */
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 1000000000, 10000, 1, 10, &ramp), -1);
+    /* v^2 / 2a of about 5e9 steps does not fit a uint32_t */
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 4000000000u, 100000, 1, 5, &ramp), -1);
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 4, 100000, 1, 5, &ramp), 0);
+    TEST_CHECK_EQ(ramp.ramp_steps, 2);
+    TEST_CHECK_EQ(ramp.cruise_steps, 0);
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 200, 1000, 10000, 10, &ramp), 0);
+    pwm_pulse_init(&decel, decel_symbols, 32);
+    TEST_CHECK_EQ(pwm_pulse_stepper(&accel, &decel, TICK_HZ, 200, 1000, 10000, 10, &ramp), -1);
+}
+
+static void test_parse(void)
+{
+    struct pwm_pulse_buffer buffer;
+    uint32_t symbols[4];
+    int error;
+    const char *text = "h10 l20;H5 # low next\nl1";
+
+    pwm_pulse_init(&buffer, symbols, 4);
+    TEST_CHECK_EQ(pwm_pulse_parse(&buffer, TICK_HZ, text, strlen(text), true, &error), strlen(text));
+    TEST_CHECK_EQ(error, 0);
+    TEST_CHECK_EQ(buffer.num, 2);
+    TEST_CHECK_EQ(symbols[0], PWM_PULSE_SYMBOL(10, 1, 20, 0));
+    TEST_CHECK_EQ(symbols[1], PWM_PULSE_SYMBOL(5, 1, 1, 0));
+
+    /* a token at the end of a chunk waits for more text */
+    pwm_pulse_init(&buffer, symbols, 4);
+    TEST_CHECK_EQ(pwm_pulse_parse(&buffer, TICK_HZ, "h10 l2", 6, false, &error), 4);
+    TEST_CHECK_EQ(error, 0);
+    TEST_CHECK_EQ(buffer.num, 1);
+
+    /* stops before a token that does not fit, without an error */
+    pwm_pulse_init(&buffer, symbols, 1);
+    TEST_CHECK_EQ(pwm_pulse_parse(&buffer, TICK_HZ, "h1 l1 h1", 8, true, &error), 6);
+    TEST_CHECK_EQ(error, 0);
+
+    pwm_pulse_init(&buffer, symbols, 4);
+    pwm_pulse_parse(&buffer, TICK_HZ, "h1 x10", 6, true, &error);
+    TEST_CHECK_EQ(error, 1);
+    pwm_pulse_parse(&buffer, TICK_HZ, "h1a", 3, true, &error);
+    TEST_CHECK_EQ(error, 1);
+    pwm_pulse_parse(&buffer, TICK_HZ, "h", 1, true, &error);
+    TEST_CHECK_EQ(error, 1);
+    pwm_pulse_parse(&buffer, 80000000, "h4294967295", 11, true, &error);
+    TEST_CHECK_EQ(error, 1);
+}
+
+int main(void)
+{
+    TEST_RUN(test_level_split);
+    TEST_RUN(test_period_rollback);
+    TEST_RUN(test_finish);
+    TEST_RUN(test_stepper);
+    TEST_RUN(test_stepper_errors);
+    TEST_RUN(test_parse);
+    return TEST_RESULT();
+}
@@ -0,0 +1,97 @@
+/**
+ * @file test_pwm_solver.c
+ * @author Letter (NevermindZZT@gmail.com)
+ * @brief host test of the ledc clock and duty resolution solver
+ * @version 1.0.0
+ * @date 2026-10-17
+ * @copyright (c) 2026 Letter All rights reserved.
+ */
+#include "pwm_solver.h"
+#include "test.h"
+
+#define BITS_MAX    14
+
+/* apb, xtal and rc fast of the esp32s3, in the order pwm.c prefers them */
+static const uint32_t source_hz[] = {80000000, 40000000, 17500000};
+
+static void test_exact(void)
+{
+    struct pwm_solution solution;
+
+    TEST_CHECK_EQ(pwm_solve(1000, source_hz, 3, BITS_MAX, &solution), 0);
+    TEST_CHECK_EQ(solution.source, 0);
+    TEST_CHECK_EQ(solution.bits, 14);
+    TEST_CHECK_EQ(solution.div, 1250);
+    TEST_CHECK_EQ(solution.freq_mhz, 1000000);
+
+    /* half the source clock leaves a single bit of duty */
+    TEST_CHECK_EQ(pwm_solve(40000000, source_hz, 3, BITS_MAX, &solution), 0);
+    TEST_CHECK_EQ(solution.source, 0);
+    TEST_CHECK_EQ(solution.bits, 1);
+    TEST_CHECK_EQ(solution.div, PWM_SOLVER_DIV_MIN);
+    TEST_CHECK_EQ(solution.freq_mhz, 40000000000ULL);
+}
+
+static void test_rounding(void)
+{
+    struct pwm_solution solution;
+
+    /* 416.67 rounds up like the ledc driver, the error shows in freq_mhz */
+    TEST_CHECK_EQ(pwm_solve(3000, source_hz, 3, BITS_MAX, &solution), 0);
+    TEST_CHECK_EQ(solution.bits, 14);
+    TEST_CHECK_EQ(solution.div, 417);
+    TEST_CHECK_EQ(solution.freq_mhz, 2997601);
+}
+
+static void test_limits(void)
+{
+    struct pwm_solution solution;
+
+    /* the lowest frequency only the rc clock divides down to */
+    TEST_CHECK_EQ(pwm_solve(2, source_hz, 3, BITS_MAX, &solution), 0);
+    TEST_CHECK_EQ(solution.source, 2);
+    TEST_CHECK_EQ(solution.bits, 14);
+    TEST_CHECK(solution.div <= PWM_SOLVER_DIV_MAX);
+    TEST_CHECK_EQ(pwm_solve(1, source_hz, 3, BITS_MAX, &solution), -1);
+
+    TEST_CHECK_EQ(pwm_solve(0, source_hz, 3, BITS_MAX, &solution), -1);
+    TEST_CHECK_EQ(pwm_solve(40000001, source_hz, 3, BITS_MAX, &solution), -1);
+}
+
+static void test_preference(void)
+{
+    struct pwm_solution solution;
+    const uint32_t slow_first[] = {1000000, 80000000};
+    const uint32_t close_second[] = {1000003, 1000000};
+
+    /* a higher resolution wins over the source order */
+    TEST_CHECK_EQ(pwm_solve(1000, slow_first, 2, BITS_MAX, &solution), 0);
+    TEST_CHECK_EQ(solution.source, 1);
+    TEST_CHECK_EQ(solution.bits, 14);
+
+    /* equal resolutions go to the smaller error */
+    TEST_CHECK_EQ(pwm_solve(1000, close_second, 2, BITS_MAX, &solution), 0);
+    TEST_CHECK_EQ(solution.source, 1);
+    TEST_CHECK_EQ(solution.bits, 9);
+    TEST_CHECK_EQ(solution.freq_mhz, 1000000);
+}
+
+static void test_duty(void)
+{
+    TEST_CHECK_EQ(pwm_solver_duty(0, 10), 0);
+    TEST_CHECK_EQ(pwm_solver_duty(5000, 10), 512);
+    TEST_CHECK_EQ(pwm_solver_duty(PWM_SOLVER_DUTY_SCALE, 10), 1024);
+    TEST_CHECK_EQ(pwm_solver_duty(PWM_SOLVER_DUTY_SCALE * 2, 14), 16384);
+    TEST_CHECK_EQ(pwm_solver_duty(2500, 1), 1);
+    TEST_CHECK_EQ(pwm_solver_duty(2499, 1), 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_exact);
+    TEST_RUN(test_rounding);
+    TEST_RUN(test_limits);
+    TEST_RUN(test_preference);
+    TEST_RUN(test_duty);
+    return TEST_RESULT();
+}
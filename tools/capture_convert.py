@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+convert esp32 tool capture files (capture start) to csv or pcapng
+
+usage:
+    capture_convert.py capture.bin -o capture.csv
+    capture_convert.py capture.bin -o capture.pcapng
+
+pcapng uses one interface per source with LINKTYPE_USER0 + source,
+each packet starts with a 4 byte pseudo header: address (u16 be), flags (u16 be),
+direction is stored in the epb_flags option (inbound/outbound)
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = 0x50435445
+HEADER = struct.Struct('<IHHII')
+RECORD = struct.Struct('<qHBBHH')
+
+SOURCES = {0: 'uart', 1: 'i2c', 2: 'spi'}
+DIRECTIONS = {0: 'rx', 1: 'tx'}
+
+LINKTYPE_USER0 = 147
+
+
+def read_records(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        raise ValueError('file too short')
+    magic, version, header_size, resolution, _ = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError('bad magic 0x%08x' % magic)
+    offset = header_size
+    while offset + RECORD.size <= len(data):
+        timestamp, length, source, direction, address, flags = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+        if offset + length > len(data):
+            print('truncated record at %d' % (offset - RECORD.size), file=sys.stderr)
+            break
+        payload = data[offset:offset + length]
+        offset += length
+        yield timestamp * resolution // 1000, source, direction, address, flags, payload
+
+
+def write_csv(records, out):
+    out.write('timestamp_us,source,direction,address,flags,length,data\n')
+    for timestamp, source, direction, address, flags, payload in records:
+        out.write('%d,%s,%s,0x%02x,0x%04x,%d,%s\n' % (
+            timestamp, SOURCES.get(source, str(source)), DIRECTIONS.get(direction, str(direction)),
+            address, flags, len(payload), payload.hex()))
+
+
+def pcapng_block(block_type, body):
+    body += b'\0' * (-len(body) % 4)
+    length = len(body) + 12
+    return struct.pack('<II', block_type, length) + body + struct.pack('<I', length)
+
+
+def write_pcapng(records, out):
+    out.write(pcapng_block(0x0A0D0D0A, struct.pack('<IHHq', 0x1A2B3C4D, 1, 0, -1)))
+    interfaces = {}
+    for timestamp, source, direction, address, flags, payload in records:
+        if source not in interfaces:
+            interfaces[source] = len(interfaces)
+            # if_tsresol = 6 (us), opt_endofopt
+            options = struct.pack('<HHB3x', 9, 1, 6) + struct.pack('<HH', 0, 0)
+            out.write(pcapng_block(1, struct.pack('<HHI', LINKTYPE_USER0 + source, 0, 0) + options))
+        packet = struct.pack('>HH', address, flags) + payload
+        body = struct.pack('<IIIII', interfaces[source], (timestamp >> 32) & 0xFFFFFFFF,
+                           timestamp & 0xFFFFFFFF, len(packet), len(packet))
+        body += packet + b'\0' * (-len(packet) % 4)
+        # epb_flags: inbound = 1, outbound = 2
+        body += struct.pack('<HHI', 2, 4, 2 if direction == 1 else 1) + struct.pack('<HH', 0, 0)
+        out.write(pcapng_block(6, body))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='convert esp32 tool capture file')
+    parser.add_argument('input', help='capture file')
+    parser.add_argument('-o', '--output', required=True, help='output file, .csv or .pcapng')
+    args = parser.parse_args()
+
+    records = read_records(args.input)
+    if args.output.endswith('.pcapng'):
+        with open(args.output, 'wb') as out:
+            write_pcapng(records, out)
+    else:
+        with open(args.output, 'w') as out:
+            write_csv(records, out)
+
+
+if __name__ == '__main__':
+    main()